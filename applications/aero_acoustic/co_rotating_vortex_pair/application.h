@@ -544,6 +544,7 @@ public:
                                                             this->mpi_comm,
                                                             this->param.grid,
                                                             this->param.involves_h_multigrid(),
+                                                            this->param.degree_u,
                                                             lambda_create_triangulation,
                                                             {});
 
@@ -213,6 +213,7 @@ private:
                                                             this->mpi_comm,
                                                             this->param.grid,
                                                             this->param.involves_h_multigrid(),
+                                                            this->param.degree,
                                                             lambda_create_triangulation,
                                                             {} /* no local refinements */);
 
@@ -394,6 +394,7 @@ private:
                                                             this->mpi_comm,
                                                             this->param.grid,
                                                             this->param.involves_h_multigrid(),
+                                                            this->param.degree_u,
                                                             lambda_create_triangulation,
                                                             {} /* no local refinements */);
 
@@ -486,10 +487,11 @@ private:
     pp_data_turb_ch.turb_ch_data.time_control_data_statistics
       .write_preliminary_results_every_nth_time_step = SAMPLE_EVERY_TIME_STEPS * 100;
 
-    pp_data_turb_ch.turb_ch_data.cells_are_stretched = true;
-    pp_data_turb_ch.turb_ch_data.viscosity           = VISCOSITY;
-    pp_data_turb_ch.turb_ch_data.directory           = this->output_parameters.directory;
-    pp_data_turb_ch.turb_ch_data.filename            = this->output_parameters.filename;
+    pp_data_turb_ch.turb_ch_data.cells_are_stretched        = true;
+    pp_data_turb_ch.turb_ch_data.use_matrix_free_evaluation = true;
+    pp_data_turb_ch.turb_ch_data.viscosity                  = VISCOSITY;
+    pp_data_turb_ch.turb_ch_data.directory                  = this->output_parameters.directory;
+    pp_data_turb_ch.turb_ch_data.filename                   = this->output_parameters.filename;
 
     std::shared_ptr<PostProcessorBase<dim, Number>> pp;
     pp.reset(new MyPostProcessor<dim, Number>(pp_data_turb_ch, this->mpi_comm));
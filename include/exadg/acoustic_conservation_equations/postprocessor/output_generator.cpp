@@ -45,6 +45,8 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
   mapping              = &mapping_in;
   output_data          = output_data_in;
 
+  output_data.check();
+
   time_control.setup(output_data_in.time_control_data);
 
   if(output_data.time_control_data.is_active)
@@ -107,26 +109,27 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & pressure,
 {
   print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
 
-  VectorWriter<dim, Number> vector_writer(output_data, time_control.get_counter(), mpi_comm);
+  auto vector_writer =
+    std::make_shared<VectorWriter<dim, Number>>(output_data, time_control.get_counter(), mpi_comm);
 
   if(output_data.write_pressure)
   {
-    vector_writer.add_data_vector(pressure, *dof_handler_pressure, {"pressure"});
+    vector_writer->add_data_vector(pressure, *dof_handler_pressure, {"pressure"});
   }
 
   if(output_data.write_velocity)
   {
     std::vector<std::string> component_names(dim, "velocity");
     std::vector<bool>        component_is_part_of_vector(dim, true);
-    vector_writer.add_data_vector(velocity,
-                                  *dof_handler_velocity,
-                                  component_names,
-                                  component_is_part_of_vector);
+    vector_writer->add_data_vector(velocity,
+                                   *dof_handler_velocity,
+                                   component_names,
+                                   component_is_part_of_vector);
   }
 
-  vector_writer.write_aspect_ratio(*dof_handler_velocity, *mapping);
+  vector_writer->write_aspect_ratio(*dof_handler_velocity, *mapping);
 
-  vector_writer.write_pvtu(&(*mapping));
+  write_vector_output(vector_writer, output_data, asynchronous_writer, &(*mapping), time);
 }
 
 template class OutputGenerator<2, float>;
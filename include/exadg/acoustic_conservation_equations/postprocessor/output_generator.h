@@ -22,6 +22,7 @@
 #ifndef EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 #define EXADG_ACOUSTIC_CONSERVATION_EQUATIONS_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 
+#include <exadg/postprocessor/asynchronous_output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
@@ -79,6 +80,9 @@ private:
   dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
   dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
   dealii::ObserverPointer<dealii::Mapping<dim> const>    mapping;
+
+  // writes output in the background in case of asynchronous output
+  mutable AsynchronousOutputWriter asynchronous_writer;
 };
 
 } // namespace Acoustics
@@ -19,6 +19,11 @@
  *  ______________________________________________________________________
  */
 
+// C++
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 // ExaDG
 #include <exadg/aero_acoustic/driver.h>
 #include <exadg/utilities/print_general_infos.h>
@@ -27,11 +32,18 @@ namespace ExaDG
 {
 namespace AeroAcoustic
 {
+// MPI tag of the message sent from the fluid to the acoustic processes in every macro time step
+int const mpi_tag_macro_time_step = 4200;
+
 template<int dim, typename Number>
 Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
                             std::shared_ptr<ApplicationBase<dim, Number>> app,
                             bool const                                    is_test)
   : mpi_comm(comm),
+    mpi_comm_group(comm),
+    n_processes_fluid(dealii::Utilities::MPI::n_mpi_processes(comm)),
+    is_fluid_process(true),
+    is_acoustic_process(true),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
     is_test(is_test),
     application(app),
@@ -42,6 +54,13 @@ Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
   print_general_info<Number>(pcout, mpi_comm, is_test);
 }
 
+template<int dim, typename Number>
+Driver<dim, Number>::~Driver()
+{
+  if(mpi_comm_group != mpi_comm)
+    MPI_Comm_free(&mpi_comm_group);
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::setup()
@@ -51,11 +70,18 @@ Driver<dim, Number>::setup()
 
   pcout << std::endl << "Setting up aero-acoustic solver:" << std::endl;
 
+  application->setup_parameters();
+
+  setup_process_groups();
+
   // setup acoustic solver
   {
     dealii::Timer timer_local;
 
-    acoustic->setup(application->acoustic, mpi_comm, is_test);
+    if(is_acoustic_process)
+      acoustic->setup(application->acoustic, mpi_comm_group, is_test);
+    else
+      application->acoustic->setup_parameters();
 
     timer_tree.insert({"AeroAcoustic", "Setup", "Acoustic"}, timer_local.wall_time());
   }
@@ -64,7 +90,10 @@ Driver<dim, Number>::setup()
   {
     dealii::Timer timer_local;
 
-    fluid->setup(application->fluid, mpi_comm, is_test);
+    if(is_fluid_process)
+      fluid->setup(application->fluid, mpi_comm_group, is_test);
+    else
+      application->fluid->setup_parameters();
 
     timer_tree.insert({"AeroAcoustic", "Setup", "Fluid"}, timer_local.wall_time());
   }
@@ -77,6 +106,43 @@ Driver<dim, Number>::setup()
   timer_tree.insert({"AeroAcoustic", "Setup"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_process_groups()
+{
+  if(application->parameters.concurrent_execution)
+  {
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    AssertThrow(n_processes > 1,
+                dealii::ExcMessage(
+                  "Concurrent execution of fluid and acoustic solvers requires two processes."));
+
+    // both groups contain at least one process
+    n_processes_fluid = std::clamp(static_cast<unsigned int>(std::round(
+                                     application->parameters.fraction_of_processes_fluid *
+                                     static_cast<double>(n_processes))),
+                                   1U,
+                                   n_processes - 1);
+
+    unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    is_fluid_process    = rank < n_processes_fluid;
+    is_acoustic_process = not is_fluid_process;
+
+    MPI_Comm_split(mpi_comm, is_fluid_process ? 0 : 1, rank, &mpi_comm_group);
+
+    if(is_fluid_process)
+      application->fluid->set_mpi_comm(mpi_comm_group);
+    else
+      application->acoustic->set_mpi_comm(mpi_comm_group);
+
+    pcout << std::endl << "Fluid and acoustic solvers run concurrently:" << std::endl << std::endl;
+    print_parameter(pcout, "Number of processes fluid", n_processes_fluid);
+    print_parameter(pcout, "Number of processes acoustic", n_processes - n_processes_fluid);
+  }
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::setup_volume_coupling()
@@ -97,7 +163,22 @@ Driver<dim, Number>::setup_volume_coupling()
           "Computing source term from analytical solution requires IncNS::TemporalDiscretization::InterpolateAnalyticalSolution"));
     }
 
-    volume_coupling.setup(application->parameters, acoustic, fluid, application->field_functions);
+    if(application->parameters.concurrent_execution)
+    {
+      volume_coupling.setup_concurrent(application->parameters,
+                                       acoustic,
+                                       fluid,
+                                       application->field_functions,
+                                       mpi_comm,
+                                       n_processes_fluid);
+    }
+    else
+    {
+      volume_coupling.setup(application->parameters,
+                            acoustic,
+                            fluid,
+                            application->field_functions);
+    }
 
     pcout << std::endl << "... done!" << std::endl;
 
@@ -110,11 +191,21 @@ template<int dim, typename Number>
 void
 Driver<dim, Number>::set_start_time() const
 {
-  AssertThrow(fluid->time_integrator->get_time() - 1e-12 < acoustic->time_integrator->get_time(),
-              dealii::ExcMessage(
-                "Acoustic simulation can not be started before fluid simulation."));
+  // in case of concurrent execution, the fluid time is only known on the fluid processes
+  double const fluid_time =
+    application->parameters.concurrent_execution ?
+      dealii::Utilities::MPI::broadcast(
+        mpi_comm, is_fluid_process ? fluid->time_integrator->get_time() : 0.0, 0) :
+      fluid->time_integrator->get_time();
+
+  if(is_acoustic_process)
+  {
+    AssertThrow(fluid_time - 1e-12 < acoustic->time_integrator->get_time(),
+                dealii::ExcMessage(
+                  "Acoustic simulation can not be started before fluid simulation."));
 
-  acoustic->time_integrator->reset_time(fluid->time_integrator->get_time());
+    acoustic->time_integrator->reset_time(fluid_time);
+  }
 }
 
 template<int dim, typename Number>
@@ -124,7 +215,17 @@ Driver<dim, Number>::couple_fluid_to_acoustic()
   dealii::Timer sub_timer;
   sub_timer.restart();
 
-  volume_coupling.fluid_to_acoustic();
+  if(application->parameters.concurrent_execution)
+  {
+    if(is_fluid_process)
+      volume_coupling.send_fluid_to_acoustic();
+    else
+      volume_coupling.receive_fluid_to_acoustic();
+  }
+  else
+  {
+    volume_coupling.fluid_to_acoustic();
+  }
 
   timer_tree.insert({"AeroAcoustic", "Coupling fluid -> acoustic"}, sub_timer.wall_time());
 }
@@ -133,14 +234,24 @@ template<int dim, typename Number>
 void
 Driver<dim, Number>::solve()
 {
-  std::pair<bool, dealii::Timer> timer = std::make_pair(false, dealii::Timer());
-
   set_start_time();
 
   AssertThrow(std::abs(application->fluid->get_parameters().end_time -
                        application->acoustic->get_parameters().end_time) < 1.0e-12,
               dealii::ExcMessage("Acoustic and fluid simulation need the same end time."));
 
+  if(application->parameters.concurrent_execution)
+  {
+    if(is_fluid_process)
+      solve_fluid_concurrently();
+    else
+      solve_acoustic_concurrently();
+
+    return;
+  }
+
+  std::pair<bool, dealii::Timer> timer = std::make_pair(false, dealii::Timer());
+
   while(not fluid->time_integrator->finished())
   {
     if(timer.first == false and acoustic->time_integrator->started())
@@ -179,10 +290,138 @@ Driver<dim, Number>::solve()
   time_solvers_side_by_side = timer.second.wall_time();
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_fluid_concurrently()
+{
+  std::pair<bool, dealii::Timer> timer = std::make_pair(false, dealii::Timer());
+
+  while(not fluid->time_integrator->finished())
+  {
+    bool const acoustic_starts_during_present_timestep =
+      fluid->time_integrator->get_next_time() + fluid->time_integrator->get_time_step_size() >
+      application->acoustic->get_parameters().start_time;
+
+    if(timer.first == false and acoustic_starts_during_present_timestep)
+    {
+      timer.first = true;
+      timer.second.restart();
+    }
+
+    // The acoustic processes advance from t^n to t^(n+1) using the source term at t^n, while the
+    // fluid processes already compute the fluid solution at t^(n+1). The source term is sent
+    // asynchronously, so the fluid processes only wait for the acoustic processes in case the
+    // previous source term has not been received yet.
+    send_macro_time_step(true,
+                         acoustic_starts_during_present_timestep,
+                         fluid->time_integrator->get_time_step_size());
+
+    if(acoustic_starts_during_present_timestep)
+      couple_fluid_to_acoustic();
+
+    bool const acoustic_might_start_during_next_timestep =
+      fluid->time_integrator->get_next_time() + fluid->max_next_time_step_size() >
+      application->acoustic->get_parameters().start_time;
+
+    fluid->advance_one_timestep_and_compute_pressure_time_derivative(
+      acoustic_might_start_during_next_timestep);
+  }
+
+  // tell the acoustic processes to stop
+  send_macro_time_step(false, false, 0.0);
+
+  volume_coupling.wait_for_send_fluid_to_acoustic();
+
+  time_solvers_side_by_side = timer.second.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_acoustic_concurrently()
+{
+  std::pair<bool, dealii::Timer> timer = std::make_pair(false, dealii::Timer());
+
+  bool   proceed        = true;
+  bool   couple         = false;
+  double time_step_size = 0.0;
+
+  receive_macro_time_step(proceed, couple, time_step_size);
+
+  while(proceed)
+  {
+    if(timer.first == false and couple)
+    {
+      timer.first = true;
+      timer.second.restart();
+    }
+
+    if(couple)
+      couple_fluid_to_acoustic();
+
+    acoustic->advance_multiple_timesteps(time_step_size);
+
+    receive_macro_time_step(proceed, couple, time_step_size);
+  }
+
+  time_solvers_side_by_side = timer.second.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::send_macro_time_step(bool const   proceed,
+                                          bool const   couple,
+                                          double const time_step_size) const
+{
+  // the first fluid process sends to the first acoustic process
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::array<double, 3> const data = {{proceed ? 1.0 : 0.0, couple ? 1.0 : 0.0, time_step_size}};
+
+    MPI_Send(data.data(),
+             data.size(),
+             MPI_DOUBLE,
+             n_processes_fluid,
+             mpi_tag_macro_time_step,
+             mpi_comm);
+  }
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::receive_macro_time_step(bool &   proceed,
+                                             bool &   couple,
+                                             double & time_step_size) const
+{
+  std::array<double, 3> data = {{0.0, 0.0, 0.0}};
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == n_processes_fluid)
+  {
+    MPI_Recv(data.data(),
+             data.size(),
+             MPI_DOUBLE,
+             0 /* first fluid process */,
+             mpi_tag_macro_time_step,
+             mpi_comm,
+             MPI_STATUS_IGNORE);
+  }
+
+  MPI_Bcast(data.data(), data.size(), MPI_DOUBLE, 0, mpi_comm_group);
+
+  proceed        = data[0] > 0.5;
+  couple         = data[1] > 0.5;
+  time_step_size = data[2];
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::print_performance_results(double const total_time) const
 {
+  if(application->parameters.concurrent_execution)
+  {
+    print_performance_results_concurrent(total_time);
+    return;
+  }
+
   pcout << std::endl << print_horizontal_line() << std::endl << std::endl;
 
   pcout << "Performance results for aero-acoustic solver:" << std::endl;
@@ -248,6 +487,116 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << print_horizontal_line() << std::endl << std::endl;
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::print_performance_results_concurrent(double const total_time) const
+{
+  pcout << std::endl << print_horizontal_line() << std::endl << std::endl;
+
+  pcout << "Performance results for aero-acoustic solver (concurrent execution):" << std::endl;
+
+  // the statistics of the acoustic solver are only known on the acoustic processes
+  unsigned int const root_acoustic = n_processes_fluid;
+
+  double const sub_dt_per_macro_dt = dealii::Utilities::MPI::broadcast(
+    mpi_comm,
+    is_acoustic_process ? acoustic->get_average_number_of_sub_time_steps() : 0.0,
+    root_acoustic);
+  unsigned int const n_macro_time_steps = dealii::Utilities::MPI::broadcast(
+    mpi_comm, is_acoustic_process ? acoustic->get_number_of_macro_time_steps() : 0U, root_acoustic);
+  unsigned int const n_sub_time_steps = dealii::Utilities::MPI::broadcast(
+    mpi_comm, is_acoustic_process ? acoustic->get_number_of_sub_time_steps() : 0U, root_acoustic);
+
+  dealii::types::global_dof_index const DoFs_f = dealii::Utilities::MPI::broadcast(
+    mpi_comm,
+    is_fluid_process ? fluid->pde_operator->get_number_of_dofs() :
+                       dealii::types::global_dof_index(0),
+    0);
+  dealii::types::global_dof_index const DoFs_a = dealii::Utilities::MPI::broadcast(
+    mpi_comm,
+    is_acoustic_process ? acoustic->pde_operator->get_number_of_dofs() :
+                          dealii::types::global_dof_index(0),
+    root_acoustic);
+
+  unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // iterations
+  pcout << std::endl << "Average number of iterations Fluid:" << std::endl;
+  if(is_fluid_process)
+    fluid->time_integrator->print_iterations();
+
+  pcout << std::endl << "Average number of sub-time steps Acoustic:" << std::endl;
+  pcout << "Adams-Bashforth-Moulton    " << sub_dt_per_macro_dt << std::endl;
+
+  // load balance between the process groups
+  pcout << std::endl << "Load balance of process groups:" << std::endl << std::endl;
+  print_parameter(pcout, "DoFs per process fluid", (double)DoFs_f / (double)n_processes_fluid);
+  print_parameter(pcout,
+                  "DoFs per process acoustic",
+                  (double)DoFs_a / (double)(N_mpi_processes - n_processes_fluid));
+
+  // wall times, printed by the first process of each group
+  timer_tree.insert({"AeroAcoustic"}, total_time);
+
+  if(is_fluid_process)
+    timer_tree.insert({"AeroAcoustic"}, fluid->time_integrator->get_timings(), "Fluid");
+  else
+    timer_tree.insert({"AeroAcoustic"}, acoustic->time_integrator->get_timings(), "Acoustic");
+
+  dealii::ConditionalOStream pcout_group(std::cout,
+                                         dealii::Utilities::MPI::this_mpi_process(mpi_comm_group) ==
+                                           0);
+
+  for(bool const print_fluid_group : {true, false})
+  {
+    MPI_Barrier(mpi_comm);
+
+    if(print_fluid_group == is_fluid_process)
+    {
+      pcout_group << std::endl
+                  << "Wall times " << (is_fluid_process ? "fluid" : "acoustic")
+                  << " processes:" << std::endl;
+
+      pcout_group << std::endl << "Timings for level 1:" << std::endl;
+      timer_tree.print_level(pcout_group, 1);
+
+      pcout_group << std::endl << "Timings for level 2:" << std::endl;
+      timer_tree.print_level(pcout_group, 2);
+    }
+  }
+
+  MPI_Barrier(mpi_comm);
+
+  // Throughput in DoFs/s per time step per core (during the time both
+  // solvers ran side by side)
+  dealii::Utilities::MPI::MinMaxAvg time_solvers_side_by_side_data =
+    dealii::Utilities::MPI::min_max_avg(time_solvers_side_by_side, mpi_comm);
+  double const time_solvers_side_by_side_avg = time_solvers_side_by_side_data.avg;
+
+  pcout << std::endl << "Throughput related to one macro time step:";
+  print_throughput_unsteady(pcout,
+                            DoFs_f + DoFs_a,
+                            time_solvers_side_by_side_avg,
+                            n_macro_time_steps,
+                            N_mpi_processes);
+
+  pcout << std::endl << "Throughput related to one sub time step:";
+  print_throughput_unsteady(pcout,
+                            (double)DoFs_f / sub_dt_per_macro_dt + (double)DoFs_a,
+                            time_solvers_side_by_side_avg,
+                            n_sub_time_steps,
+                            N_mpi_processes);
+
+  // computational costs in CPUh
+  dealii::Utilities::MPI::MinMaxAvg total_time_data =
+    dealii::Utilities::MPI::min_max_avg(total_time, mpi_comm);
+  double const total_time_avg = total_time_data.avg;
+
+  print_costs(pcout, total_time_avg, N_mpi_processes);
+
+  pcout << print_horizontal_line() << std::endl << std::endl;
+}
+
 template class Driver<2, float>;
 template class Driver<3, float>;
 
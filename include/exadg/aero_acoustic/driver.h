@@ -43,6 +43,8 @@ public:
          std::shared_ptr<ApplicationBase<dim, Number>> application,
          bool const                                    is_test);
 
+  ~Driver();
+
   void
   setup();
 
@@ -53,6 +55,9 @@ public:
   print_performance_results(double const total_time) const;
 
 private:
+  void
+  setup_process_groups();
+
   void
   setup_volume_coupling();
 
@@ -62,8 +67,36 @@ private:
   void
   couple_fluid_to_acoustic();
 
+  // concurrent execution of fluid and acoustic solvers on disjoint groups of processes
+  void
+  solve_fluid_concurrently();
+
+  void
+  solve_acoustic_concurrently();
+
+  void
+  send_macro_time_step(bool const   proceed,
+                       bool const   couple,
+                       double const time_step_size) const;
+
+  void
+  receive_macro_time_step(bool & proceed, bool & couple, double & time_step_size) const;
+
+  void
+  print_performance_results_concurrent(double const total_time) const;
+
   MPI_Comm const mpi_comm;
 
+  // In case of concurrent execution, the processes [0, n_processes_fluid) of mpi_comm run the fluid
+  // solver and the remaining processes run the acoustic solver. mpi_comm_group is the communicator
+  // of the group of the present process. Otherwise, all processes run both solvers.
+  MPI_Comm mpi_comm_group;
+
+  unsigned int n_processes_fluid;
+
+  bool is_fluid_process;
+  bool is_acoustic_process;
+
   dealii::ConditionalOStream pcout;
 
   bool const is_test;
@@ -0,0 +1,338 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_AERO_ACOUSTIC_TRANSFER_BETWEEN_PROCESS_GROUPS_H_
+#define EXADG_AERO_ACOUSTIC_TRANSFER_BETWEEN_PROCESS_GROUPS_H_
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+namespace AeroAcoustic
+{
+/**
+ * A class that transfers a dual vector, i.e., an integrated right-hand side, from a source
+ * DoFHandler to a destination DoFHandler, where both DoFHandlers live on disjoint groups of
+ * processes. The transfer is the transpose of the interpolation of the destination field in the
+ * support points of the source DoFHandler, i.e., it is equivalent to restrict_and_add() of
+ * dealii::MGTwoLevelTransferNonNested with the source DoFHandler as fine and the destination
+ * DoFHandler as coarse DoFHandler.
+ *
+ * The processes [0, n_processes_source) of the communicator passed to reinit_source() and
+ * reinit_destination() form the source group, the remaining processes form the destination group.
+ * Each source process sends its data to exactly one destination process. The destination group
+ * then locates the points in its triangulation via dealii::Utilities::MPI::RemotePointEvaluation
+ * and sums the contributions into the owning cells. Sending is non-blocking, so that the source
+ * group can continue with its work while the destination group processes the data.
+ */
+template<int dim, typename Number>
+class TransferBetweenProcessGroups
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+public:
+  TransferBetweenProcessGroups()
+    : mpi_comm(MPI_COMM_NULL),
+      n_processes_source(0),
+      send_request(MPI_REQUEST_NULL),
+      rpe(typename dealii::Utilities::MPI::RemotePointEvaluation<dim>::AdditionalData(
+        1.e-6,
+        true /* enforce unique mapping to avoid duplicate contributions */,
+        0))
+  {
+  }
+
+  /**
+   * Setup on the processes of the source group. Has to be called at the same time as
+   * reinit_destination() is called on the processes of the destination group.
+   */
+  void
+  reinit_source(MPI_Comm const &                comm,
+                unsigned int const              n_processes_source_in,
+                dealii::DoFHandler<dim> const & dof_handler,
+                dealii::Mapping<dim> const &    mapping)
+  {
+    mpi_comm           = comm;
+    n_processes_source = n_processes_source_in;
+
+    unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    AssertThrow(rank < n_processes_source,
+                dealii::ExcMessage("This process does not belong to the source group."));
+
+    dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+    AssertThrow(fe.n_components() == 1 and fe.has_support_points(),
+                dealii::ExcMessage("The source finite element has to be a scalar finite element "
+                                   "with support points."));
+
+    // collect the support points of all locally owned DoFs
+    dealii::FEValues<dim> fe_values(mapping,
+                                    fe,
+                                    dealii::Quadrature<dim>(fe.get_unit_support_points()),
+                                    dealii::update_quadrature_points);
+
+    dealii::IndexSet const & locally_owned_dofs = dof_handler.locally_owned_dofs();
+
+    std::vector<dealii::types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+    std::vector<double>                          points;
+
+    local_dof_indices.clear();
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+      {
+        fe_values.reinit(cell);
+        cell->get_dof_indices(dof_indices);
+
+        for(unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+        {
+          if(locally_owned_dofs.is_element(dof_indices[i]))
+          {
+            local_dof_indices.push_back(locally_owned_dofs.index_within_set(dof_indices[i]));
+
+            dealii::Point<dim> const & point = fe_values.quadrature_point(i);
+            for(unsigned int d = 0; d < dim; ++d)
+              points.push_back(point[d]);
+          }
+        }
+      }
+    }
+
+    MPI_Send(points.data(), points.size(), MPI_DOUBLE, get_partner(rank), tag_points, mpi_comm);
+  }
+
+  /**
+   * Setup on the processes of the destination group. Has to be called at the same time as
+   * reinit_source() is called on the processes of the source group.
+   */
+  void
+  reinit_destination(MPI_Comm const &                comm,
+                     unsigned int const              n_processes_source_in,
+                     dealii::DoFHandler<dim> const & dof_handler,
+                     dealii::Mapping<dim> const &    mapping)
+  {
+    mpi_comm           = comm;
+    n_processes_source = n_processes_source_in;
+    dof_handler_dst    = &dof_handler;
+
+    unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    AssertThrow(rank >= n_processes_source,
+                dealii::ExcMessage("This process does not belong to the destination group."));
+
+    // receive the points of all source processes sending to this process
+    sources.clear();
+    offsets.assign(1, 0);
+    std::vector<double> points;
+    for(unsigned int source = 0; source < n_processes_source; ++source)
+    {
+      if(get_partner(source) == rank)
+      {
+        MPI_Status status;
+        MPI_Probe(source, tag_points, mpi_comm, &status);
+
+        int count = 0;
+        MPI_Get_count(&status, MPI_DOUBLE, &count);
+
+        points.resize(points.size() + count);
+        MPI_Recv(points.data() + points.size() - count,
+                 count,
+                 MPI_DOUBLE,
+                 source,
+                 tag_points,
+                 mpi_comm,
+                 MPI_STATUS_IGNORE);
+
+        sources.push_back(source);
+        offsets.push_back(offsets.back() + count / dim);
+      }
+    }
+
+    std::vector<dealii::Point<dim>> received_points(points.size() / dim);
+    for(unsigned int i = 0; i < received_points.size(); ++i)
+      for(unsigned int d = 0; d < dim; ++d)
+        received_points[i][d] = points[i * dim + d];
+
+    // Points that do not lie inside the destination triangulation do not contribute, as for the
+    // non-nested transfer.
+    rpe.reinit(received_points, dof_handler.get_triangulation(), mapping);
+
+    // The points do not change between transfers. Hence, the DoF indices of the cells found and
+    // the shape values in the points are computed once. The shape values are stored point by point
+    // in the order of the cells of rpe.get_cell_data().
+    dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+    std::vector<dealii::types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+
+    auto const & cell_data = rpe.get_cell_data();
+
+    cell_dof_indices.clear();
+    shape_values.clear();
+    for(auto const cell_index : cell_data.cell_indices())
+    {
+      auto const cell =
+        cell_data.get_active_cell_iterator(cell_index)->as_dof_handler_iterator(dof_handler);
+      cell->get_dof_indices(dof_indices);
+      cell_dof_indices.insert(cell_dof_indices.end(), dof_indices.begin(), dof_indices.end());
+
+      for(auto const & unit_point : cell_data.get_unit_points(cell_index))
+        for(unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+          shape_values.push_back(fe.shape_value(i, unit_point));
+    }
+  }
+
+  /**
+   * Starts sending the vector src. Called on the processes of the source group.
+   */
+  void
+  start_send(VectorType const & src)
+  {
+    // the send buffer might still be in use
+    wait_for_send();
+
+    send_buffer.resize(local_dof_indices.size());
+    for(unsigned int i = 0; i < local_dof_indices.size(); ++i)
+      send_buffer[i] = src.local_element(local_dof_indices[i]);
+
+    unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    MPI_Isend(send_buffer.data(),
+              send_buffer.size(),
+              MPI_DOUBLE,
+              get_partner(rank),
+              tag_values,
+              mpi_comm,
+              &send_request);
+  }
+
+  /**
+   * Waits until the data sent by start_send() is no longer needed. Called on the processes of the
+   * source group.
+   */
+  void
+  wait_for_send()
+  {
+    MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+  }
+
+  /**
+   * Receives the data sent by start_send() and adds the transferred vector to dst. Called on the
+   * processes of the destination group.
+   */
+  void
+  receive_and_add(VectorType & dst)
+  {
+    recv_buffer.resize(offsets.back());
+
+    std::vector<MPI_Request> requests(sources.size());
+    for(unsigned int i = 0; i < sources.size(); ++i)
+    {
+      MPI_Irecv(recv_buffer.data() + offsets[i],
+                offsets[i + 1] - offsets[i],
+                MPI_DOUBLE,
+                sources[i],
+                tag_values,
+                mpi_comm,
+                &requests[i]);
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    unsigned int const dofs_per_cell = dof_handler_dst->get_fe().n_dofs_per_cell();
+
+    auto const add_cell_contributions =
+      [&](dealii::ArrayView<double const> const &                                  values,
+          typename dealii::Utilities::MPI::RemotePointEvaluation<dim>::CellData const & cell_data) {
+        double const * shape_values_point = shape_values.data();
+        for(auto const cell_index : cell_data.cell_indices())
+        {
+          dealii::types::global_dof_index const * dof_indices =
+            cell_dof_indices.data() + cell_index * dofs_per_cell;
+
+          auto const cell_values = cell_data.get_data_view(cell_index, values);
+
+          for(unsigned int q = 0; q < cell_values.size(); ++q, shape_values_point += dofs_per_cell)
+            for(unsigned int i = 0; i < dofs_per_cell; ++i)
+              dst(dof_indices[i]) += shape_values_point[i] * cell_values[q];
+        }
+      };
+
+    rpe.template process_and_evaluate<double>(recv_buffer, rpe_buffer, add_cell_contributions);
+
+    // contributions to DoFs owned by neighboring processes
+    dst.compress(dealii::VectorOperation::add);
+  }
+
+private:
+  // each source process sends to one destination process, distributing the source processes
+  // evenly among the destination processes
+  unsigned int
+  get_partner(unsigned int const source) const
+  {
+    unsigned int const n_processes_destination =
+      dealii::Utilities::MPI::n_mpi_processes(mpi_comm) - n_processes_source;
+
+    return n_processes_source + (static_cast<unsigned long long>(source) *
+                                 n_processes_destination) /
+                                  n_processes_source;
+  }
+
+  static int const tag_points = 4201;
+  static int const tag_values = 4202;
+
+  MPI_Comm mpi_comm;
+
+  unsigned int n_processes_source;
+
+  // source group: local indices of the DoFs in the sequence in which they are sent
+  std::vector<unsigned int> local_dof_indices;
+
+  std::vector<double> send_buffer;
+
+  MPI_Request send_request;
+
+  // destination group: source processes and offsets of their data in the receive buffer
+  std::vector<unsigned int> sources;
+  std::vector<unsigned int> offsets;
+
+  std::vector<double> recv_buffer;
+  std::vector<double> rpe_buffer;
+
+  dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler_dst;
+
+  // destination group: DoF indices of the cells containing points and shape values in the points,
+  // see reinit_destination()
+  std::vector<dealii::types::global_dof_index> cell_dof_indices;
+  std::vector<double>                          shape_values;
+
+  dealii::Utilities::MPI::RemotePointEvaluation<dim> rpe;
+};
+
+} // namespace AeroAcoustic
+} // namespace ExaDG
+
+#endif /* EXADG_AERO_ACOUSTIC_TRANSFER_BETWEEN_PROCESS_GROUPS_H_ */
@@ -77,8 +77,24 @@ public:
     prm.parse_input(parameter_file, "", true, true);
   }
 
+  /**
+   * Restricts the application to a subset of the processes, e.g., in case the fluid and the
+   * acoustic solver run concurrently on disjoint groups of processes. Has to be called before
+   * setup().
+   */
   void
-  setup(std::shared_ptr<Grid<dim>> & grid, std::shared_ptr<dealii::Mapping<dim>> & mapping)
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
+  /**
+   * Sets up the parameters only. This is sufficient on processes that do not run the acoustic
+   * solver but need to know its parameters.
+   */
+  void
+  setup_parameters()
   {
     parse_parameters();
 
@@ -95,6 +111,12 @@ public:
     AssertThrow(param.aero_acoustic_source_term,
                 dealii::ExcMessage(
                   "aero_acoustic_source_term has to be set true for aero-acoustic computations."));
+  }
+
+  void
+  setup(std::shared_ptr<Grid<dim>> & grid, std::shared_ptr<dealii::Mapping<dim>> & mapping)
+  {
+    setup_parameters();
 
     param.print(pcout, "List of parameters for acoustic conservation equations:");
 
@@ -135,7 +157,7 @@ public:
   create_postprocessor() = 0;
 
 protected:
-  MPI_Comm const mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
@@ -203,10 +225,24 @@ public:
     prm.parse_input(parameter_file, "", true, true);
   }
 
+  /**
+   * Restricts the application to a subset of the processes, e.g., in case the fluid and the
+   * acoustic solver run concurrently on disjoint groups of processes. Has to be called before
+   * setup().
+   */
   void
-  setup(std::shared_ptr<Grid<dim>> &                      grid,
-        std::shared_ptr<dealii::Mapping<dim>> &           mapping,
-        std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings)
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
+  /**
+   * Sets up the parameters only. This is sufficient on processes that do not run the fluid solver
+   * but need to know its parameters.
+   */
+  void
+  setup_parameters()
   {
     parse_parameters();
 
@@ -215,13 +251,22 @@ public:
     // parameters
     set_parameters();
     param.check(pcout);
-    param.print(pcout, "List of parameters for incompressible flow solver:");
 
     // Some AeroAcoustic specific Asserts
     AssertThrow(param.problem_type == IncNS::ProblemType::Unsteady,
                 dealii::ExcMessage("Invalid parameter in context of aero-acoustic."));
     AssertThrow(param.ale_formulation == false,
                 dealii::ExcMessage("ALE not yet implemented for aero-acoustic."));
+  }
+
+  void
+  setup(std::shared_ptr<Grid<dim>> &                      grid,
+        std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+        std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings)
+  {
+    setup_parameters();
+
+    param.print(pcout, "List of parameters for incompressible flow solver:");
 
     // grid
     grid = std::make_shared<Grid<dim>>();
@@ -260,7 +305,7 @@ public:
   create_postprocessor() = 0;
 
 protected:
-  MPI_Comm const mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
@@ -315,13 +360,25 @@ public:
 
   virtual ~ApplicationBase() = default;
 
+  /**
+   * The parameters of the aero-acoustic solver are needed before the single field solvers are set
+   * up, e.g., to decide whether both solvers run concurrently on disjoint groups of processes.
+   */
   void
-  setup()
+  setup_parameters()
   {
     parse_parameters();
     parameters.check();
     parameters.print(pcout, "List of parameters for aero-acoustic solver");
+  }
 
+  /**
+   * Requires that setup_parameters() has been called and that the parameters of the single field
+   * applications have been set up.
+   */
+  void
+  setup()
+  {
     // field functions
     field_functions = std::make_shared<FieldFunctions<dim>>();
     set_field_functions();
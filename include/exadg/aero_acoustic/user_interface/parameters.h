@@ -59,7 +59,9 @@ public:
       source_term_with_convection(false),
       blend_in_source_term(false),
       fluid_to_acoustic_coupling_strategy(FluidToAcousticCouplingStrategy::Undefined),
-      acoustic_source_term_computation(AcousticSourceTermComputation::Undefined)
+      acoustic_source_term_computation(AcousticSourceTermComputation::Undefined),
+      concurrent_execution(false),
+      fraction_of_processes_fluid(0.5)
   {
   }
 
@@ -73,6 +75,12 @@ public:
 
     AssertThrow(acoustic_source_term_computation != AcousticSourceTermComputation::Undefined,
                 dealii::ExcMessage("Source term computation has to be set."));
+
+    if(concurrent_execution)
+    {
+      AssertThrow(fraction_of_processes_fluid > 0.0 and fraction_of_processes_fluid < 1.0,
+                  dealii::ExcMessage("Fraction of processes for the fluid has to be in (0,1)."));
+    }
   }
 
   void
@@ -84,6 +92,9 @@ public:
     print_parameter(pcout, "Blend in source term", blend_in_source_term);
     print_parameter(pcout, "Fluid to acoustic coupling", fluid_to_acoustic_coupling_strategy);
     print_parameter(pcout, "Acoustic source term compuation", acoustic_source_term_computation);
+    print_parameter(pcout, "Concurrent execution", concurrent_execution);
+    if(concurrent_execution)
+      print_parameter(pcout, "Fraction of processes fluid", fraction_of_processes_fluid);
   }
 
   void
@@ -117,6 +128,18 @@ public:
                         "How to compute the acustic source term.",
                         Patterns::Enum<AcousticSourceTermComputation>(),
                         true);
+
+      prm.add_parameter("ConcurrentExecution",
+                        concurrent_execution,
+                        "Run fluid and acoustic solvers concurrently on disjoint processes.",
+                        dealii::Patterns::Bool(),
+                        false);
+
+      prm.add_parameter("FractionOfProcessesFluid",
+                        fraction_of_processes_fluid,
+                        "Fraction of processes running the fluid solver in concurrent execution.",
+                        dealii::Patterns::Double(0.0, 1.0),
+                        false);
     }
     prm.leave_subsection();
   }
@@ -137,6 +160,17 @@ public:
 
   // How to compute the acustic source term
   AcousticSourceTermComputation acoustic_source_term_computation;
+
+  // Run the fluid and the acoustic solver concurrently on disjoint groups of processes instead of
+  // running them one after the other on all processes. The acoustic solver receives the source
+  // term asynchronously from the fluid solver, so that the acoustic solver advances from t_n to
+  // t_{n+1} while the fluid solver computes the next time step.
+  bool concurrent_execution;
+
+  // Fraction of the processes running the fluid solver in case of concurrent execution. The
+  // remaining processes run the acoustic solver. For a balanced load, this fraction should be
+  // chosen according to the number of DoFs (and the costs per DoF) of both solvers.
+  double fraction_of_processes_fluid;
 };
 
 } // namespace AeroAcoustic
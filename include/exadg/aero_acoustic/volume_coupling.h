@@ -26,6 +26,7 @@
 #include <exadg/aero_acoustic/calculators/source_term_calculator.h>
 #include <exadg/aero_acoustic/single_field_solvers/acoustics.h>
 #include <exadg/aero_acoustic/single_field_solvers/fluid.h>
+#include <exadg/aero_acoustic/transfer_between_process_groups.h>
 #include <exadg/aero_acoustic/user_interface/parameters.h>
 
 namespace ExaDG
@@ -69,17 +70,53 @@ public:
       AssertThrow(false, dealii::ExcMessage("FluidToAcousticCouplingStrategy not implemented."));
     }
 
-    // setup aeroacoustic source term calculator
-    SourceTermCalculatorData<dim> data;
-    data.dof_index_pressure  = fluid_solver_in->pde_operator->get_dof_index_pressure();
-    data.dof_index_velocity  = fluid_solver_in->pde_operator->get_dof_index_velocity();
-    data.quad_index          = fluid_solver_in->pde_operator->get_quad_index_pressure();
-    data.density             = parameters_in.density;
-    data.consider_convection = parameters_in.source_term_with_convection;
-    data.blend_in            = parameters.blend_in_source_term;
-    data.blend_in_function   = field_functions_in->source_term_blend_in;
+    setup_source_term_calculator();
+  }
+
+  /**
+   * Setup in case the fluid and the acoustic solver run concurrently on disjoint groups of
+   * processes. The processes [0, n_processes_fluid) of mpi_comm run the fluid solver, the remaining
+   * processes run the acoustic solver. Only the single field solver of the own process group has
+   * to be set up.
+   */
+  void
+  setup_concurrent(Parameters const &                           parameters_in,
+                   std::shared_ptr<SolverAcoustic<dim, Number>> acoustic_solver_in,
+                   std::shared_ptr<SolverFluid<dim, Number>>    fluid_solver_in,
+                   std::shared_ptr<FieldFunctions<dim>>         field_functions_in,
+                   MPI_Comm const &                             mpi_comm,
+                   unsigned int const                           n_processes_fluid)
+  {
+    parameters      = parameters_in;
+    acoustic_solver = acoustic_solver_in;
+    fluid_solver    = fluid_solver_in;
+    field_functions = field_functions_in;
+
+    AssertThrow(parameters.fluid_to_acoustic_coupling_strategy ==
+                  FluidToAcousticCouplingStrategy::ConservativeInterpolation,
+                dealii::ExcMessage("FluidToAcousticCouplingStrategy not implemented."));
+
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) < n_processes_fluid)
+    {
+      fluid_solver->pde_operator->initialize_vector_pressure(source_term_fluid);
+
+      transfer_between_process_groups.reinit_source(mpi_comm,
+                                                    n_processes_fluid,
+                                                    fluid_solver->pde_operator->get_dof_handler_p(),
+                                                    *fluid_solver->pde_operator->get_mapping());
 
-    source_term_calculator.setup(fluid_solver_in->pde_operator->get_matrix_free(), data);
+      setup_source_term_calculator();
+    }
+    else
+    {
+      acoustic_solver->pde_operator->initialize_dof_vector_pressure(source_term_acoustic);
+
+      transfer_between_process_groups.reinit_destination(
+        mpi_comm,
+        n_processes_fluid,
+        acoustic_solver->pde_operator->get_dof_handler_p(),
+        *acoustic_solver->pde_operator->get_mapping());
+    }
   }
 
   void
@@ -88,28 +125,9 @@ public:
     if(parameters.fluid_to_acoustic_coupling_strategy ==
        FluidToAcousticCouplingStrategy::ConservativeInterpolation)
     {
-      if(parameters.acoustic_source_term_computation ==
-         AcousticSourceTermComputation::FromAnalyticSourceTerm)
-      {
-        source_term_calculator.evaluate_integrate(
-          source_term_fluid,
-          *field_functions->analytical_aero_acoustic_source_term,
-          fluid_solver->time_integrator->get_time());
-      }
-      else if(parameters.acoustic_source_term_computation ==
-              AcousticSourceTermComputation::FromFluid)
-      {
-        source_term_calculator.evaluate_integrate(source_term_fluid,
-                                                  fluid_solver->time_integrator->get_velocity(),
-                                                  fluid_solver->time_integrator->get_pressure(),
-                                                  fluid_solver->get_pressure_time_derivative(),
-                                                  fluid_solver->time_integrator->get_time());
-      }
-      else
-      {
-        AssertThrow(false, dealii::ExcMessage("AcousticSourceTermComputation not implemented."));
-      }
+      compute_source_term_fluid();
 
+      source_term_acoustic = 0.0;
       non_nested_grid_transfer.restrict_and_add(source_term_acoustic, source_term_fluid);
     }
     else
@@ -120,7 +138,83 @@ public:
     acoustic_solver->pde_operator->set_aero_acoustic_source_term(source_term_acoustic);
   }
 
+  /**
+   * Concurrent execution: computes the source term on the fluid mesh and starts sending it to the
+   * acoustic processes. Called on the fluid processes.
+   */
+  void
+  send_fluid_to_acoustic()
+  {
+    compute_source_term_fluid();
+
+    transfer_between_process_groups.start_send(source_term_fluid);
+  }
+
+  /**
+   * Concurrent execution: waits until the last source term sent is no longer needed. Called on the
+   * fluid processes.
+   */
+  void
+  wait_for_send_fluid_to_acoustic()
+  {
+    transfer_between_process_groups.wait_for_send();
+  }
+
+  /**
+   * Concurrent execution: receives the source term sent by send_fluid_to_acoustic() and passes it
+   * to the acoustic solver. Called on the acoustic processes.
+   */
+  void
+  receive_fluid_to_acoustic()
+  {
+    source_term_acoustic = 0.0;
+    transfer_between_process_groups.receive_and_add(source_term_acoustic);
+
+    acoustic_solver->pde_operator->set_aero_acoustic_source_term(source_term_acoustic);
+  }
+
 private:
+  void
+  setup_source_term_calculator()
+  {
+    SourceTermCalculatorData<dim> data;
+    data.dof_index_pressure  = fluid_solver->pde_operator->get_dof_index_pressure();
+    data.dof_index_velocity  = fluid_solver->pde_operator->get_dof_index_velocity();
+    data.quad_index          = fluid_solver->pde_operator->get_quad_index_pressure();
+    data.density             = parameters.density;
+    data.consider_convection = parameters.source_term_with_convection;
+    data.blend_in            = parameters.blend_in_source_term;
+    data.blend_in_function   = field_functions->source_term_blend_in;
+
+    source_term_calculator.setup(fluid_solver->pde_operator->get_matrix_free(), data);
+  }
+
+  void
+  compute_source_term_fluid()
+  {
+    if(parameters.acoustic_source_term_computation ==
+       AcousticSourceTermComputation::FromAnalyticSourceTerm)
+    {
+      source_term_calculator.evaluate_integrate(
+        source_term_fluid,
+        *field_functions->analytical_aero_acoustic_source_term,
+        fluid_solver->time_integrator->get_time());
+    }
+    else if(parameters.acoustic_source_term_computation ==
+            AcousticSourceTermComputation::FromFluid)
+    {
+      source_term_calculator.evaluate_integrate(source_term_fluid,
+                                                fluid_solver->time_integrator->get_velocity(),
+                                                fluid_solver->time_integrator->get_pressure(),
+                                                fluid_solver->get_pressure_time_derivative(),
+                                                fluid_solver->time_integrator->get_time());
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("AcousticSourceTermComputation not implemented."));
+    }
+  }
+
   Parameters parameters;
 
   // Single field solvers
@@ -137,6 +231,9 @@ private:
   // Transfer operator
   dealii::MGTwoLevelTransferNonNested<dim, VectorType> non_nested_grid_transfer;
 
+  // Transfer operator in case of concurrent execution on disjoint groups of processes
+  TransferBetweenProcessGroups<dim, Number> transfer_between_process_groups;
+
   // Class that knows how to compute the source term
   SourceTermCalculator<dim, Number> source_term_calculator;
 
@@ -43,6 +43,8 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
   mapping     = &mapping_in;
   output_data = output_data_in;
 
+  output_data.check();
+
   time_control.setup(output_data_in.time_control_data);
 
   if(output_data_in.time_control_data.is_active)
@@ -106,7 +108,8 @@ OutputGenerator<dim, Number>::evaluate(
 {
   print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
 
-  VectorWriter<dim, Number> vector_writer(output_data, time_control.get_counter(), mpi_comm);
+  auto vector_writer =
+    std::make_shared<VectorWriter<dim, Number>>(output_data, time_control.get_counter(), mpi_comm);
 
   std::vector<std::string> component_names(dim + 2, "rho_u");
   component_names[0]       = "rho";
@@ -116,16 +119,16 @@ OutputGenerator<dim, Number>::evaluate(
   component_is_part_of_vector[0]       = false;
   component_is_part_of_vector[dim + 1] = false;
 
-  vector_writer.add_data_vector(solution_conserved,
-                                *dof_handler,
-                                component_names,
-                                component_is_part_of_vector);
+  vector_writer->add_data_vector(solution_conserved,
+                                 *dof_handler,
+                                 component_names,
+                                 component_is_part_of_vector);
 
-  vector_writer.add_fields(additional_fields);
+  vector_writer->add_fields(additional_fields);
 
-  vector_writer.write_aspect_ratio(*dof_handler, *mapping);
+  vector_writer->write_aspect_ratio(*dof_handler, *mapping);
 
-  vector_writer.write_pvtu(&(*mapping));
+  write_vector_output(vector_writer, output_data, asynchronous_writer, &(*mapping), time);
 }
 
 
@@ -26,6 +26,7 @@
 #include <fstream>
 
 // ExaDG
+#include <exadg/postprocessor/asynchronous_output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
@@ -112,6 +113,9 @@ private:
   dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::ObserverPointer<dealii::Mapping<dim> const>    mapping;
   OutputData                                             output_data;
+
+  // writes output in the background in case of asynchronous output
+  mutable AsynchronousOutputWriter asynchronous_writer;
 };
 
 } // namespace CompNS
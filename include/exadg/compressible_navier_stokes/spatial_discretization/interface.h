@@ -57,6 +57,10 @@ public:
   virtual double
   calculate_time_step_cfl_global() const = 0;
 
+  // time step calculation: local CFL condition based on the current solution
+  virtual double
+  calculate_time_step_cfl_numerical_solution(VectorType const & solution) const = 0;
+
   // Calculate time step size according to diffusion term
   virtual double
   calculate_time_step_diffusion() const = 0;
@@ -65,6 +69,36 @@ public:
   virtual void
   evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const = 0;
 
+  // local time stepping: number of time step clusters
+  virtual unsigned int
+  get_number_of_time_step_clusters() const = 0;
+
+  // local time stepping: dofs of the cells of each cluster and of their face neighbors
+  virtual void
+  get_time_step_cluster_dofs(
+    std::vector<std::vector<unsigned int>> &              cluster_dofs,
+    std::vector<std::vector<std::vector<unsigned int>>> & neighbor_dofs) const = 0;
+
+  // local time stepping: evaluate operator for the cells of one time step cluster
+  virtual void
+  evaluate_time_step_cluster(VectorType &       dst,
+                             VectorType const & src,
+                             Number const       evaluation_time,
+                             unsigned int const cluster) const = 0;
+
+  // local time stepping: evaluate the faces between one time step cluster and finer clusters
+  virtual void
+  evaluate_time_step_cluster_interface(VectorType &       dst,
+                                       VectorType const & src,
+                                       Number const       evaluation_time,
+                                       unsigned int const cluster) const = 0;
+
+  // local time stepping: apply the inverse mass operator for the cells of one time step cluster
+  virtual void
+  apply_inverse_mass_time_step_cluster(VectorType &       dst,
+                                       VectorType const & src,
+                                       unsigned int const cluster) const = 0;
+
   // analysis of computational costs
   virtual double
   get_wall_time_operator_evaluation() const = 0;
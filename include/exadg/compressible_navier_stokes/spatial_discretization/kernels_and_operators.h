@@ -23,9 +23,11 @@
 #define EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_KERNELS_AND_OPERATORS_H_
 
 // C/C++
+#include <algorithm>
 #include <iostream>
 
 // deal.II
+#include <deal.II/base/polynomial.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -281,6 +283,104 @@ inline DEAL_II_ALWAYS_INLINE //
   return std::max(lambda_m, lambda_p);
 }
 
+/*
+ * Logarithmic mean (a - b) / (log(a) - log(b)) of two positive quantities, evaluated by a series
+ * expansion for a close to b according to Ismail and Roe (2009).
+ */
+template<typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::VectorizedArray<Number>
+  calculate_logarithmic_mean(dealii::VectorizedArray<Number> const & a,
+                             dealii::VectorizedArray<Number> const & b)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  // f^2 with f = (a - b) / (a + b)
+  scalar const f2 = (a * (a - 2.0 * b) + b * b) / (a * (a + 2.0 * b) + b * b);
+
+  scalar const series = (a + b) * 52.5 / (105.0 + f2 * (35.0 + f2 * (21.0 + f2 * 15.0)));
+
+  // avoid division by zero in lanes where the series expansion is used
+  scalar const use_series = dealii::compare_and_apply_mask<dealii::SIMDComparison::less_than>(
+    f2, scalar(1.e-4), scalar(1.0), scalar(0.0));
+  scalar const log_ratio = std::log(b / a) + use_series;
+  scalar const exact     = (b - a + use_series) / log_ratio;
+
+  return dealii::compare_and_apply_mask<dealii::SIMDComparison::less_than>(f2,
+                                                                            scalar(1.e-4),
+                                                                            series,
+                                                                            exact);
+}
+
+/*
+ * Kinetic energy preserving two-point flux according to Pirozzoli (2011) in direction n, where
+ * H denotes the total enthalpy (rho E + p) / rho.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  std::tuple<dealii::VectorizedArray<Number>,
+             dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>,
+             dealii::VectorizedArray<Number>>
+  calculate_two_point_flux_kinetic_energy_preserving(
+    dealii::VectorizedArray<Number> const &                         rho_i,
+    dealii::VectorizedArray<Number> const &                         rho_j,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_i,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_j,
+    dealii::VectorizedArray<Number> const &                         p_i,
+    dealii::VectorizedArray<Number> const &                         p_j,
+    dealii::VectorizedArray<Number> const &                         H_i,
+    dealii::VectorizedArray<Number> const &                         H_j,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & n)
+{
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const u_avg = 0.5 * (u_i + u_j);
+
+  dealii::VectorizedArray<Number> const flux_density = 0.5 * (rho_i + rho_j) * (u_avg * n);
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const flux_momentum =
+    flux_density * u_avg + 0.5 * (p_i + p_j) * n;
+
+  dealii::VectorizedArray<Number> const flux_energy = flux_density * 0.5 * (H_i + H_j);
+
+  return std::make_tuple(flux_density, flux_momentum, flux_energy);
+}
+
+/*
+ * Entropy conserving and kinetic energy preserving two-point flux according to Ranocha (2018) in
+ * direction n.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  std::tuple<dealii::VectorizedArray<Number>,
+             dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>,
+             dealii::VectorizedArray<Number>>
+  calculate_two_point_flux_entropy_conserving(
+    dealii::VectorizedArray<Number> const &                         rho_i,
+    dealii::VectorizedArray<Number> const &                         rho_j,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_i,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_j,
+    dealii::VectorizedArray<Number> const &                         p_i,
+    dealii::VectorizedArray<Number> const &                         p_j,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & n,
+    Number const &                                                  gamma)
+{
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const u_avg = 0.5 * (u_i + u_j);
+
+  dealii::VectorizedArray<Number> const flux_density =
+    calculate_logarithmic_mean(rho_i, rho_j) * (u_avg * n);
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const flux_momentum =
+    flux_density * u_avg + 0.5 * (p_i + p_j) * n;
+
+  dealii::VectorizedArray<Number> const inverse_mean_rho_over_p =
+    1.0 / calculate_logarithmic_mean(rho_i / p_i, rho_j / p_j);
+
+  dealii::VectorizedArray<Number> const flux_energy =
+    flux_density * (0.5 * (u_i * u_j) + inverse_mean_rho_over_p / (gamma - 1.0)) +
+    0.5 * (p_i * (u_j * n) + p_j * (u_i * n));
+
+  return std::make_tuple(flux_density, flux_momentum, flux_energy);
+}
+
 template<int dim>
 struct BodyForceOperatorData
 {
@@ -312,7 +412,8 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  BodyForceOperator() : matrix_free(nullptr), eval_time(0.0)
+  BodyForceOperator()
+    : matrix_free(nullptr), eval_time(0.0), active_category(dealii::numbers::invalid_unsigned_int)
   {
   }
 
@@ -339,6 +440,23 @@ public:
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Restricts the evaluation to the cells of the given cell vectorization category of the
+   * MatrixFree object, e.g., to the cells of one time step cluster for local time stepping.
+   */
+  void
+  evaluate_add_category(VectorType &       dst,
+                        VectorType const & src,
+                        double const       evaluation_time,
+                        unsigned int const category) const
+  {
+    this->active_category = category;
+
+    evaluate_add(dst, src, evaluation_time);
+
+    this->active_category = dealii::numbers::invalid_unsigned_int;
+  }
+
   inline DEAL_II_ALWAYS_INLINE //
     std::tuple<scalar, vector, scalar>
     get_volume_flux(CellIntegratorScalar & density,
@@ -366,6 +484,10 @@ private:
             VectorType const &                            src,
             std::pair<unsigned int, unsigned int> const & cell_range) const
   {
+    if(active_category != dealii::numbers::invalid_unsigned_int and
+       matrix_free.get_cell_range_category(cell_range) != active_category)
+      return;
+
     CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
     CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
     CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
@@ -400,6 +522,9 @@ private:
   BodyForceOperatorData<dim> data;
 
   double mutable eval_time;
+
+  // only cells of this category are evaluated (all cells if invalid)
+  unsigned int mutable active_category;
 };
 
 struct MassOperatorData
@@ -492,7 +617,11 @@ template<int dim>
 struct ConvectiveOperatorData
 {
   ConvectiveOperatorData()
-    : dof_index(0), quad_index(0), heat_capacity_ratio(1.4), specific_gas_constant(287.0)
+    : dof_index(0),
+      quad_index(0),
+      heat_capacity_ratio(1.4),
+      specific_gas_constant(287.0),
+      formulation(ConvectiveTermFormulation::Standard)
   {
   }
 
@@ -503,6 +632,9 @@ struct ConvectiveOperatorData
 
   double heat_capacity_ratio;
   double specific_gas_constant;
+
+  // the split forms require quad_index to refer to the degree+1 Gauss-Lobatto points
+  ConvectiveTermFormulation formulation;
 };
 
 template<int dim, typename Number>
@@ -523,7 +655,7 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  ConvectiveOperator() : matrix_free(nullptr)
+  ConvectiveOperator() : matrix_free(nullptr), n_q_points_1d_split_form(0)
   {
   }
 
@@ -537,6 +669,15 @@ public:
     gamma = data.heat_capacity_ratio;
     R     = data.specific_gas_constant;
     c_v   = R / (gamma - 1.0);
+
+    if(use_split_form())
+      initialize_split_form_derivative();
+  }
+
+  bool
+  use_split_form() const
+  {
+    return data.formulation != ConvectiveTermFormulation::Standard;
   }
 
   void
@@ -583,6 +724,154 @@ public:
     return std::make_tuple(rho_u, momentum_flux, energy_flux);
   }
 
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_two_point_flux(scalar const & rho_i,
+                       scalar const & rho_j,
+                       vector const & u_i,
+                       vector const & u_j,
+                       scalar const & p_i,
+                       scalar const & p_j,
+                       scalar const & H_i,
+                       scalar const & H_j,
+                       vector const & n) const
+  {
+    if(data.formulation == ConvectiveTermFormulation::EntropyConserving)
+      return calculate_two_point_flux_entropy_conserving(
+        rho_i, rho_j, u_i, u_j, p_i, p_j, n, gamma);
+    else
+      return calculate_two_point_flux_kinetic_energy_preserving(
+        rho_i, rho_j, u_i, u_j, p_i, p_j, H_i, H_j, n);
+  }
+
+  /*
+   * Volume term of the split form evaluated by flux differencing along the lines of Gauss-Lobatto
+   * points in each coordinate direction. The integrators have to be evaluated (values) and the
+   * result is submitted as values. The strong form of the flux differencing is combined with the
+   * boundary term of the summation-by-parts property, so that the result is consistent with the
+   * weak form of the face integrals, i.e., the face integrals are not affected by the split form
+   * except for the numerical flux.
+   *
+   * Since the two-point fluxes are symmetric, each flux is evaluated once per pair of points of a
+   * line and contributes to both points.
+   */
+  void
+  submit_volume_term_split_form(CellIntegratorScalar & density,
+                                CellIntegratorVector & momentum,
+                                CellIntegratorScalar & energy) const
+  {
+    unsigned int const n_points_1d = n_q_points_1d_split_form;
+    unsigned int const n_q_points  = density.n_q_points;
+
+    Assert(n_q_points == rho_split_form.size(), dealii::ExcInternalError());
+
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      vector const rho_u = momentum.get_value(q);
+      scalar const rho_E = energy.get_value(q);
+
+      scalar const rho = density.get_value(q);
+      vector const u   = rho_u / rho;
+      scalar const p   = calculate_pressure(rho_u, u, rho_E, gamma);
+
+      rho_split_form[q] = rho;
+      u_split_form[q]   = u;
+      p_split_form[q]   = p;
+      H_split_form[q]   = (rho_E + p) / rho;
+
+      // contravariant metric terms det(J) * grad(xi_d) stored in row d, where inverse_jacobian()
+      // returns J^{-T} with entry (i,d) = d xi_d / d x_i
+      tensor const inverse_jacobian = density.inverse_jacobian(q);
+      inverse_det_J_split_form[q]   = determinant(inverse_jacobian);
+      metric_split_form[q]          = transpose(inverse_jacobian) / inverse_det_J_split_form[q];
+
+      flux_density_split_form[q]  = scalar();
+      flux_momentum_split_form[q] = vector();
+      flux_energy_split_form[q]   = scalar();
+    }
+
+    unsigned int stride = 1;
+    for(unsigned int d = 0; d < dim; ++d, stride *= n_points_1d)
+    {
+      // loop over the first points of all lines in direction d
+      for(unsigned int start = 0; start < n_q_points; ++start)
+      {
+        if((start / stride) % n_points_1d != 0)
+          continue;
+
+        for(unsigned int i = 0; i < n_points_1d; ++i)
+        {
+          unsigned int const q_i = start + i * stride;
+
+          for(unsigned int j = i; j < n_points_1d; ++j)
+          {
+            unsigned int const q_j = start + j * stride;
+
+            std::tuple<scalar, vector, scalar> const flux =
+              get_two_point_flux(rho_split_form[q_i],
+                                 rho_split_form[q_j],
+                                 u_split_form[q_i],
+                                 u_split_form[q_j],
+                                 p_split_form[q_i],
+                                 p_split_form[q_j],
+                                 H_split_form[q_i],
+                                 H_split_form[q_j],
+                                 0.5 * (metric_split_form[q_i][d] + metric_split_form[q_j][d]));
+
+            Number const D_ij = derivative_split_form[i * n_points_1d + j];
+
+            flux_density_split_form[q_i] += D_ij * std::get<0>(flux);
+            flux_momentum_split_form[q_i] += D_ij * std::get<1>(flux);
+            flux_energy_split_form[q_i] += D_ij * std::get<2>(flux);
+
+            if(j != i)
+            {
+              Number const D_ji = derivative_split_form[j * n_points_1d + i];
+
+              flux_density_split_form[q_j] += D_ji * std::get<0>(flux);
+              flux_momentum_split_form[q_j] += D_ji * std::get<1>(flux);
+              flux_energy_split_form[q_j] += D_ji * std::get<2>(flux);
+            }
+          }
+        }
+      }
+    }
+
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      density.submit_value(inverse_det_J_split_form[q] * flux_density_split_form[q], q);
+      momentum.submit_value(inverse_det_J_split_form[q] * flux_momentum_split_form[q], q);
+      energy.submit_value(inverse_det_J_split_form[q] * flux_energy_split_form[q], q);
+    }
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_flux_split_form(scalar const & rho_M,
+                        scalar const & rho_P,
+                        vector const & rho_u_M,
+                        vector const & rho_u_P,
+                        scalar const & rho_E_M,
+                        scalar const & rho_E_P,
+                        scalar const & p_M,
+                        scalar const & p_P,
+                        scalar const & lambda,
+                        vector const & normal) const
+  {
+    vector const u_M = rho_u_M / rho_M;
+    vector const u_P = rho_u_P / rho_P;
+
+    std::tuple<scalar, vector, scalar> flux = get_two_point_flux(
+      rho_M, rho_P, u_M, u_P, p_M, p_P, (rho_E_M + p_M) / rho_M, (rho_E_P + p_P) / rho_P, normal);
+
+    // local Lax-Friedrichs dissipation
+    std::get<0>(flux) += 0.5 * lambda * (rho_M - rho_P);
+    std::get<1>(flux) += 0.5 * lambda * (rho_u_M - rho_u_P);
+    std::get<2>(flux) += 0.5 * lambda * (rho_E_M - rho_E_P);
+
+    return flux;
+  }
+
   inline DEAL_II_ALWAYS_INLINE //
     std::tuple<scalar, vector, scalar>
     get_flux(FaceIntegratorScalar & density_m,
@@ -612,6 +901,12 @@ public:
     // calculate lambda
     scalar lambda = calculate_lambda(rho_M, rho_P, u_M, u_P, p_M, p_P, gamma);
 
+    if(use_split_form())
+    {
+      return get_flux_split_form(
+        rho_M, rho_P, rho_u_M, rho_u_P, rho_E_M, rho_E_P, p_M, p_P, lambda, normal);
+    }
+
     // flux density
     scalar flux_density = calculate_flux(rho_u_M, rho_u_P, rho_M, rho_P, lambda, normal);
 
@@ -716,6 +1011,12 @@ public:
     // calculate lambda
     scalar lambda = calculate_lambda(rho_M, rho_P, u_M, u_P, p_M, p_P, gamma);
 
+    if(use_split_form())
+    {
+      return get_flux_split_form(
+        rho_M, rho_P, rho_u_M, rho_u_P, rho_E_M, rho_E_P, p_M, p_P, lambda, normal);
+    }
+
     // flux density
     scalar flux_density = calculate_flux(rho_u_M, rho_u_P, rho_M, rho_P, lambda, normal);
 
@@ -762,6 +1063,17 @@ private:
       energy.reinit(cell);
       energy.gather_evaluate(src, dealii::EvaluationFlags::values);
 
+      if(use_split_form())
+      {
+        submit_volume_term_split_form(density, momentum, energy);
+
+        density.integrate_scatter(dealii::EvaluationFlags::values, dst);
+        momentum.integrate_scatter(dealii::EvaluationFlags::values, dst);
+        energy.integrate_scatter(dealii::EvaluationFlags::values, dst);
+
+        continue;
+      }
+
       for(unsigned int q = 0; q < momentum.n_q_points; ++q)
       {
         std::tuple<vector, tensor, vector> flux = get_volume_flux(density, momentum, energy, q);
@@ -777,6 +1089,55 @@ private:
     }
   }
 
+  /*
+   * Computes the 1D matrix 2 D - W^{-1} B of the split form, where D is the derivative matrix of
+   * the Lagrange polynomials on the Gauss-Lobatto points, W the diagonal matrix of quadrature
+   * weights and B = diag(-1, 0, ..., 0, 1) the boundary matrix of the summation-by-parts property.
+   */
+  void
+  initialize_split_form_derivative()
+  {
+    dealii::Quadrature<1> const & quadrature =
+      matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0].quadrature;
+
+    n_q_points_1d_split_form = quadrature.size();
+
+    AssertThrow(n_q_points_1d_split_form >= 2 and std::abs(quadrature.point(0)[0]) < 1.e-12 and
+                  std::abs(quadrature.point(n_q_points_1d_split_form - 1)[0] - 1.0) < 1.e-12,
+                dealii::ExcMessage("The split form of the convective term requires a "
+                                   "Gauss-Lobatto quadrature rule."));
+
+    std::vector<dealii::Polynomials::Polynomial<double>> const lagrange_basis =
+      dealii::Polynomials::generate_complete_Lagrange_basis(quadrature.get_points());
+
+    unsigned int const n = n_q_points_1d_split_form;
+    derivative_split_form.resize(n * n);
+
+    std::vector<double> values(2);
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      for(unsigned int j = 0; j < n; ++j)
+      {
+        lagrange_basis[j].value(quadrature.point(i)[0], values);
+        derivative_split_form[i * n + j] = 2.0 * values[1];
+      }
+    }
+
+    derivative_split_form[0] += 1.0 / quadrature.weight(0);
+    derivative_split_form[n * n - 1] -= 1.0 / quadrature.weight(n - 1);
+
+    unsigned int const n_q_points = dealii::Utilities::pow(n, dim);
+    rho_split_form.resize(n_q_points);
+    p_split_form.resize(n_q_points);
+    H_split_form.resize(n_q_points);
+    inverse_det_J_split_form.resize(n_q_points);
+    u_split_form.resize(n_q_points);
+    metric_split_form.resize(n_q_points);
+    flux_density_split_form.resize(n_q_points);
+    flux_momentum_split_form.resize(n_q_points);
+    flux_energy_split_form.resize(n_q_points);
+  }
+
   void
   face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
             VectorType &                                  dst,
@@ -911,6 +1272,19 @@ private:
   // specific heat at constant volume
   Number c_v;
 
+  // split form: 1D difference matrix on the Gauss-Lobatto points (row-major)
+  unsigned int        n_q_points_1d_split_form;
+  std::vector<Number> derivative_split_form;
+
+  // split form: primitive variables, metric terms and accumulated fluxes of the current cell
+  // batch in the quadrature points, allocated once to avoid memory allocation in the cell loop
+  mutable dealii::AlignedVector<scalar> rho_split_form, p_split_form, H_split_form;
+  mutable dealii::AlignedVector<scalar> inverse_det_J_split_form;
+  mutable dealii::AlignedVector<vector> u_split_form;
+  mutable dealii::AlignedVector<tensor> metric_split_form;
+  mutable dealii::AlignedVector<scalar> flux_density_split_form, flux_energy_split_form;
+  mutable dealii::AlignedVector<vector> flux_momentum_split_form;
+
   mutable Number eval_time;
 };
 
@@ -1704,7 +2078,12 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  CombinedOperator() : matrix_free(nullptr), convective_operator(nullptr), viscous_operator(nullptr)
+  CombinedOperator()
+    : matrix_free(nullptr),
+      convective_operator(nullptr),
+      viscous_operator(nullptr),
+      active_category(dealii::numbers::invalid_unsigned_int),
+      interface_faces_only(false)
   {
   }
 
@@ -1741,6 +2120,44 @@ public:
     //    matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Restricts the evaluation to the cells of the given cell vectorization category of the
+   * MatrixFree object and to the faces adjacent to these cells, e.g., to the cells of one time
+   * step cluster for local time stepping. The result is only complete for the degrees of freedom
+   * of the cells of this category.
+   */
+  void
+  evaluate_add_category(VectorType &       dst,
+                        VectorType const & src,
+                        Number const       evaluation_time,
+                        unsigned int const category) const
+  {
+    this->active_category = category;
+
+    evaluate_add(dst, src, evaluation_time);
+
+    this->active_category = dealii::numbers::invalid_unsigned_int;
+  }
+
+  /*
+   * Restricts the evaluation to the faces between cells of the given category and cells of
+   * categories with a smaller index, e.g., to the faces between a time step cluster and finer
+   * clusters for the flux registers of local time stepping. Cell integrals and boundary faces are
+   * skipped.
+   */
+  void
+  evaluate_add_category_interface(VectorType &       dst,
+                                  VectorType const & src,
+                                  Number const       evaluation_time,
+                                  unsigned int const category) const
+  {
+    this->interface_faces_only = true;
+
+    evaluate_add_category(dst, src, evaluation_time, category);
+
+    this->interface_faces_only = false;
+  }
+
 private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
@@ -1748,6 +2165,13 @@ private:
             VectorType const &                            src,
             std::pair<unsigned int, unsigned int> const & cell_range) const
   {
+    if(interface_faces_only)
+      return;
+
+    if(active_category != dealii::numbers::invalid_unsigned_int and
+       matrix_free.get_cell_range_category(cell_range) != active_category)
+      return;
+
     CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
     CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
     CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
@@ -1767,6 +2191,30 @@ private:
       energy.gather_evaluate(src,
                              dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
 
+      if(convective_operator->use_split_form())
+      {
+        for(unsigned int q = 0; q < momentum.n_q_points; ++q)
+        {
+          std::tuple<vector, tensor, vector> visc_flux =
+            viscous_operator->get_volume_flux(density, momentum, energy, q);
+
+          momentum.submit_gradient(std::get<1>(visc_flux), q);
+          energy.submit_gradient(std::get<2>(visc_flux), q);
+        }
+
+        convective_operator->submit_volume_term_split_form(density, momentum, energy);
+
+        density.integrate_scatter(dealii::EvaluationFlags::values, dst);
+        momentum.integrate_scatter(dealii::EvaluationFlags::values |
+                                     dealii::EvaluationFlags::gradients,
+                                   dst);
+        energy.integrate_scatter(dealii::EvaluationFlags::values |
+                                   dealii::EvaluationFlags::gradients,
+                                 dst);
+
+        continue;
+      }
+
       for(unsigned int q = 0; q < momentum.n_q_points; ++q)
       {
         std::tuple<vector, tensor, vector> conv_flux =
@@ -1792,6 +2240,18 @@ private:
             VectorType const &                            src,
             std::pair<unsigned int, unsigned int> const & face_range) const
   {
+    if(active_category != dealii::numbers::invalid_unsigned_int)
+    {
+      std::pair<unsigned int, unsigned int> const category =
+        matrix_free.get_face_range_category(face_range);
+
+      if(category.first != active_category and category.second != active_category)
+        return;
+
+      if(interface_faces_only and std::min(category.first, category.second) == active_category)
+        return;
+    }
+
     FaceIntegratorScalar density_m(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorScalar density_p(matrix_free, false, data.dof_index, data.quad_index, 0);
     FaceIntegratorVector momentum_m(matrix_free, true, data.dof_index, data.quad_index, 1);
@@ -1894,6 +2354,13 @@ private:
                      VectorType const &                            src,
                      std::pair<unsigned int, unsigned int> const & face_range) const
   {
+    if(interface_faces_only)
+      return;
+
+    if(active_category != dealii::numbers::invalid_unsigned_int and
+       matrix_free.get_face_range_category(face_range).first != active_category)
+      return;
+
     FaceIntegratorScalar density(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorVector momentum(matrix_free, true, data.dof_index, data.quad_index, 1);
     FaceIntegratorScalar energy(matrix_free, true, data.dof_index, data.quad_index, 1 + dim);
@@ -1985,6 +2452,13 @@ private:
 
   ConvectiveOperator<dim, Number> const * convective_operator;
   ViscousOperator<dim, Number> const *    viscous_operator;
+
+  // only cells of this category and their faces are evaluated (all cells if invalid)
+  unsigned int mutable active_category;
+
+  // only the faces between cells of the active category and cells of smaller categories are
+  // evaluated
+  bool mutable interface_faces_only;
 };
 
 } // namespace CompNS
@@ -19,6 +19,9 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <set>
+
 // deal.II
 #include <deal.II/base/timer.h>
 
@@ -53,6 +56,7 @@ Operator<dim, Number>::Operator(
     dof_handler_vector(*grid_in->triangulation),
     dof_handler_scalar(*grid_in->triangulation),
     mpi_comm(mpi_comm_in),
+    n_time_step_clusters(1),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
     wall_time_operator_evaluation(0.0)
 {
@@ -60,6 +64,9 @@ Operator<dim, Number>::Operator(
 
   initialize_dof_handler_and_constraints();
 
+  if(param.use_local_time_stepping)
+    initialize_time_step_clusters();
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -87,6 +94,68 @@ Operator<dim, Number>::initialize_dof_handler_and_constraints()
   print_parameter(pcout, "number of dofs (total)", dof_handler.n_dofs());
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::initialize_time_step_clusters()
+{
+  dealii::Triangulation<dim> const & triangulation = *grid->triangulation;
+
+  // The admissible time step size is assumed to scale linearly with the cell size, i.e., cells
+  // that are larger than the smallest cell by a factor of 2^k can be advanced with a time step
+  // size larger by a factor of 2^k.
+  double h_min = std::numeric_limits<double>::max();
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      h_min = std::min(h_min, cell->minimum_vertex_distance());
+  }
+  h_min = dealii::Utilities::MPI::min(h_min, mpi_comm);
+
+  // Ghost cells are assigned to clusters as well, since the MatrixFree object needs to know the
+  // categories of ghost cells. The cluster of a cell only depends on its geometry and is therefore
+  // identical on all processes sharing this cell.
+  time_step_cluster.assign(triangulation.n_active_cells(), 0);
+
+  std::vector<unsigned int> n_cells_per_cluster(param.max_number_of_time_step_clusters, 0);
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_artificial())
+      continue;
+
+    double const ratio = std::max(cell->minimum_vertex_distance() / h_min, 1.0);
+
+    unsigned int const cluster =
+      std::min(static_cast<unsigned int>(std::floor(std::log2(ratio) + 1.e-12)),
+               param.max_number_of_time_step_clusters - 1);
+
+    time_step_cluster[cell->active_cell_index()] = cluster;
+
+    if(cell->is_locally_owned())
+      ++n_cells_per_cluster[cluster];
+  }
+
+  std::vector<unsigned int> n_cells_per_cluster_global(n_cells_per_cluster.size());
+  dealii::Utilities::MPI::sum(n_cells_per_cluster, mpi_comm, n_cells_per_cluster_global);
+
+  // empty clusters on the coarse end are not needed
+  n_time_step_clusters = 1;
+  for(unsigned int k = 0; k < n_cells_per_cluster_global.size(); ++k)
+  {
+    if(n_cells_per_cluster_global[k] > 0)
+      n_time_step_clusters = k + 1;
+  }
+
+  pcout << std::endl << "Local time stepping:" << std::endl << std::endl;
+
+  print_parameter(pcout, "number of time step clusters", n_time_step_clusters);
+  for(unsigned int k = 0; k < n_time_step_clusters; ++k)
+  {
+    print_parameter(pcout,
+                    "number of cells (cluster " + std::to_string(k) + ")",
+                    n_cells_per_cluster_global[k]);
+  }
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const
@@ -106,6 +175,14 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   flags_cfl.cells = dealii::update_quadrature_points;
   matrix_free_data.append_mapping_flags(flags_cfl);
 
+  // local time stepping: the cells of one time step cluster are grouped into cell batches, so
+  // that the operator can be evaluated for a single cluster by skipping the other cell ranges
+  if(param.use_local_time_stepping)
+  {
+    matrix_free_data.data.cell_vectorization_category          = time_step_cluster;
+    matrix_free_data.data.cell_vectorization_categories_strict = true;
+  }
+
   // dof handler
   matrix_free_data.insert_dof_handler(&dof_handler, field + dof_index_all);
   matrix_free_data.insert_dof_handler(&dof_handler_vector, field + dof_index_vector);
@@ -147,9 +224,18 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   matrix_free_data.insert_quadrature(*quadrature_standard, field + quad_index_standard);
   std::shared_ptr<dealii::Quadrature<dim>> quadrature_conv =
     create_quadrature<dim>(param.grid.element_type, n_q_points_conv);
-  matrix_free_data.insert_quadrature(*quadrature_conv, field + quad_index_overintegration_conv);
   std::shared_ptr<dealii::Quadrature<dim>> quadrature_vis =
     create_quadrature<dim>(param.grid.element_type, n_q_points_vis);
+
+  // The split forms of the convective term are evaluated on the Gauss-Lobatto points. The viscous
+  // term uses the same points in order to allow for the combined operator.
+  if(param.convective_term_formulation != ConvectiveTermFormulation::Standard)
+  {
+    quadrature_conv = std::make_shared<dealii::QGaussLobatto<dim>>(param.degree + 1);
+    quadrature_vis  = std::make_shared<dealii::QGaussLobatto<dim>>(param.degree + 1);
+  }
+
+  matrix_free_data.insert_quadrature(*quadrature_conv, field + quad_index_overintegration_conv);
   matrix_free_data.insert_quadrature(*quadrature_vis, field + quad_index_overintegration_vis);
 }
 
@@ -167,6 +253,10 @@ Operator<dim, Number>::setup_operators()
   InverseMassOperatorData<Number> inverse_mass_operator_data_all;
   inverse_mass_operator_data_all.dof_index  = get_dof_index_all();
   inverse_mass_operator_data_all.quad_index = get_quad_index_standard();
+  // The split forms rely on the summation-by-parts property, which requires the mass matrix to
+  // be integrated with the Gauss-Lobatto points of the convective term (diagonal mass matrix).
+  if(param.convective_term_formulation != ConvectiveTermFormulation::Standard)
+    inverse_mass_operator_data_all.quad_index = get_quad_index_overintegration_conv();
   inverse_mass_operator_data_all.parameters = param.inverse_mass_operator;
   inverse_mass_all.initialize(*matrix_free, inverse_mass_operator_data_all);
 
@@ -198,6 +288,7 @@ Operator<dim, Number>::setup_operators()
   convective_operator_data.bc                    = boundary_descriptor;
   convective_operator_data.heat_capacity_ratio   = param.heat_capacity_ratio;
   convective_operator_data.specific_gas_constant = param.specific_gas_constant;
+  convective_operator_data.formulation           = param.convective_term_formulation;
   convective_operator.initialize(*matrix_free, convective_operator_data);
 
   // viscous operator
@@ -252,6 +343,78 @@ Operator<dim, Number>::setup_operators()
                                    get_quad_index_standard());
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::setup_time_step_cluster_dofs()
+{
+  std::shared_ptr<dealii::Utilities::MPI::Partitioner const> const partitioner =
+    matrix_free->get_vector_partitioner(get_dof_index_all());
+
+  time_step_cluster_dofs.assign(n_time_step_clusters, std::vector<unsigned int>());
+  time_step_cluster_neighbor_dofs.assign(
+    n_time_step_clusters, std::vector<std::vector<unsigned int>>(n_time_step_clusters));
+
+  std::vector<dealii::types::global_dof_index> dof_indices(fe->n_dofs_per_cell());
+  std::vector<unsigned int>                    local_dof_indices(fe->n_dofs_per_cell());
+
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(not cell->is_locally_owned())
+      continue;
+
+    unsigned int const cluster = time_step_cluster[cell->active_cell_index()];
+
+    cell->get_dof_indices(dof_indices);
+    for(unsigned int i = 0; i < dof_indices.size(); ++i)
+      local_dof_indices[i] = partitioner->global_to_local(dof_indices[i]);
+
+    time_step_cluster_dofs[cluster].insert(time_step_cluster_dofs[cluster].end(),
+                                           local_dof_indices.begin(),
+                                           local_dof_indices.end());
+
+    // clusters of the face neighbors (locally owned or ghost cells) of the present cell,
+    // including neighbors across hanging faces and periodic faces
+    std::set<unsigned int> neighbor_clusters;
+    for(unsigned int const f : cell->face_indices())
+    {
+      if(cell->at_boundary(f) and not cell->has_periodic_neighbor(f))
+        continue;
+
+      auto const neighbor = cell->neighbor_or_periodic_neighbor(f);
+
+      if(neighbor->has_children())
+      {
+        unsigned int const n_subfaces =
+          cell->at_boundary(f) ? neighbor->face(cell->periodic_neighbor_face_no(f))->n_children() :
+                                 cell->face(f)->n_children();
+
+        for(unsigned int subface = 0; subface < n_subfaces; ++subface)
+        {
+          auto const child = cell->at_boundary(f) ?
+                               cell->periodic_neighbor_child_on_subface(f, subface) :
+                               cell->neighbor_child_on_subface(f, subface);
+
+          neighbor_clusters.insert(time_step_cluster[child->active_cell_index()]);
+        }
+      }
+      else
+      {
+        neighbor_clusters.insert(time_step_cluster[neighbor->active_cell_index()]);
+      }
+    }
+
+    for(unsigned int const neighbor_cluster : neighbor_clusters)
+    {
+      if(neighbor_cluster == cluster)
+        continue;
+
+      std::vector<unsigned int> & neighbor_dofs =
+        time_step_cluster_neighbor_dofs[neighbor_cluster][cluster];
+      neighbor_dofs.insert(neighbor_dofs.end(), local_dof_indices.begin(), local_dof_indices.end());
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::setup()
@@ -288,6 +451,9 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number> con
   // perform setup of data structures that depend on matrix-free object
   setup_operators();
 
+  if(param.use_local_time_stepping)
+    setup_time_step_cluster_dofs();
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -351,6 +517,121 @@ Operator<dim, Number>::evaluate(VectorType & dst, VectorType const & src, Number
   wall_time_operator_evaluation += timer.wall_time();
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_time_step_cluster(VectorType &       dst,
+                                                  VectorType const & src,
+                                                  Number const       time,
+                                                  unsigned int const cluster) const
+{
+  AssertThrow(param.use_local_time_stepping and cluster < n_time_step_clusters,
+              dealii::ExcMessage("Invalid time step cluster."));
+
+  dealii::Timer timer;
+  timer.restart();
+
+  // Only the entries of dst receiving contributions from the cells and faces of this cluster are
+  // set to zero, i.e., the dofs of the cluster and the dofs of neighboring cells.
+  std::vector<unsigned int> const & cluster_dofs = time_step_cluster_dofs[cluster];
+  for(unsigned int const i : cluster_dofs)
+    dst.local_element(i) = 0.0;
+  for(std::vector<unsigned int> const & neighbor_dofs : time_step_cluster_neighbor_dofs[cluster])
+  {
+    for(unsigned int const i : neighbor_dofs)
+      dst.local_element(i) = 0.0;
+  }
+  dst.zero_out_ghost_values();
+
+  // viscous and convective terms
+  combined_operator.evaluate_add_category(dst, src, time, cluster);
+
+  // shift viscous and convective terms to the right-hand side of the equation, also for the
+  // neighbor dofs, which enter the flux registers of local time stepping
+  for(unsigned int const i : cluster_dofs)
+    dst.local_element(i) *= -1.0;
+  for(std::vector<unsigned int> const & neighbor_dofs : time_step_cluster_neighbor_dofs[cluster])
+  {
+    for(unsigned int const i : neighbor_dofs)
+      dst.local_element(i) *= -1.0;
+  }
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    body_force_operator.evaluate_add_category(dst, src, time, cluster);
+  }
+
+  // apply inverse mass operator
+  inverse_mass_all.apply_category(dst, dst, cluster);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_time_step_cluster_interface(VectorType &       dst,
+                                                            VectorType const & src,
+                                                            Number const       time,
+                                                            unsigned int const cluster) const
+{
+  AssertThrow(param.use_local_time_stepping and cluster < n_time_step_clusters,
+              dealii::ExcMessage("Invalid time step cluster."));
+
+  dealii::Timer timer;
+  timer.restart();
+
+  std::vector<unsigned int> const & cluster_dofs = time_step_cluster_dofs[cluster];
+  for(unsigned int const i : cluster_dofs)
+    dst.local_element(i) = 0.0;
+  for(std::vector<unsigned int> const & neighbor_dofs : time_step_cluster_neighbor_dofs[cluster])
+  {
+    for(unsigned int const i : neighbor_dofs)
+      dst.local_element(i) = 0.0;
+  }
+  dst.zero_out_ghost_values();
+
+  // viscous and convective terms on the faces between this cluster and finer clusters
+  combined_operator.evaluate_add_category_interface(dst, src, time, cluster);
+
+  // shift viscous and convective terms to the right-hand side of the equation
+  for(unsigned int const i : cluster_dofs)
+    dst.local_element(i) *= -1.0;
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::apply_inverse_mass_time_step_cluster(VectorType &       dst,
+                                                            VectorType const & src,
+                                                            unsigned int const cluster) const
+{
+  AssertThrow(param.use_local_time_stepping and cluster < n_time_step_clusters,
+              dealii::ExcMessage("Invalid time step cluster."));
+
+  inverse_mass_all.apply_category(dst, src, cluster);
+}
+
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::get_number_of_time_step_clusters() const
+{
+  return n_time_step_clusters;
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::get_time_step_cluster_dofs(
+  std::vector<std::vector<unsigned int>> &              cluster_dofs,
+  std::vector<std::vector<std::vector<unsigned int>>> & neighbor_dofs) const
+{
+  AssertThrow(param.use_local_time_stepping,
+              dealii::ExcMessage("Time step clusters are only available for local time stepping."));
+
+  cluster_dofs  = time_step_cluster_dofs;
+  neighbor_dofs = time_step_cluster_neighbor_dofs;
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_convective(VectorType &       dst,
@@ -585,6 +866,83 @@ Operator<dim, Number>::calculate_time_step_cfl_global() const
     mpi_comm);
 }
 
+template<int dim, typename Number>
+double
+Operator<dim, Number>::calculate_time_step_cfl_numerical_solution(VectorType const & solution) const
+{
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  unsigned int const dof_index  = get_dof_index_all();
+  unsigned int const quad_index = get_quad_index_standard();
+
+  CellIntegrator<dim, 1, Number>   density(*matrix_free, dof_index, quad_index, 0);
+  CellIntegrator<dim, dim, Number> momentum(*matrix_free, dof_index, quad_index, 1);
+  CellIntegrator<dim, 1, Number>   energy(*matrix_free, dof_index, quad_index, 1 + dim);
+
+  Number const gamma = param.heat_capacity_ratio;
+  double const cfl_p = 1.0 / std::pow(param.degree, param.exponent_fe_degree_cfl);
+
+  double time_step = std::numeric_limits<double>::max();
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    density.reinit(cell);
+    density.read_dof_values(solution);
+    density.evaluate(dealii::EvaluationFlags::values);
+
+    momentum.reinit(cell);
+    momentum.read_dof_values(solution);
+    momentum.evaluate(dealii::EvaluationFlags::values);
+
+    energy.reinit(cell);
+    energy.read_dof_values(solution);
+    energy.evaluate(dealii::EvaluationFlags::values);
+
+    scalar time_step_cell =
+      dealii::make_vectorized_array<Number>(std::numeric_limits<Number>::max());
+
+    for(unsigned int q = 0; q < density.n_q_points; ++q)
+    {
+      scalar rho   = density.get_value(q);
+      vector rho_u = momentum.get_value(q);
+      scalar rho_E = energy.get_value(q);
+      vector u     = rho_u / rho;
+      scalar p     = calculate_pressure(rho_u, u, rho_E, gamma);
+
+      // speed of sound c = sqrt(gamma * p / rho)
+      scalar const c = std::sqrt(std::max(gamma * p / rho, scalar()));
+
+      // transformation to reference coordinates as in calculate_time_step_cfl_local()
+      tensor const invJ_t = transpose(density.inverse_jacobian(q));
+      vector const u_xi   = invJ_t * u;
+
+      // the wave speed in the direction of reference coordinate d is |u_xi[d]| + c |row d of
+      // invJ_t|, which is the local analogue of CFLConditionType::VelocityComponents
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        scalar metric = scalar();
+        for(unsigned int e = 0; e < dim; ++e)
+          metric += invJ_t[d][e] * invJ_t[d][e];
+
+        time_step_cell =
+          std::min(time_step_cell, cfl_p / (std::abs(u_xi[d]) + c * std::sqrt(metric)));
+      }
+    }
+
+    // unused lanes of the cell batch contain no valid state
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      time_step = std::min(time_step, (double)time_step_cell[v]);
+  }
+
+  time_step = dealii::Utilities::MPI::min(time_step, mpi_comm);
+
+  // truncate to make the sequence of time step sizes independent of the number of processors,
+  // see calculate_time_step_cfl_local()
+  return dealii::Utilities::truncate_to_n_digits(time_step, 4);
+}
+
 template<int dim, typename Number>
 double
 Operator<dim, Number>::calculate_time_step_diffusion() const
@@ -103,6 +103,47 @@ public:
   void
   evaluate(VectorType & dst, VectorType const & src, Number const time) const final;
 
+  /*
+   *  This function is used in case of local time stepping: Same as evaluate(), but restricted
+   *  to the cells of the given time step cluster and the faces adjacent to these cells. The
+   *  result is valid for the degrees of freedom of the cells of this cluster. For the degrees of
+   *  freedom of neighboring cells of other clusters, dst contains the contributions of the faces
+   *  shared with this cluster to the right-hand side, without the inverse mass operator.
+   */
+  void
+  evaluate_time_step_cluster(VectorType &       dst,
+                             VectorType const & src,
+                             Number const       time,
+                             unsigned int const cluster) const final;
+
+  /*
+   *  Local time stepping: contributions of the faces between the given time step cluster and
+   *  finer clusters to the right-hand side for the degrees of freedom of this cluster, without
+   *  the inverse mass operator. These are required for the flux registers.
+   */
+  void
+  evaluate_time_step_cluster_interface(VectorType &       dst,
+                                       VectorType const & src,
+                                       Number const       time,
+                                       unsigned int const cluster) const final;
+
+  // local time stepping: inverse mass operator restricted to the cells of a time step cluster
+  void
+  apply_inverse_mass_time_step_cluster(VectorType &       dst,
+                                       VectorType const & src,
+                                       unsigned int const cluster) const final;
+
+  // local time stepping: number of time step clusters (one cluster without local time stepping)
+  unsigned int
+  get_number_of_time_step_clusters() const final;
+
+  // local time stepping: locally owned dofs of the cells of each time step cluster and locally
+  // owned dofs of cells of cluster j that are face neighbors of cells of cluster k
+  void
+  get_time_step_cluster_dofs(
+    std::vector<std::vector<unsigned int>> &              cluster_dofs,
+    std::vector<std::vector<std::vector<unsigned int>>> & neighbor_dofs) const final;
+
   void
   evaluate_convective(VectorType & dst, VectorType const & src, Number const time) const;
 
@@ -176,6 +217,11 @@ public:
   double
   calculate_time_step_cfl_global() const final;
 
+  // local CFL criterion: calculates the time step size for the local wave speed |u| + c of the
+  // given solution (conserved variables)
+  double
+  calculate_time_step_cfl_numerical_solution(VectorType const & solution) const final;
+
   // Calculate time step size according to diffusion term
   double
   calculate_time_step_diffusion() const final;
@@ -187,6 +233,13 @@ private:
   void
   setup_operators();
 
+  // assign cells to time step clusters according to their size in case of local time stepping
+  void
+  initialize_time_step_clusters();
+
+  void
+  setup_time_step_cluster_dofs();
+
   unsigned int
   get_dof_index_all() const;
 
@@ -252,6 +305,16 @@ private:
    */
   dealii::AffineConstraints<Number> constraint;
 
+  /*
+   * Local time stepping: time step cluster of each active cell (indexed by the active cell
+   * index), used as cell vectorization category of the MatrixFree object.
+   */
+  std::vector<unsigned int> time_step_cluster;
+  unsigned int              n_time_step_clusters;
+
+  std::vector<std::vector<unsigned int>>              time_step_cluster_dofs;
+  std::vector<std::vector<std::vector<unsigned int>>> time_step_cluster_neighbor_dofs;
+
   /*
    * Matrix-free operator evaluation.
    */
@@ -41,7 +41,7 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.end_time,
                               param_in.max_number_of_time_steps,
                               param_in.restart_data,
-                              false, // currently no adaptive time stepping implemented
+                              param_in.adaptive_time_stepping,
                               mpi_comm_in,
                               is_test_in),
     pde_operator(operator_in),
@@ -50,53 +50,91 @@ TimeIntExplRK<Number>::TimeIntExplRK(
     postprocessor(postprocessor_in),
     l2_norm(0.0),
     cfl_number(param.cfl_number / std::pow(2.0, refine_steps_time)),
-    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time))
+    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time)),
+    time_step_diff(std::numeric_limits<double>::max())
 {
 }
 
 template<typename Number>
-void
-TimeIntExplRK<Number>::initialize_time_integrator()
+template<typename OperatorType>
+std::shared_ptr<ExplicitTimeIntegrator<OperatorType, typename TimeIntExplRK<Number>::VectorType>>
+TimeIntExplRK<Number>::create_explicit_time_integrator(
+  std::shared_ptr<OperatorType> const operator_in) const
 {
-  // initialize Runge-Kutta time integrator
-  if(this->param.temporal_discretization == TemporalDiscretization::ExplRK)
+  std::shared_ptr<ExplicitTimeIntegrator<OperatorType, VectorType>> time_integrator;
+
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK)
   {
-    rk_time_integrator = std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
-      param.order_time_integrator, pde_operator);
+    time_integrator = std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorType, VectorType>>(
+      param.order_time_integrator, operator_in);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(pde_operator);
+    time_integrator =
+      std::make_shared<LowStorageRK3Stage4Reg2C<OperatorType, VectorType>>(operator_in);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(pde_operator);
+    time_integrator =
+      std::make_shared<LowStorageRK4Stage5Reg2C<OperatorType, VectorType>>(operator_in);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK4Stage5Reg3C<Operator, VectorType>>(pde_operator);
+    time_integrator =
+      std::make_shared<LowStorageRK4Stage5Reg3C<OperatorType, VectorType>>(operator_in);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK5Stage9Reg2S<Operator, VectorType>>(pde_operator);
+    time_integrator =
+      std::make_shared<LowStorageRK5Stage9Reg2S<OperatorType, VectorType>>(operator_in);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2)
   {
-    rk_time_integrator = std::make_shared<LowStorageRKTD<Operator, VectorType>>(pde_operator, 3, 7);
+    time_integrator = std::make_shared<LowStorageRKTD<OperatorType, VectorType>>(operator_in, 3, 7);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage8Reg2)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage8Reg2)
   {
-    rk_time_integrator = std::make_shared<LowStorageRKTD<Operator, VectorType>>(pde_operator, 4, 8);
+    time_integrator = std::make_shared<LowStorageRKTD<OperatorType, VectorType>>(operator_in, 4, 8);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::SSPRK)
+  else if(param.temporal_discretization == TemporalDiscretization::SSPRK)
   {
-    rk_time_integrator = std::make_shared<SSPRK<Operator, VectorType>>(pde_operator,
-                                                                       param.order_time_integrator,
-                                                                       param.stages);
+    time_integrator = std::make_shared<SSPRK<OperatorType, VectorType>>(
+      operator_in, param.order_time_integrator, param.stages);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Specified time integration scheme is not implemented."));
+  }
+
+  return time_integrator;
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::initialize_time_integrator()
+{
+  // initialize Runge-Kutta time integrator
+  if(param.use_local_time_stepping)
+  {
+    typedef LocalTimeStepping<Operator, VectorType> LTS;
+
+    rk_time_integrator = std::make_shared<LTS>(
+      pde_operator, [&](std::shared_ptr<typename LTS::ClusterOperator> cluster_operator) {
+        return create_explicit_time_integrator(cluster_operator);
+      });
+  }
+  else
+  {
+    rk_time_integrator = create_explicit_time_integrator(pde_operator);
+  }
+
+  // The diffusion time step restriction only depends on the grid. It is computed here, since
+  // calculate_time_step_size() is not called in case of a restart, while adaptive time stepping
+  // needs this value in every time step.
+  if(param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
+  {
+    time_step_diff = pde_operator->calculate_time_step_diffusion();
+    time_step_diff *= diffusion_number;
   }
 }
 
@@ -139,14 +177,22 @@ TimeIntExplRK<Number>::calculate_time_step_size()
   else if(param.calculation_of_time_step_size == TimeStepCalculation::CFL)
   {
     // calculate time step according to CFL condition
-    this->time_step = pde_operator->calculate_time_step_cfl_global();
-    this->time_step *= cfl_number;
+    this->time_step = calculate_time_step_cfl();
 
-    this->time_step =
-      adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+    // the CFL condition refers to the smallest cells in case of local time stepping
+    this->time_step *= get_time_step_ratio_local_time_stepping();
+
+    if(this->adaptive_time_stepping == false)
+    {
+      this->time_step =
+        adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+    }
 
     print_parameter(this->pcout, "CFL", cfl_number);
-    print_parameter(this->pcout, "Time step size (convection)", this->time_step);
+    if(param.use_local_time_stepping)
+      print_parameter(this->pcout, "Time step size (coarsest cluster)", this->time_step);
+    else
+      print_parameter(this->pcout, "Time step size (convection)", this->time_step);
   }
   else if(param.calculation_of_time_step_size == TimeStepCalculation::Diffusion)
   {
@@ -163,28 +209,34 @@ TimeIntExplRK<Number>::calculate_time_step_size()
   else if(param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     double time_step_conv = std::numeric_limits<double>::max();
-    double time_step_diff = std::numeric_limits<double>::max();
 
     // calculate time step according to CFL condition
-    time_step_conv = pde_operator->calculate_time_step_cfl_global();
-    time_step_conv *= cfl_number;
+    time_step_conv = calculate_time_step_cfl();
 
     print_parameter(this->pcout, "CFL", cfl_number);
     print_parameter(this->pcout, "Time step size (convection)", time_step_conv);
 
-    // calculate time step size according to diffusion number condition
-    time_step_diff = pde_operator->calculate_time_step_diffusion();
-    time_step_diff *= diffusion_number;
-
+    // time step size according to diffusion number condition, see initialize_time_integrator()
     print_parameter(this->pcout, "Diffusion number", diffusion_number);
     print_parameter(this->pcout, "Time step size (diffusion)", time_step_diff);
 
     this->time_step = std::min(time_step_conv, time_step_diff);
 
-    this->time_step =
-      adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+    // Both restrictions refer to the smallest cells of the mesh. The diffusion restriction scales
+    // quadratically with the cell size and is therefore also satisfied by the larger time step
+    // sizes of the coarser clusters in case of local time stepping.
+    this->time_step *= get_time_step_ratio_local_time_stepping();
+
+    if(this->adaptive_time_stepping == false)
+    {
+      this->time_step =
+        adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+    }
 
-    print_parameter(this->pcout, "Time step size (combined)", this->time_step);
+    if(param.use_local_time_stepping)
+      print_parameter(this->pcout, "Time step size (coarsest cluster)", this->time_step);
+    else
+      print_parameter(this->pcout, "Time step size (combined)", this->time_step);
   }
   else
   {
@@ -193,13 +245,61 @@ TimeIntExplRK<Number>::calculate_time_step_size()
   }
 }
 
+template<typename Number>
+double
+TimeIntExplRK<Number>::calculate_time_step_cfl() const
+{
+  double time_step_cfl = std::numeric_limits<double>::max();
+
+  if(this->adaptive_time_stepping)
+  {
+    time_step_cfl = pde_operator->calculate_time_step_cfl_numerical_solution(this->solution_n);
+    time_step_cfl *= cfl_number;
+
+    // make sure that time step size does not exceed maximum allowable time step size
+    time_step_cfl = std::min(time_step_cfl, param.time_step_size_max);
+  }
+  else
+  {
+    time_step_cfl = pde_operator->calculate_time_step_cfl_global();
+    time_step_cfl *= cfl_number;
+  }
+
+  return time_step_cfl;
+}
+
+template<typename Number>
+double
+TimeIntExplRK<Number>::get_time_step_ratio_local_time_stepping() const
+{
+  if(param.use_local_time_stepping)
+    return std::pow(2.0, pde_operator->get_number_of_time_step_clusters() - 1);
+  else
+    return 1.0;
+}
+
 template<typename Number>
 double
 TimeIntExplRK<Number>::recalculate_time_step_size() const
 {
-  AssertThrow(false, dealii::ExcMessage("Currently no adaptive time stepping implemented."));
+  AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL or
+                param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
+              dealii::ExcMessage(
+                "Adaptive time step is not implemented for this type of time step calculation."));
+
+  double new_time_step_size = calculate_time_step_cfl();
+
+  // take viscous term into account
+  new_time_step_size = std::min(new_time_step_size, time_step_diff);
+
+  // Limit the increase of the time step size, e.g., after a strong decay of the wave speed. A
+  // decrease is not limited, since the CFL condition has to be satisfied for stability of the
+  // explicit time integrator.
+  new_time_step_size = std::min(new_time_step_size,
+                                param.adaptive_time_stepping_limiting_factor *
+                                  this->get_time_step_size());
 
-  return 1.0;
+  return new_time_step_size;
 }
 
 template<typename Number>
@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/local_time_stepping.h>
 #include <exadg/time_integration/ssp_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
@@ -65,6 +66,12 @@ public:
   get_wall_times(std::vector<std::string> & name, std::vector<double> & wall_time) const;
 
 private:
+  // creates the Runge-Kutta scheme specified by the parameters for the given operator, i.e., the
+  // spatial discretization or a single time step cluster in case of local time stepping
+  template<typename OperatorType>
+  std::shared_ptr<ExplicitTimeIntegrator<OperatorType, VectorType>>
+  create_explicit_time_integrator(std::shared_ptr<OperatorType> const operator_in) const;
+
   void
   initialize_time_integrator() final;
 
@@ -92,6 +99,16 @@ private:
   double
   recalculate_time_step_size() const final;
 
+  // time step size according to the CFL condition, based on the current solution in case of
+  // adaptive time stepping and on the global estimate of the maximum wave speed otherwise
+  double
+  calculate_time_step_cfl() const;
+
+  // ratio of the time step size of the coarsest time step cluster and the finest one in case of
+  // local time stepping (1 otherwise)
+  double
+  get_time_step_ratio_local_time_stepping() const;
+
   void
   calculate_pressure();
 
@@ -123,6 +140,9 @@ private:
   // time step calculation
   double const cfl_number;
   double const diffusion_number;
+
+  // time step size according to the diffusion number condition (independent of the solution)
+  double time_step_diff;
 };
 
 } // namespace CompNS
@@ -116,6 +116,30 @@ enum class QuadratureRule
   Overintegration2k
 };
 
+/*
+ *  Formulation of the convective term:
+ *
+ *  - Standard: weak form of the divergence of the flux integrated with the quadrature rule
+ *    specified by n_q_points_convective, local Lax-Friedrichs flux on faces
+ *
+ *  - KineticEnergyPreserving: split form evaluated by flux differencing on the degree+1
+ *    Gauss-Lobatto points of each cell (summation-by-parts property of the collocated
+ *    derivative) using the two-point flux of Pirozzoli, which preserves kinetic energy
+ *
+ *  - EntropyConserving: as KineticEnergyPreserving, but using the two-point flux of Ranocha,
+ *    which in addition conserves entropy and preserves pressure equilibria
+ *
+ *  For the split forms, the face flux is the respective two-point flux augmented by the local
+ *  Lax-Friedrichs dissipation. These formulations are stable without over-integration and
+ *  therefore allow to use the standard number of quadrature points.
+ */
+enum class ConvectiveTermFormulation
+{
+  Standard,
+  KineticEnergyPreserving,
+  EntropyConserving
+};
+
 /**************************************************************************************/
 /*                                                                                    */
 /*                                       SOLVER                                       */
@@ -50,6 +50,11 @@ Parameters::Parameters()
     order_time_integrator(1),
     stages(1),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
+    adaptive_time_stepping(false),
+    adaptive_time_stepping_limiting_factor(1.2),
+    time_step_size_max(std::numeric_limits<double>::max()),
+    use_local_time_stepping(false),
+    max_number_of_time_step_clusters(4),
     time_step_size(-1.),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     n_refine_time(0),
@@ -71,6 +76,7 @@ Parameters::Parameters()
     degree(1),
     n_q_points_convective(QuadratureRule::Standard),
     n_q_points_viscous(QuadratureRule::Standard),
+    convective_term_formulation(ConvectiveTermFormulation::Standard),
 
     // viscous term
     IP_factor(1.0),
@@ -121,6 +127,42 @@ Parameters::check() const
     AssertThrow(diffusion_number > 0.0, dealii::ExcMessage("parameter must be defined"));
   }
 
+  if(adaptive_time_stepping)
+  {
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL or
+                  calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
+                dealii::ExcMessage(
+                  "Adaptive time stepping can only be used in combination with CFL condition."));
+
+    AssertThrow(adaptive_time_stepping_limiting_factor >= 1.0,
+                dealii::ExcMessage("Invalid parameter adaptive_time_stepping_limiting_factor."));
+
+    AssertThrow(time_step_size_max > 0.0,
+                dealii::ExcMessage("Invalid parameter time_step_size_max."));
+  }
+
+  if(use_local_time_stepping)
+  {
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL or
+                  calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
+                dealii::ExcMessage(
+                  "Local time stepping can only be used in combination with CFL condition."));
+
+    AssertThrow(adaptive_time_stepping == false,
+                dealii::ExcMessage(
+                  "Local time stepping and adaptive time stepping can not be combined."));
+
+    AssertThrow(max_number_of_time_step_clusters >= 1 and max_number_of_time_step_clusters <= 16,
+                dealii::ExcMessage("Invalid parameter max_number_of_time_step_clusters."));
+
+    AssertThrow(use_combined_operator,
+                dealii::ExcMessage("Local time stepping requires the combined operator."));
+
+    AssertThrow(inverse_mass_operator.implementation_type == InverseMassType::MatrixfreeOperator,
+                dealii::ExcMessage(
+                  "Local time stepping requires the matrix-free inverse mass operator."));
+  }
+
 
   // SPATIAL DISCRETIZATION
   grid.check();
@@ -135,6 +177,22 @@ Parameters::check() const
         "For the combined operator, both convective and viscous terms have to be integrated with the same number of quadrature points."));
   }
 
+  if(convective_term_formulation != ConvectiveTermFormulation::Standard)
+  {
+    AssertThrow(n_q_points_convective == QuadratureRule::Standard and
+                  n_q_points_viscous == QuadratureRule::Standard,
+                dealii::ExcMessage("The split forms of the convective term are evaluated on the "
+                                   "Gauss-Lobatto points and require QuadratureRule::Standard."));
+
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage(
+                  "The split forms of the convective term are only implemented for hypercubes."));
+
+    AssertThrow(inverse_mass_operator.implementation_type == InverseMassType::MatrixfreeOperator,
+                dealii::ExcMessage("The split forms of the convective term require the "
+                                   "matrix-free inverse mass operator."));
+  }
+
   // NUMERICAL PARAMETERS
 }
 
@@ -208,6 +266,26 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   print_parameter(pcout, "Calculation of time step size", calculation_of_time_step_size);
 
+  print_parameter(pcout, "Adaptive time stepping", adaptive_time_stepping);
+
+  if(adaptive_time_stepping)
+  {
+    print_parameter(pcout,
+                    "Adaptive time stepping limiting factor",
+                    adaptive_time_stepping_limiting_factor);
+
+    print_parameter(pcout, "Maximum allowable time step size", time_step_size_max);
+  }
+
+  print_parameter(pcout, "Local time stepping", use_local_time_stepping);
+
+  if(use_local_time_stepping)
+  {
+    print_parameter(pcout,
+                    "Maximum number of time step clusters",
+                    max_number_of_time_step_clusters);
+  }
+
   // maximum number of time steps
   print_parameter(pcout, "Maximum number of time steps", max_number_of_time_steps);
 
@@ -239,6 +317,8 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
   print_parameter(pcout, "Quadrature rule convective term", n_q_points_convective);
   print_parameter(pcout, "Quadrature rule viscous term", n_q_points_viscous);
 
+  print_parameter(pcout, "Convective term formulation", convective_term_formulation);
+
   print_parameter(pcout, "IP factor viscous term", IP_factor);
 }
 
@@ -127,6 +127,27 @@ public:
   // calculation of time step size
   TimeStepCalculation calculation_of_time_step_size;
 
+  // use adaptive time stepping? The time step size is recalculated after every time step
+  // according to the local wave speed |u| + c of the current solution.
+  bool adaptive_time_stepping;
+
+  // This parameter defines by which factor the time step size is allowed to increase from one
+  // time step to the next in case of adaptive time stepping. A decrease of the time step size is
+  // not limited since this would violate the CFL condition.
+  double adaptive_time_stepping_limiting_factor;
+
+  // maximum time step size in case of adaptive time stepping
+  double time_step_size_max;
+
+  // use local time stepping? The cells are grouped into time step clusters according to their
+  // size, where the time step sizes of the clusters differ by powers of two. The time step size
+  // calculated according to the CFL/diffusion condition refers to the cluster with the smallest
+  // cells, and the time step size of the time integrator is the one of the coarsest cluster.
+  bool use_local_time_stepping;
+
+  // maximum number of time step clusters in case of local time stepping
+  unsigned int max_number_of_time_step_clusters;
+
   // user specified time step size:  note that this time_step_size is the first
   // in a series of time_step_size's when performing temporal convergence tests,
   // i.e., delta_t = time_step_size, time_step_size/2, ...
@@ -180,6 +201,10 @@ public:
 
   QuadratureRule n_q_points_convective, n_q_points_viscous;
 
+  // formulation of the convective term. The split forms are evaluated on the Gauss-Lobatto points
+  // and require the standard quadrature rule for both the convective and the viscous term.
+  ConvectiveTermFormulation convective_term_formulation;
+
   // diffusive term: Symmetric interior penalty Galerkin (SIPG) discretization
   // interior penalty parameter scaling factor: default value is 1.0
   double IP_factor;
@@ -195,6 +195,8 @@ Driver<dim, Number>::do_adaptive_refinement()
 
   if(any_cells_flagged_for_coarsening_or_refinement(*grid->triangulation))
   {
+    postprocessor->prepare_coarsening_and_refinement();
+
     grid->triangulation->prepare_coarsening_and_refinement();
 
     if(application->get_parameters().problem_type == ProblemType::Unsteady)
@@ -216,7 +218,8 @@ Driver<dim, Number>::do_adaptive_refinement()
         grid->coarse_triangulations,
         grid->coarse_periodic_face_pairs,
         application->get_parameters().grid,
-        application->get_parameters().amr_data.preserve_boundary_cells);
+        application->get_parameters().amr_data.preserve_boundary_cells,
+        application->get_parameters().degree);
     }
 
     setup_after_coarsening_and_refinement();
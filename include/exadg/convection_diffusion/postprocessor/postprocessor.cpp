@@ -44,11 +44,24 @@ PostProcessor<dim, Number>::setup(Operator<dim, Number> const & pde_operator)
                          *pde_operator.get_mapping(),
                          pp_data.error_data);
 
+  // the mapping is used in the background thread, but changes in every time step for moving meshes
+  AssertThrow(not(pp_data.output_data.write_asynchronously and
+                  pde_operator.get_parameters().ale_formulation),
+              dealii::ExcMessage("Asynchronous output is not supported for moving meshes (ALE)."));
+
   output_generator.setup(pde_operator.get_dof_handler(),
                          *pde_operator.get_mapping(),
                          pp_data.output_data);
 }
 
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::prepare_coarsening_and_refinement()
+{
+  // asynchronous output builds the patches on the current mesh in a background thread
+  output_generator.wait_for_output();
+}
+
 template<int dim, typename Number>
 void
 PostProcessor<dim, Number>::setup_after_coarsening_and_refinement()
@@ -61,6 +61,9 @@ public:
   void
   setup(Operator<dim, Number> const & pde_operator) override;
 
+  void
+  prepare_coarsening_and_refinement() override;
+
   void
   setup_after_coarsening_and_refinement() override;
 
@@ -69,6 +69,13 @@ public:
   virtual void
   setup(Operator<dim, Number> const & pde_operator) = 0;
 
+  /*
+   * In the derived classes, one might need to take some actions before coarsening and refinement,
+   * e.g., complete output that still accesses the old mesh.
+   */
+  virtual void
+  prepare_coarsening_and_refinement() = 0;
+
   /*
    * In the derived classes, one might need to take some actions after coarsening and refinement.
    */
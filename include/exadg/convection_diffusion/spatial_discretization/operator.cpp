@@ -1023,6 +1023,13 @@ Operator<dim, Number>::get_quad_index_overintegration() const
   return matrix_free_data->get_quad_index(field + quad_index_overintegration);
 }
 
+template<int dim, typename Number>
+Parameters const &
+Operator<dim, Number>::get_parameters() const
+{
+  return param;
+}
+
 template<int dim, typename Number>
 std::shared_ptr<dealii::Mapping<dim> const>
 Operator<dim, Number>::get_mapping() const
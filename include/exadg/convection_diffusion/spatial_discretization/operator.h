@@ -285,6 +285,9 @@ public:
   unsigned int
   get_quad_index() const;
 
+  Parameters const &
+  get_parameters() const;
+
   std::shared_ptr<dealii::Mapping<dim> const>
   get_mapping() const;
 
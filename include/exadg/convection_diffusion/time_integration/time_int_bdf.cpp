@@ -430,28 +430,56 @@ template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::read_restart_vectors(BoostInputArchiveType & ia)
 {
-  for(unsigned int i = 0; i < this->order; i++)
+  if(this->restart_data.format == RestartFormat::PartitionIndependent)
   {
-    read_write_distributed_vector(solution[i], ia);
-  }
+    // The vectors are deserialized from the triangulation, which has already been loaded together
+    // with the restart data. The sequence of vectors has to match write_restart_vectors().
+    AssertThrow(this->param.ale_formulation == false,
+                dealii::ExcMessage("RestartFormat::PartitionIndependent is not implemented for "
+                                   "the ALE formulation."));
 
-  if(param.convective_problem() and
-     param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
-  {
-    if(this->param.ale_formulation == false)
+    std::vector<VectorType *> vectors;
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      vectors.push_back(&solution[i]);
+    }
+
+    if(param.convective_problem() and
+       param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        read_write_distributed_vector(vec_convective_term[i], ia);
+        vectors.push_back(&vec_convective_term[i]);
       }
     }
-  }
 
-  if(this->param.ale_formulation)
+    deserialize_vectors<dim, VectorType>({&pde_operator->get_dof_handler()}, {vectors});
+  }
+  else
   {
-    for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+    for(unsigned int i = 0; i < this->order; i++)
     {
-      read_write_distributed_vector(vec_grid_coordinates[i], ia);
+      read_write_distributed_vector(solution[i], ia);
+    }
+
+    if(param.convective_problem() and
+       param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+    {
+      if(this->param.ale_formulation == false)
+      {
+        for(unsigned int i = 0; i < this->order; i++)
+        {
+          read_write_distributed_vector(vec_convective_term[i], ia);
+        }
+      }
+    }
+
+    if(this->param.ale_formulation)
+    {
+      for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+      {
+        read_write_distributed_vector(vec_grid_coordinates[i], ia);
+      }
     }
   }
 }
@@ -460,28 +488,56 @@ template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::write_restart_vectors(BoostOutputArchiveType & oa) const
 {
-  for(unsigned int i = 0; i < this->order; i++)
+  if(this->restart_data.format == RestartFormat::PartitionIndependent)
   {
-    read_write_distributed_vector(solution[i], oa);
-  }
+    AssertThrow(this->param.ale_formulation == false,
+                dealii::ExcMessage("RestartFormat::PartitionIndependent is not implemented for "
+                                   "the ALE formulation."));
 
-  if(param.convective_problem() and
-     param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
-  {
-    if(this->param.ale_formulation == false)
+    std::vector<VectorType const *> vectors;
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      vectors.push_back(&solution[i]);
+    }
+
+    if(param.convective_problem() and
+       param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        read_write_distributed_vector(vec_convective_term[i], oa);
+        vectors.push_back(&vec_convective_term[i]);
       }
     }
-  }
 
-  if(this->param.ale_formulation)
+    serialize_triangulation_and_vectors<dim, VectorType>(this->restart_data.filename,
+                                                         {&pde_operator->get_dof_handler()},
+                                                         {vectors});
+  }
+  else
   {
-    for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+    for(unsigned int i = 0; i < this->order; i++)
     {
-      read_write_distributed_vector(vec_grid_coordinates[i], oa);
+      read_write_distributed_vector(solution[i], oa);
+    }
+
+    if(param.convective_problem() and
+       param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+    {
+      if(this->param.ale_formulation == false)
+      {
+        for(unsigned int i = 0; i < this->order; i++)
+        {
+          read_write_distributed_vector(vec_convective_term[i], oa);
+        }
+      }
+    }
+
+    if(this->param.ale_formulation)
+    {
+      for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+      {
+        read_write_distributed_vector(vec_grid_coordinates[i], oa);
+      }
     }
   }
 }
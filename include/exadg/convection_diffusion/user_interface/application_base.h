@@ -34,6 +34,7 @@
 #include <exadg/grid/grid.h>
 #include <exadg/grid/grid_utilities.h>
 #include <exadg/postprocessor/output_parameters.h>
+#include <exadg/time_integration/restart.h>
 
 namespace ExaDG
 {
@@ -90,6 +91,16 @@ public:
 
     // parameters
     set_parameters();
+
+    // In case of a partition-independent restart, the refinement of the mesh is loaded from the
+    // restart files together with the solution vectors.
+    if(param.restarted_simulation and
+       param.restart_data.format == RestartFormat::PartitionIndependent)
+    {
+      param.grid.serialized_triangulation_file =
+        restart_filename_triangulation(param.restart_data.filename);
+    }
+
     param.check();
     param.print(pcout, "List of parameters:");
 
@@ -23,135 +23,307 @@
 #define EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_LINEAR_ALGEBRA_H_
 
 // C/C++
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <vector>
 
 // deal.II
 #include <deal.II/base/exceptions.h>
 
+// ExaDG
+#include <exadg/solvers_and_preconditioners/utilities/linear_algebra_utilities.h>
+
 namespace ExaDG
 {
 namespace FSI
 {
 /*
- * Own implementation of matrix class.
+ * QR decomposition A = Q R of a matrix A given by its columns, where the columns of Q are
+ * orthonormal and R is upper triangular. The decomposition is updated when inserting or removing
+ * single columns instead of being recomputed from scratch:
+ *
+ * - A new column is orthogonalized against all columns of Q by classical Gram-Schmidt, computing
+ *   all inner products with one global reduction. A second orthogonalization sweep (again one
+ *   global reduction) is only performed in case of cancellation.
+ * - Moving the new column to its position and removing columns is done by Givens rotations, which
+ *   do not require global reductions.
+ *
+ * Columns that are (almost) linearly dependent on the columns in front of them are filtered out,
+ * i.e., the distance of a column a to the span of the columns in front of it has to be at least
+ * eps * ||a||. Each column carries an identifier given by the user, so that the columns that
+ * remain in the decomposition can be identified.
  */
-template<typename Number>
-class Matrix
+template<typename VectorType, typename Number>
+class QRDecomposition
 {
 public:
-  // Constructor.
-  Matrix(unsigned int const size) : M(size)
+  QRDecomposition(Number const eps = 1.e-2) : eps(eps)
   {
-    data.resize(M * M);
+  }
 
-    init();
+  unsigned int
+  n_columns() const
+  {
+    return Q.size();
   }
 
-  void
-  init()
+  unsigned int
+  get_id(unsigned int const i) const
   {
-    for(unsigned int i = 0; i < M; ++i)
-      for(unsigned int j = 0; j < M; ++j)
-        data[i * M + j] = Number(0.0);
+    AssertThrow(i < n_columns(), dealii::ExcMessage("Index exceeds number of columns."));
+
+    return ids[i];
   }
 
+  VectorType const &
+  get_column_of_Q(unsigned int const i) const
+  {
+    AssertThrow(i < n_columns(), dealii::ExcMessage("Index exceeds number of columns."));
+
+    return Q[i];
+  }
+
+  /*
+   * Returns the entry R(i,j) in row i and column j.
+   */
   Number
-  get(unsigned int const i, unsigned int const j) const
+  get_entry_of_R(unsigned int const i, unsigned int const j) const
+  {
+    AssertThrow(i < n_columns() and j < n_columns(),
+                dealii::ExcMessage("Index exceeds number of columns."));
+
+    return R[j][i];
+  }
+
+  /*
+   * Inserts column a with identifier id at the given position, where position refers to the
+   * columns presently contained in the decomposition. Returns false if the column has been filtered
+   * out. Columns behind the inserted column that become (almost) linearly dependent are removed.
+   */
+  bool
+  insert_column(VectorType const & a, unsigned int const id, unsigned int const position)
   {
-    AssertThrow(i < M and j < M, dealii::ExcMessage("Index exceeds matrix dimensions."));
+    unsigned int const n = n_columns();
+
+    AssertThrow(position <= n, dealii::ExcMessage("Position exceeds number of columns."));
+
+    // orthogonalize against all columns of Q
+    VectorType q = a;
+
+    std::vector<double> u = compute_inner_products(Q, q, true);
+
+    double const norm_a_squared = u[n];
+    u.resize(n);
+    subtract_projection(q, u);
+
+    double norm_q_squared = norm_a_squared;
+    for(unsigned int i = 0; i < n; ++i)
+      norm_q_squared -= u[i] * u[i];
 
-    return data[i * M + j];
+    // reorthogonalize in case of cancellation
+    if(norm_q_squared < 0.5 * norm_a_squared)
+    {
+      std::vector<double> h = compute_inner_products(Q, q, true);
+
+      norm_q_squared = h[n];
+      h.resize(n);
+      subtract_projection(q, h);
+
+      for(unsigned int i = 0; i < n; ++i)
+      {
+        norm_q_squared -= h[i] * h[i];
+        u[i] += h[i];
+      }
+    }
+
+    norm_q_squared = std::max(norm_q_squared, 0.0);
+
+    // filter: distance of a to the span of the columns in front of the given position
+    double distance_squared = norm_q_squared;
+    for(unsigned int i = position; i < n; ++i)
+      distance_squared += u[i] * u[i];
+
+    double const norm_a = std::sqrt(norm_a_squared);
+    if(norm_a == 0.0 or std::sqrt(distance_squared) < eps * norm_a)
+      return false;
+
+    // append q as last column of Q and insert (u, ||q||) as column of R at the given position
+    double const norm_q = std::sqrt(norm_q_squared);
+    if(norm_q > 0.0)
+      q *= 1.0 / norm_q;
+    else
+      q = 0.0;
+
+    Q.push_back(q);
+    for(auto & column : R)
+      column.push_back(0.0);
+
+    std::vector<Number> column(u.begin(), u.end());
+    column.push_back(norm_q);
+
+    R.insert(R.begin() + position, column);
+    ids.insert(ids.begin() + position, id);
+    norms.insert(norms.begin() + position, norm_a);
+
+    // eliminate the entries of the new column below the diagonal from the bottom to the top
+    for(unsigned int i = n; i > position; --i)
+      apply_givens_rotation(i - 1, R[position][i - 1], R[position][i]);
+
+    // columns behind might now be linearly dependent on the columns in front of them
+    remove_dependent_columns(position + 1);
+
+    return true;
   }
 
+  /*
+   * Removes the column at the given position.
+   */
   void
-  set(Number const value, unsigned int const i, unsigned int const j)
+  remove_column(unsigned int const position)
   {
-    AssertThrow(i < M and j < M, dealii::ExcMessage("Index exceeds matrix dimensions."));
+    unsigned int const n = n_columns();
+
+    AssertThrow(position < n, dealii::ExcMessage("Position exceeds number of columns."));
 
-    data[i * M + j] = value;
+    R.erase(R.begin() + position);
+    ids.erase(ids.begin() + position);
+    norms.erase(norms.begin() + position);
+
+    // the columns behind have one entry below the diagonal, which is eliminated
+    for(unsigned int j = position; j + 1 < n; ++j)
+      apply_givens_rotation(j, R[j][j], R[j][j + 1]);
+
+    // the last row of R is zero and the last column of Q is not needed anymore
+    Q.pop_back();
+    for(auto & column : R)
+      column.pop_back();
   }
 
-private:
-  // number of rows and columns of matrix
-  unsigned int const  M;
-  std::vector<Number> data;
-};
+  /*
+   * Computes Q^T v with a single global reduction.
+   */
+  std::vector<Number>
+  multiply_by_Q_transpose(VectorType const & v) const
+  {
+    std::vector<double> const result = compute_inner_products(Q, v, false);
 
-template<typename VectorType, typename Number>
-void
-compute_QR_decomposition(std::vector<VectorType> & Q, Matrix<Number> & R, Number const eps = 1.e-2)
-{
-  for(unsigned int i = 0; i < Q.size(); ++i)
+    return std::vector<Number>(result.begin(), result.end());
+  }
+
+  /*
+   * Solves R x = b by backward substitution.
+   */
+  void
+  solve_R(std::vector<Number> & x, std::vector<Number> const & b) const
   {
-    Number const norm_initial = Number(Q[i].l2_norm());
+    int const n = n_columns();
 
-    // orthogonalize
-    for(unsigned int j = 0; j < i; ++j)
+    x.resize(n);
+    for(int i = n - 1; i >= 0; --i)
     {
-      Number r_ji = Q[j] * Q[i];
-      R.set(r_ji, j, i);
-      Q[i].add(-r_ji, Q[j]);
+      double value = b[i];
+      for(int j = i + 1; j < n; ++j)
+        value -= R[j][i] * x[j];
+
+      x[i] = value / R[i][i];
     }
+  }
+
+  /*
+   * Computes the vectors Z with R Z = Q, where Z and Q are understood as column vectors of vectors.
+   */
+  void
+  apply_inverse_R_to_Q(std::vector<VectorType> & Z) const
+  {
+    int const n = n_columns();
 
-    // normalize or drop if linear dependent
-    Number r_ii = Number(Q[i].l2_norm());
-    if(r_ii < eps * norm_initial)
+    Z.resize(n);
+    for(int i = n - 1; i >= 0; --i)
     {
-      Q[i] = 0.0;
-      for(unsigned int j = 0; j < i; ++j)
-        R.set(0.0, j, i);
-      R.set(1.0, i, i);
+      Z[i] = Q[i];
+      for(int j = i + 1; j < n; ++j)
+        Z[i].add(-R[j][i], Z[j]);
+
+      Z[i] *= 1.0 / R[i][i];
     }
-    else
+  }
+
+private:
+  /*
+   * v -= sum_i h_i q_i, fused into one sweep over v.
+   */
+  void
+  subtract_projection(VectorType & v, std::vector<double> const & h) const
+  {
+    unsigned int const local_size = v.locally_owned_size();
+    auto               v_ptr      = v.begin();
+    for(unsigned int k = 0; k < h.size(); ++k)
     {
-      R.set(r_ii, i, i);
-      Q[i] *= 1. / r_ii;
+      auto const q_ptr = Q[k].begin();
+      for(unsigned int i = 0; i < local_size; ++i)
+        v_ptr[i] -= h[k] * q_ptr[i];
     }
   }
-}
-
-/*
- *  Matrix has to be upper triangular with d_ii != 0 for all 0 <= i < n
- */
-template<typename Number>
-void
-backward_substitution(Matrix<Number> const &      matrix,
-                      std::vector<Number> &       dst,
-                      std::vector<Number> const & rhs)
-{
-  int const n = dst.size();
 
-  for(int i = n - 1; i >= 0; --i)
+  /*
+   * Applies a Givens rotation to the rows i and i+1 of R that eliminates b = R(i+1,j) against
+   * a = R(i,j), and the transposed rotation to the columns i and i+1 of Q.
+   */
+  void
+  apply_givens_rotation(unsigned int const i, Number const a, Number const b)
   {
-    double value = rhs[i];
-    for(int j = i + 1; j < n; ++j)
+    Number const r = std::sqrt(a * a + b * b);
+    if(r == Number(0.0))
+      return;
+
+    Number const c = a / r;
+    Number const s = b / r;
+
+    for(auto & column : R)
     {
-      value -= matrix.get(i, j) * dst[j];
+      Number const x = column[i];
+      Number const y = column[i + 1];
+      column[i]      = c * x + s * y;
+      column[i + 1]  = -s * x + c * y;
     }
 
-    dst[i] = value / matrix.get(i, i);
+    unsigned int const local_size = Q[i].locally_owned_size();
+    auto               q0_ptr     = Q[i].begin();
+    auto               q1_ptr     = Q[i + 1].begin();
+    for(unsigned int l = 0; l < local_size; ++l)
+    {
+      auto const x = q0_ptr[l];
+      auto const y = q1_ptr[l];
+      q0_ptr[l]    = c * x + s * y;
+      q1_ptr[l]    = -s * x + c * y;
+    }
   }
-}
 
-template<typename Number, typename VectorType>
-void
-backward_substitution_multiple_rhs(Matrix<Number> const &          matrix,
-                                   std::vector<VectorType> &       dst,
-                                   std::vector<VectorType> const & rhs)
-{
-  int const n = dst.size();
-
-  for(int i = n - 1; i >= 0; --i)
+  void
+  remove_dependent_columns(unsigned int const first)
   {
-    VectorType value = rhs[i];
-    for(int j = i + 1; j < n; ++j)
+    for(unsigned int j = first; j < n_columns();)
     {
-      value.add(-matrix.get(i, j), dst[j]);
+      if(std::abs(R[j][j]) < eps * norms[j])
+        remove_column(j);
+      else
+        ++j;
     }
-
-    dst[i].equ(1.0 / matrix.get(i, i), value);
   }
-}
+
+  Number const eps;
+
+  // columns of Q
+  std::vector<VectorType> Q;
+
+  // columns of R, where the number of rows equals the number of columns of Q
+  std::vector<std::vector<Number>> R;
+
+  // identifiers and norms of the columns of A
+  std::vector<unsigned int> ids;
+  std::vector<double>       norms;
+};
 
 template<typename VectorType>
 void
@@ -172,10 +344,9 @@ inv_jacobian_times_residual(VectorType &
     std::shared_ptr<std::vector<VectorType>> R = R_history[idx];
     std::shared_ptr<std::vector<VectorType>> Z = Z_history[idx];
 
-    int const           k = Z->size();
-    std::vector<double> Z_times_a(k, 0.0);
-    for(int i = 0; i < k; ++i)
-      Z_times_a[i] = (*Z)[i] * a;
+    // all inner products of one time step with a single global reduction
+    int const                 k         = Z->size();
+    std::vector<double> const Z_times_a = compute_inner_products(*Z, a, false);
 
     // add to b
     for(int i = 0; i < k; ++i)
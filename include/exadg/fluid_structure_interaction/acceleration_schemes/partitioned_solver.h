@@ -314,6 +314,27 @@ PartitionedSolver<dim, Number>::solve(
     unsigned int const q = parameters.reused_time_steps;
     unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
 
+    // The columns of the reused time steps are referenced instead of being copied. Their index in
+    // the following vectors serves as identifier in the QR decomposition, the columns of the
+    // present time step are identified by the subsequent indices.
+    std::vector<VectorType const *> D_reused, R_reused;
+    for(auto const & D_q : D_history)
+      for(auto const & delta_d : *D_q)
+        D_reused.push_back(&delta_d);
+    for(auto const & R_q : R_history)
+      for(auto const & delta_r : *R_q)
+        R_reused.push_back(&delta_r);
+
+    AssertThrow(D_reused.size() == R_reused.size(),
+                dealii::ExcMessage("D, R vectors must have same size."));
+
+    // The QR decomposition of [R, R_reused] is updated incrementally: the columns of the reused
+    // time steps are inserted once per time step and the column of the present iteration is
+    // inserted behind the columns of the previous iterations, i.e., in front of the reused columns.
+    QRDecomposition<VectorType, Number> qr;
+    bool                                qr_initialized    = false;
+    unsigned int                        n_columns_present = 0;
+
     bool converged = false;
     while(not(converged) and k < parameters.partitioned_iter_max)
     {
@@ -340,6 +361,14 @@ PartitionedSolver<dim, Number>::solve(
         }
         else
         {
+          if(not qr_initialized)
+          {
+            for(unsigned int i = 0; i < R_reused.size(); ++i)
+              qr.insert_column(*R_reused[i], i, qr.n_columns());
+
+            qr_initialized = true;
+          }
+
           if(k >= 1)
           {
             // append D, R matrices
@@ -350,40 +379,32 @@ PartitionedSolver<dim, Number>::solve(
             VectorType delta_r = r;
             delta_r.add(-1.0, r_old);
             R->push_back(delta_r);
-          }
 
-          // fill vectors (including reuse)
-          std::vector<VectorType> Q = *R;
-          for(auto R_q : R_history)
-            for(auto delta_r : *R_q)
-              Q.push_back(delta_r);
-          std::vector<VectorType> D_all = *D;
-          for(auto D_q : D_history)
-            for(auto delta_d : *D_q)
-              D_all.push_back(delta_d);
-
-          AssertThrow(D_all.size() == Q.size(),
-                      dealii::ExcMessage("D, Q vectors must have same size."));
+            // update QR-decomposition
+            if(qr.insert_column(R->back(), R_reused.size() + R->size() - 1, n_columns_present))
+              ++n_columns_present;
+          }
 
-          unsigned int const k_all = Q.size();
+          unsigned int const k_all = R->size() + R_reused.size();
           if(k_all >= 1)
           {
-            // compute QR-decomposition
-            Matrix<Number> U(k_all);
-            compute_QR_decomposition(Q, U);
-
-            std::vector<Number> rhs(k_all, 0.0);
-            for(unsigned int i = 0; i < k_all; ++i)
-              rhs[i] = -Number(Q[i] * r);
+            // rhs = - Q^T r
+            std::vector<Number> rhs = qr.multiply_by_Q_transpose(r);
+            for(auto & value : rhs)
+              value = -value;
 
             // alpha = U^{-1} rhs
-            std::vector<Number> alpha(k_all, 0.0);
-            backward_substitution(U, alpha, rhs);
+            std::vector<Number> alpha;
+            qr.solve_R(alpha, rhs);
 
-            // d_{k+1} = d_tilde_{k} + delta d_tilde
+            // d_{k+1} = d_tilde_{k} + delta d_tilde, where columns filtered out of the QR
+            // decomposition do not contribute
             d = d_tilde;
-            for(unsigned int i = 0; i < k_all; ++i)
-              d.add(alpha[i], D_all[i]);
+            for(unsigned int i = 0; i < qr.n_columns(); ++i)
+            {
+              unsigned int const id = qr.get_id(i);
+              d.add(alpha[i], id < D_reused.size() ? *D_reused[id] : (*D)[id - D_reused.size()]);
+            }
           }
           else // despite reuse, the vectors might be empty
           {
@@ -433,8 +454,8 @@ PartitionedSolver<dim, Number>::solve(
     structure->pde_operator->initialize_dof_vector(b);
     structure->pde_operator->initialize_dof_vector(b_old);
 
-    std::shared_ptr<Matrix<Number>> U;
-    std::vector<VectorType>         Q;
+    // QR decomposition of R, updated incrementally in every iteration
+    QRDecomposition<VectorType, Number> qr;
 
     unsigned int const q = parameters.reused_time_steps;
     unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
@@ -487,21 +508,21 @@ PartitionedSolver<dim, Number>::solve(
             delta_b.add(-1.0, b);
             B.push_back(delta_b);
 
-            // compute QR-decomposition
-            U = std::make_shared<Matrix<Number>>(k);
-            Q = *R;
-            compute_QR_decomposition(Q, *U);
+            // update QR-decomposition
+            qr.insert_column(R->back(), R->size() - 1, qr.n_columns());
 
-            std::vector<Number> rhs(k, 0.0);
-            for(unsigned int i = 0; i < k; ++i)
-              rhs[i] = -Number(Q[i] * r);
+            // rhs = - Q^T r
+            std::vector<Number> rhs = qr.multiply_by_Q_transpose(r);
+            for(auto & value : rhs)
+              value = -value;
 
             // alpha = U^{-1} rhs
-            std::vector<Number> alpha(k, 0.0);
-            backward_substitution(*U, alpha, rhs);
+            std::vector<Number> alpha;
+            qr.solve_R(alpha, rhs);
 
-            for(unsigned int i = 0; i < k; ++i)
-              d.add(alpha[i], B[i]);
+            // columns filtered out of the QR decomposition do not contribute
+            for(unsigned int i = 0; i < qr.n_columns(); ++i)
+              d.add(alpha[i], B[qr.get_id(i)]);
           }
         }
 
@@ -529,11 +550,18 @@ PartitionedSolver<dim, Number>::solve(
     if(R_history.size() > q)
       R_history.erase(R_history.begin());
 
-    // compute Z and add to Z_history
+    // compute Z and add to Z_history, where Z has the same number of columns as R and columns
+    // filtered out of the QR decomposition do not contribute
     std::shared_ptr<std::vector<VectorType>> Z;
-    Z  = std::make_shared<std::vector<VectorType>>();
-    *Z = Q; // make sure that Z has correct size
-    backward_substitution_multiple_rhs(*U, *Z, Q);
+    Z = std::make_shared<std::vector<VectorType>>(R->size());
+    for(auto & z : *Z)
+      structure->pde_operator->initialize_dof_vector(z);
+
+    std::vector<VectorType> Z_qr;
+    qr.apply_inverse_R_to_Q(Z_qr);
+    for(unsigned int i = 0; i < qr.n_columns(); ++i)
+      (*Z)[qr.get_id(i)].swap(Z_qr[i]);
+
     Z_history.push_back(Z);
     if(Z_history.size() > q)
       Z_history.erase(Z_history.begin());
@@ -22,7 +22,18 @@
 #ifndef EXADG_GRID_BALANCED_GRANULARITY_PARTITION_POLICY_H_
 #define EXADG_GRID_BALANCED_GRANULARITY_PARTITION_POLICY_H_
 
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
 // deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
 #include <deal.II/distributed/fully_distributed_tria.h>
 
 namespace ExaDG
@@ -31,14 +42,28 @@ namespace ExaDG
  * A class to use for the deal.II coarsening functionality, where we try to
  * balance the mesh coarsening with a minimum granularity and the number of
  * partitions on coarser levels.
+ *
+ * The grain size, i.e., the minimal number of cells per MPI process, is either
+ * prescribed or, if a grain size of 0 is specified, chosen automatically for
+ * every level. In the latter case, the number of MPI processes per level is
+ * chosen such that the time of a level-operator evaluation predicted by a
+ * simple cost model becomes minimal. The model consists of the compute time of
+ * the most loaded process, which is proportional to the number of degrees of
+ * freedom per process for the polynomial degree of the level operators, and
+ * the communication latency, which grows with the logarithm of the number of
+ * processes as for a tree-based reduction. Since the model does not rely on
+ * measurements, the partitioning is reproducible and identical on all
+ * processes.
  */
 template<int dim, int spacedim = dim>
 class BalancedGranularityPartitionPolicy
   : public dealii::RepartitioningPolicyTools::Base<dim, spacedim>
 {
 public:
-  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes)
-    : n_mpi_processes_per_level{n_mpi_processes}
+  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes,
+                                     unsigned int const grain_size = 200,
+                                     unsigned int const degree     = 1)
+    : n_mpi_processes_per_level{n_mpi_processes}, grain_size(grain_size), degree(degree)
   {
   }
 
@@ -49,14 +74,15 @@ public:
   {
     dealii::types::global_cell_index const n_cells = tria_coarse_in.n_global_active_cells();
 
-    // TODO: We hard-code a grain-size limit of 200 cells per processor
-    // (assuming linear finite elements and typical behavior of
-    // supercomputers). In case we have fewer cells on the fine level, we do
-    // not immediately go to 200 cells per rank, but limit the growth by a
-    // factor of 8, which limits makes sure that we do not create too many
-    // messages for individual MPI processes.
+    unsigned int const grain_size_level =
+      grain_size > 0 ? grain_size : compute_optimal_grain_size(tria_coarse_in);
+
+    // In case we have fewer cells on the fine level, we do not immediately go
+    // to the specified grain size, but limit the growth by a factor of 8,
+    // which makes sure that we do not create too many messages for
+    // individual MPI processes.
     unsigned int const grain_size_limit =
-      std::min<unsigned int>(200, 8 * n_cells / n_mpi_processes_per_level.back() + 1);
+      std::min<unsigned int>(grain_size_level, 8 * n_cells / n_mpi_processes_per_level.back() + 1);
 
     dealii::RepartitioningPolicyTools::MinimalGranularityPolicy<dim, spacedim> partitioning_policy(
       grain_size_limit);
@@ -66,11 +92,101 @@ public:
     // The vector 'partitions' contains the partition numbers. To get the
     // number of partitions, we take the infinity norm.
     n_mpi_processes_per_level.push_back(static_cast<unsigned int>(partitions.linfty_norm()) + 1);
+    n_cells_per_level.push_back(n_cells);
+    grain_size_per_level.push_back(grain_size_limit);
+
     return partitions;
   }
 
+  /**
+   * Prints the number of cells, the grain size, and the number of MPI
+   * processes for all levels partitioned by this policy, starting with the
+   * finest of the coarse levels.
+   */
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    pcout << std::endl << "Partitioning of coarse triangulations:" << std::endl;
+
+    if(grain_size == 0)
+    {
+      // format into a local stream in order to not alter the format flags of pcout
+      std::ostringstream stream;
+      stream << std::scientific << std::setprecision(2);
+      stream << "  Cost model (degree " << degree << "): time per cell = " << get_time_per_cell()
+             << " s, latency per communication stage = " << latency_per_stage << " s"
+             << std::endl;
+      pcout << stream.str();
+    }
+
+    for(unsigned int level = 0; level < n_cells_per_level.size(); ++level)
+    {
+      pcout << "  coarse level " << std::setw(2) << level + 1 << ": cells = " << std::setw(10)
+            << n_cells_per_level[level] << ", grain size = " << std::setw(6)
+            << grain_size_per_level[level] << ", MPI processes = " << std::setw(6)
+            << n_mpi_processes_per_level[level + 1] << std::endl;
+    }
+  }
+
 private:
+  /**
+   * Returns the grain size that minimizes the predicted time of an operator
+   * evaluation on a level with the number of cells of the given triangulation.
+   */
+  unsigned int
+  compute_optimal_grain_size(dealii::Triangulation<dim, spacedim> const & tria) const
+  {
+    double const n_cells = static_cast<double>(tria.n_global_active_cells());
+
+    unsigned int const n_processes =
+      dealii::Utilities::MPI::n_mpi_processes(tria.get_mpi_communicator());
+
+    unsigned int n_processes_optimal = 1;
+    double       time_optimal        = std::numeric_limits<double>::max();
+    for(unsigned int n = 1; n <= n_processes and n <= n_cells; ++n)
+    {
+      double const time = get_time_per_cell() * std::ceil(n_cells / n) +
+                          latency_per_stage * std::ceil(std::log2(static_cast<double>(n)));
+      if(time < time_optimal)
+      {
+        time_optimal        = time;
+        n_processes_optimal = n;
+      }
+    }
+
+    return std::max(1u, static_cast<unsigned int>(std::ceil(n_cells / n_processes_optimal)));
+  }
+
+  /**
+   * Returns the predicted compute time per cell of a level-operator
+   * evaluation, assuming a constant throughput per degree of freedom as
+   * obtained for sum-factorization kernels.
+   */
+  double
+  get_time_per_cell() const
+  {
+    return time_per_dof * dealii::Utilities::pow(degree + 1, dim);
+  }
+
+  // compute time per degree of freedom of a matrix-free operator evaluation on one process, i.e.,
+  // a throughput of 1e8 degrees of freedom per second
+  static constexpr double time_per_dof = 1.0e-8;
+
+  // latency of one stage of the communication (ghost value exchange, global reduction) including
+  // the software overhead
+  static constexpr double latency_per_stage = 1.0e-5;
+
   mutable std::vector<unsigned int> n_mpi_processes_per_level;
+
+  mutable std::vector<dealii::types::global_cell_index> n_cells_per_level;
+
+  mutable std::vector<unsigned int> grain_size_per_level;
+
+  // prescribed grain size, or 0 if the grain size is chosen automatically
+  unsigned int const grain_size;
+
+  // polynomial degree of the multigrid level operators, used by the cost model
+  unsigned int const degree;
 };
 } // namespace ExaDG
 
@@ -92,7 +92,9 @@ struct GridData
       partitioning_type(PartitioningType::Metis),
       n_refine_global(0),
       file_name(),
-      create_coarse_triangulations(false)
+      serialized_triangulation_file(),
+      create_coarse_triangulations(false),
+      coarse_triangulations_grain_size(200)
   {
   }
 
@@ -116,7 +118,24 @@ struct GridData
     if(not file_name.empty())
       print_parameter(pcout, "Grid file name", file_name);
 
+    if(not serialized_triangulation_file.empty())
+      print_parameter(pcout, "Serialized triangulation", serialized_triangulation_file);
+
     print_parameter(pcout, "Create coarse triangulations", create_coarse_triangulations);
+
+    if(create_coarse_triangulations and triangulation_type == TriangulationType::Distributed)
+    {
+      if(coarse_triangulations_grain_size > 0)
+      {
+        print_parameter(pcout,
+                        "Grain size coarse triangulations",
+                        coarse_triangulations_grain_size);
+      }
+      else
+      {
+        print_parameter(pcout, "Grain size coarse triangulations", "automatic");
+      }
+    }
   }
 
   TriangulationType triangulation_type;
@@ -133,6 +152,13 @@ struct GridData
   // deduce the correct type of the file format
   std::string file_name;
 
+  // path to a triangulation serialized via dealii::parallel::distributed::Triangulation::save()
+  // If not empty, the coarse mesh is still created by the user-provided lambda function, but the
+  // refinement of the mesh (and data attached to the triangulation, e.g. in case of a restart) is
+  // loaded from this file instead of performing global and local refinements. This is currently
+  // only supported for TriangulationType::Distributed.
+  std::string serialized_triangulation_file;
+
   // In case of a hypercube mesh that is globally refined, i.e. without hanging nodes, the fine
   // triangulation can be used for all multigrid h-levels without the need to create coarse
   // triangulations explicitly. Hence, this parameter is typically set to false for globally-refined
@@ -143,6 +169,12 @@ struct GridData
   // This parameter needs to be set to true if one wants to use h-multigrid methods for
   // locally-refined hypercube meshes or non-hypercube meshes.
   bool create_coarse_triangulations;
+
+  // Minimal number of cells per MPI process for the coarse triangulations created automatically
+  // for TriangulationType::Distributed (see BalancedGranularityPartitionPolicy). If set to 0, the
+  // grain size is chosen per level based on a cost model of the level-operator evaluation for the
+  // polynomial degree of the operator.
+  unsigned int coarse_triangulations_grain_size;
 };
 
 } // namespace ExaDG
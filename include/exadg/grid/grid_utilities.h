@@ -178,6 +178,10 @@ create_triangulation(
   if(data.triangulation_type == TriangulationType::Serial)
   {
     AssertDimension(dealii::Utilities::MPI::n_mpi_processes(mpi_comm), 1);
+    AssertThrow(data.serialized_triangulation_file.empty(),
+                dealii::ExcMessage("Loading a serialized triangulation is currently only "
+                                   "supported for TriangulationType::Distributed."));
+
     triangulation = std::make_shared<dealii::Triangulation<dim>>(mesh_smoothing);
 
     lambda_create_triangulation(*triangulation,
@@ -195,18 +199,36 @@ create_triangulation(
         dealii::parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy;
     }
 
-    triangulation =
+    auto tria_distributed =
       std::make_shared<dealii::parallel::distributed::Triangulation<dim>>(mpi_comm,
                                                                           mesh_smoothing,
                                                                           distributed_settings);
+    triangulation = tria_distributed;
 
-    lambda_create_triangulation(*triangulation,
-                                periodic_face_pairs,
-                                global_refinements,
-                                vector_local_refinements);
+    if(data.serialized_triangulation_file.empty())
+    {
+      lambda_create_triangulation(*triangulation,
+                                  periodic_face_pairs,
+                                  global_refinements,
+                                  vector_local_refinements);
+    }
+    else
+    {
+      // create the coarse mesh only, the refinement is loaded from file
+      lambda_create_triangulation(*triangulation,
+                                  periodic_face_pairs,
+                                  0 /* global_refinements */,
+                                  std::vector<unsigned int>(vector_local_refinements.size(), 0));
+
+      tria_distributed->load(data.serialized_triangulation_file);
+    }
   }
   else if(data.triangulation_type == TriangulationType::FullyDistributed)
   {
+    AssertThrow(data.serialized_triangulation_file.empty(),
+                dealii::ExcMessage("Loading a serialized triangulation is currently only "
+                                   "supported for TriangulationType::Distributed."));
+
     auto const serial_grid_generator = [&](dealii::Triangulation<dim, dim> & tria_serial) {
       lambda_create_triangulation(tria_serial,
                                   periodic_face_pairs,
@@ -275,6 +297,9 @@ create_triangulation(
  * We have to distinguish between traingulation types, since for the case of a fully distributed
  * triangulation, one cannot coarse triangulations automatically. Instead, the lambda function
  * `lambda_create_coarse_triangulation()` is used together with the `vector_local_refinemetns`.
+ *
+ * The polynomial degree of the multigrid operators is only used to choose the number of MPI
+ * processes per coarse level if GridData::coarse_triangulations_grain_size is set to 0.
  */
 template<int dim>
 inline void
@@ -283,7 +308,8 @@ create_coarse_triangulations_automatically_from_fine_triangulation(
   PeriodicFacePairs<dim> const &                                   fine_periodic_face_pairs,
   std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> & coarse_triangulations_const,
   std::vector<PeriodicFacePairs<dim>> &                            coarse_periodic_face_pairs,
-  GridData const &                                                 data)
+  GridData const &                                                 data,
+  unsigned int const                                               degree)
 {
   // In case of a serial or distributed triangulation, deal.II can automatically generate the
   // coarse triangulations.
@@ -310,11 +336,23 @@ create_coarse_triangulations_automatically_from_fine_triangulation(
       dealii::ExcMessage(
         "dealii::parallel::distributed::Triangulation does not support simplicial elements."));
 
+    MPI_Comm const mpi_comm = fine_triangulation.get_mpi_communicator();
+
+    BalancedGranularityPartitionPolicy<dim> const partition_policy(
+      dealii::Utilities::MPI::n_mpi_processes(mpi_comm),
+      data.coarse_triangulations_grain_size,
+      degree);
+
     coarse_triangulations_const =
       dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
-        fine_triangulation,
-        BalancedGranularityPartitionPolicy<dim>(
-          dealii::Utilities::MPI::n_mpi_processes(fine_triangulation.get_mpi_communicator())));
+        fine_triangulation, partition_policy);
+
+    if(data.coarse_triangulations_grain_size == 0)
+    {
+      dealii::ConditionalOStream pcout(std::cout,
+                                       dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+      partition_policy.print(pcout);
+    }
   }
   else
   {
@@ -441,7 +479,8 @@ create_coarse_triangulations(
                      PeriodicFacePairs<dim> &,
                      unsigned int const,
                      std::vector<unsigned int> const &)> const &   lambda_create_triangulation,
-  std::vector<unsigned int> const                                  vector_local_refinements)
+  std::vector<unsigned int> const                                  vector_local_refinements,
+  unsigned int const                                               degree)
 {
   // In case of a serial or distributed triangulation, deal.II can automatically generate the
   // coarse triangulations, otherwise, the coarse triangulations have to be explicitily created
@@ -453,7 +492,8 @@ create_coarse_triangulations(
                                                                        fine_periodic_face_pairs,
                                                                        coarse_triangulations_const,
                                                                        coarse_periodic_face_pairs,
-                                                                       data);
+                                                                       data,
+                                                                       degree);
   }
   else if(data.triangulation_type == TriangulationType::FullyDistributed)
   {
@@ -501,7 +541,8 @@ create_triangulation(
 /**
  * This function creates both the fine triangulation and, if needed, the coarse triangulations
  * required for certain geometric coarsening sequences in multigrid. In addition to the functions
- * above, this function exists in order to provide a simple interface for applications.
+ * above, this function exists in order to provide a simple interface for applications. The
+ * argument degree is the polynomial degree of the operator to which multigrid is applied.
  */
 template<int dim>
 inline void
@@ -510,6 +551,7 @@ create_triangulation_with_multigrid(
   MPI_Comm const &                                               mpi_comm,
   GridData const &                                               data,
   bool const                                                     involves_h_multigrid,
+  unsigned int const                                             degree,
   std::function<void(dealii::Triangulation<dim> &,
                      PeriodicFacePairs<dim> &,
                      unsigned int const,
@@ -555,7 +597,8 @@ create_triangulation_with_multigrid(
                                                   grid.coarse_periodic_face_pairs,
                                                   data,
                                                   lambda_create_triangulation,
-                                                  vector_local_refinements);
+                                                  vector_local_refinements,
+                                                  degree);
     }
   }
   else
@@ -579,7 +622,8 @@ create_coarse_triangulations_after_coarsening_and_refinement(
   std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> & coarse_triangulations_const,
   std::vector<PeriodicFacePairs<dim>> &                            coarse_periodic_face_pairs,
   GridData const &                                                 data,
-  bool const                                                       amr_preserves_boundary_cells)
+  bool const                                                       amr_preserves_boundary_cells,
+  unsigned int const                                               degree)
 {
   if(data.triangulation_type == TriangulationType::Serial or
      data.triangulation_type == TriangulationType::Distributed)
@@ -597,7 +641,8 @@ create_coarse_triangulations_after_coarsening_and_refinement(
                                                                        fine_periodic_face_pairs,
                                                                        coarse_triangulations_const,
                                                                        coarse_periodic_face_pairs,
-                                                                       data);
+                                                                       data,
+                                                                       degree);
   }
   else if(data.triangulation_type == TriangulationType::FullyDistributed)
   {
@@ -22,7 +22,6 @@
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/linear_interpolation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
-#include <exadg/postprocessor/solution_interpolation.h>
 
 namespace ExaDG
 {
@@ -42,9 +41,6 @@ InflowDataCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_han
 {
   dof_handler_velocity = &dof_handler_velocity_in;
   mapping              = &mapping_in;
-
-  array_dof_indices_and_shape_values.resize(inflow_data.n_points_y * inflow_data.n_points_z);
-  array_counter.resize(inflow_data.n_points_y * inflow_data.n_points_z);
 }
 
 template<int dim, typename Number>
@@ -57,6 +53,8 @@ InflowDataCalculator<dim, Number>::calculate(
     // initial data: do this expensive step only once at the beginning of the simulation
     if(inflow_data_has_been_initialized == false)
     {
+      std::vector<dealii::Point<dim>> points(inflow_data.n_points_y * inflow_data.n_points_z);
+
       for(unsigned int iy = 0; iy < inflow_data.n_points_y; ++iy)
       {
         for(unsigned int iz = 0; iz < inflow_data.n_points_z; ++iz)
@@ -84,67 +82,22 @@ InflowDataCalculator<dim, Number>::calculate(
             AssertThrow(false, dealii::ExcMessage("Not implemented."));
           }
 
-          unsigned int array_index = iy * inflow_data.n_points_z + iz;
-
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            *mapping, dof_handler_velocity->get_triangulation(), point, 1.e-10);
-
-          array_dof_indices_and_shape_values[array_index] = get_dof_indices_and_shape_values(
-            adjacent_cells, *dof_handler_velocity, *mapping, velocity);
+          points[iy * inflow_data.n_points_z + iz] = point;
         }
       }
 
-      inflow_data_has_been_initialized = true;
-    }
-
-    // evaluate velocity in all points of the 2d grid
-    for(unsigned int iy = 0; iy < inflow_data.n_points_y; ++iy)
-    {
-      for(unsigned int iz = 0; iz < inflow_data.n_points_z; ++iz)
-      {
-        // determine the array index, will be needed several times below
-        unsigned int array_index = iy * inflow_data.n_points_z + iz;
-
-        // initialize with zeros since we accumulate into these variables
-        (*inflow_data.array)[array_index] = 0.0;
-        array_counter[array_index]        = 0;
-
-        auto & vector(array_dof_indices_and_shape_values[array_index]);
+      point_evaluator.setup(points, dof_handler_velocity->get_triangulation(), *mapping);
 
-        // loop over all adjacent, locally owned cells for the current point
-        for(auto iter = vector.begin(); iter != vector.end(); ++iter)
-        {
-          // increment counter (because this is a locally owned cell)
-          array_counter[array_index] += 1;
-
-          // interpolate solution using the precomputed shape values and the global dof index
-          dealii::Tensor<1, dim, Number> velocity_value = Interpolator<1, dim, Number>::value(
-            *dof_handler_velocity, velocity, iter->first, iter->second);
-
-          // add result to array with velocity inflow data
-          (*inflow_data.array)[array_index] += velocity_value;
-        }
-      }
+      inflow_data_has_been_initialized = true;
     }
 
-    // sum over all processors
-    dealii::Utilities::MPI::sum(array_counter, mpi_comm, array_counter);
-    dealii::Utilities::MPI::sum(
-      dealii::ArrayView<double const>(&(*inflow_data.array)[0][0], dim * inflow_data.array->size()),
-      mpi_comm,
-      dealii::ArrayView<double>(&(*inflow_data.array)[0][0], dim * inflow_data.array->size()));
+    // evaluate velocity in all points of the 2d grid (averaged over all adjacent cells for a
+    // given point, and zero for points that have not been found)
+    std::vector<dealii::Tensor<1, dim, Number>> const values =
+      point_evaluator.template evaluate<dim>(*dof_handler_velocity, velocity);
 
-    // divide by counter in order to get the mean value (averaged over all
-    // adjacent cells for a given point)
-    for(unsigned int iy = 0; iy < inflow_data.n_points_y; ++iy)
-    {
-      for(unsigned int iz = 0; iz < inflow_data.n_points_z; ++iz)
-      {
-        unsigned int array_index = iy * inflow_data.n_points_z + iz;
-        if(array_counter[array_index] >= 1)
-          (*inflow_data.array)[array_index] /= Number(array_counter[array_index]);
-      }
-    }
+    for(unsigned int i = 0; i < values.size(); ++i)
+      (*inflow_data.array)[i] = values[i];
   }
 }
 
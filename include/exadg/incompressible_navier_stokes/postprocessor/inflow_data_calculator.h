@@ -30,6 +30,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/postprocessor/solution_interpolation.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -116,11 +117,8 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>
-    array_dof_indices_and_shape_values;
-
-  std::vector<unsigned int> array_counter;
+  // all processes need the inflow data and, therefore, evaluate all points
+  PointEvaluator<dim> point_evaluator;
 };
 
 } // namespace IncNS
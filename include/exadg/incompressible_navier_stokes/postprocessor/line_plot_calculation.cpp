@@ -24,7 +24,6 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation.h>
-#include <exadg/postprocessor/solution_interpolation.h>
 #include <exadg/utilities/create_directories.h>
 
 namespace ExaDG
@@ -52,7 +51,32 @@ LinePlotCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handl
   time_control.setup(line_plot_data_in.time_control_data);
 
   if(line_plot_data_in.time_control_data.is_active)
+  {
     create_directories(line_plot_data_in.directory, mpi_comm);
+
+    // we consider straight lines with an equidistant distribution of points along the line
+    points.resize(data.lines.size());
+    for(unsigned int l = 0; l < data.lines.size(); ++l)
+    {
+      Line<dim> const & line = *data.lines[l];
+      for(unsigned int i = 0; i < line.n_points; ++i)
+      {
+        double const fraction = double(i) / double(line.n_points - 1);
+        points[l].push_back(line.begin + fraction * (line.end - line.begin));
+      }
+    }
+
+    // only the root process writes the results to file and therefore needs the point values
+    std::vector<dealii::Point<dim>> evaluation_points;
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      for(auto const & points_line : points)
+        evaluation_points.insert(evaluation_points.end(), points_line.begin(), points_line.end());
+
+    point_evaluator.setup(evaluation_points,
+                          dof_handler_velocity->get_triangulation(),
+                          *mapping,
+                          data.update_points_before_evaluation);
+  }
 }
 
 template<int dim, typename Number>
@@ -63,42 +87,48 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
   // precision
   unsigned int const precision = data.precision;
 
+  // evaluate the solution in all points of all lines at once (point values are only available on
+  // the root process)
+  bool evaluate_velocity = false, evaluate_pressure = false;
+  for(auto const & line : data.lines)
+  {
+    for(auto const & quantity : line->quantities)
+    {
+      if(quantity->type == QuantityType::Velocity)
+        evaluate_velocity = true;
+      else if(quantity->type == QuantityType::Pressure)
+        evaluate_pressure = true;
+    }
+  }
+
+  std::vector<dealii::Tensor<1, dim, Number>> velocity_values;
+  if(evaluate_velocity)
+    velocity_values = point_evaluator.template evaluate<dim>(*dof_handler_velocity, velocity);
+
+  std::vector<Number> pressure_values;
+  if(evaluate_pressure)
+    pressure_values = point_evaluator.template evaluate<1>(*dof_handler_pressure, pressure);
+
+  AssertThrow(point_evaluator.all_points_found(), dealii::ExcMessage("No points found."));
+
   // loop over all lines
-  for(typename std::vector<std::shared_ptr<Line<dim>>>::const_iterator line = data.lines.begin();
-      line != data.lines.end();
-      ++line)
+  unsigned int offset = 0;
+  for(unsigned int l = 0; l < data.lines.size(); ++l)
   {
-    // store all points along current line in a vector
-    unsigned int                    n_points = (*line)->n_points;
-    std::vector<dealii::Point<dim>> points(n_points);
+    auto const & line = data.lines[l];
 
-    // we consider straight lines with an equidistant distribution of points along the line
-    for(unsigned int i = 0; i < n_points; ++i)
-      points[i] =
-        (*line)->begin + double(i) / double(n_points - 1) * ((*line)->end - (*line)->begin);
+    unsigned int const n_points = line->n_points;
 
     // filename prefix for current line
-    std::string filename_prefix = data.directory + (*line)->name;
+    std::string filename_prefix = data.directory + line->name;
 
     // write output for all specified quantities
-    for(std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
+    for(std::vector<std::shared_ptr<Quantity>>::const_iterator quantity = line->quantities.begin();
+        quantity != line->quantities.end();
         ++quantity)
     {
       if((*quantity)->type == QuantityType::Velocity)
       {
-        std::vector<dealii::Tensor<1, dim, Number>> solution_vector(n_points);
-
-        // calculate velocity for all points along line
-        for(unsigned int i = 0; i < n_points; ++i)
-        {
-          dealii::Tensor<1, dim, Number> u;
-          evaluate_vectorial_quantity_in_point(
-            u, *dof_handler_velocity, *mapping, velocity, points[i], mpi_comm);
-          solution_vector[i] = u;
-        }
-
         // write output to file
         if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
         {
@@ -130,9 +160,9 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
 
             // write data
             for(unsigned int d = 0; d < dim; ++d)
-              f << std::setw(precision + 8) << std::left << points[i][d];
+              f << std::setw(precision + 8) << std::left << points[l][i][d];
             for(unsigned int d = 0; d < dim; ++d)
-              f << std::setw(precision + 8) << std::left << solution_vector[i][d];
+              f << std::setw(precision + 8) << std::left << velocity_values[offset + i][d];
             f << std::endl;
           }
           f.close();
@@ -140,17 +170,6 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
       }
       else if((*quantity)->type == QuantityType::Pressure)
       {
-        std::vector<Number> solution_vector(n_points);
-
-        // calculate pressure for all points along line
-        for(unsigned int i = 0; i < n_points; ++i)
-        {
-          Number p;
-          evaluate_scalar_quantity_in_point(
-            p, *dof_handler_pressure, *mapping, pressure, points[i], mpi_comm);
-          solution_vector[i] = p;
-        }
-
         // write output to file
         if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
         {
@@ -180,15 +199,17 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
 
             // write data
             for(unsigned int d = 0; d < dim; ++d)
-              f << std::setw(precision + 8) << std::left << points[i][d];
-            f << std::setw(precision + 8) << std::left << solution_vector[i];
+              f << std::setw(precision + 8) << std::left << points[l][i][d];
+            f << std::setw(precision + 8) << std::left << pressure_values[offset + i];
             f << std::endl;
           }
           f.close();
         }
       }
     } // loop over quantities
-  }   // loop over lines
+
+    offset += n_points;
+  } // loop over lines
 }
 
 template class LinePlotCalculator<2, float>;
@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
+#include <exadg/postprocessor/solution_interpolation.h>
 
 namespace ExaDG
 {
@@ -71,6 +72,12 @@ private:
   dealii::ObserverPointer<dealii::Mapping<dim> const>    mapping;
 
   LinePlotData<dim> data;
+
+  // for all lines: points along the line
+  std::vector<std::vector<dealii::Point<dim>>> points;
+
+  // evaluates the solution in the points of all lines
+  PointEvaluator<dim> point_evaluator;
 };
 
 } // namespace IncNS
@@ -19,12 +19,8 @@
  *  ______________________________________________________________________
  */
 
-// deal.II
-#include <deal.II/grid/grid_tools.h>
-
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation_statistics.h>
-#include <exadg/postprocessor/solution_interpolation.h>
 #include <exadg/utilities/create_directories.h>
 
 namespace ExaDG
@@ -42,7 +38,7 @@ LinePlotCalculatorStatistics<dim, Number>::LinePlotCalculatorStatistics(
     dof_handler_pressure(dof_handler_pressure_in),
     mapping(mapping_in),
     mpi_comm(mpi_comm_in),
-    cell_data_has_been_initialized(false),
+    point_evaluator_has_been_initialized(false),
     number_of_samples(0),
     write_final_output(false)
 {
@@ -68,8 +64,7 @@ LinePlotCalculatorStatistics<dim, Number>::setup(LinePlotDataStatistics<dim> con
     velocity_global.resize(data.lines.size());
     pressure_global.resize(data.lines.size());
     global_points.resize(data.lines.size());
-    cells_global_velocity.resize(data.lines.size());
-    cells_global_pressure.resize(data.lines.size());
+    point_ranges.resize(data.lines.size());
 
     unsigned int line_iterator = 0;
     for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
@@ -88,8 +83,7 @@ LinePlotCalculatorStatistics<dim, Number>::setup(LinePlotDataStatistics<dim> con
         global_points[line_iterator].push_back(point);
       }
 
-      cells_global_velocity[line_iterator].resize((*line)->n_points);
-      cells_global_pressure[line_iterator].resize((*line)->n_points);
+      point_ranges[line_iterator].resize((*line)->n_points);
     }
 
     create_directories(data.directory, mpi_comm);
@@ -113,10 +107,12 @@ LinePlotCalculatorStatistics<dim, Number>::write_output() const
 
 template<int dim, typename Number>
 void
-LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const & velocity,
-                                                                VectorType const & pressure)
+LinePlotCalculatorStatistics<dim, Number>::initialize_point_evaluator()
 {
-  // Save data related to all adjacent cells for a given point along the line.
+  // All evaluation points (including the points used for averaging in circumferential direction)
+  // are collected in one vector, so that the points have to be located in the mesh only once.
+  std::vector<dealii::Point<dim>> evaluation_points;
+
   unsigned int line_iterator = 0;
   for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
       line != data.lines.end();
@@ -130,28 +126,6 @@ LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const
                 dealii::ExcMessage(
                   "Invalid line type, expected LineCircumferentialAveraging<dim>"));
 
-    // find out which quantities have to be evaluated
-    bool velocity_has_to_be_evaluated = false;
-    bool pressure_has_to_be_evaluated = false;
-
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      if((*quantity)->type == QuantityType::Velocity or
-         (*quantity)->type == QuantityType::SkinFriction or
-         (*quantity)->type == QuantityType::ReynoldsStresses)
-      {
-        velocity_has_to_be_evaluated = true;
-      }
-
-      if((*quantity)->type == QuantityType::Pressure)
-      {
-        pressure_has_to_be_evaluated = true;
-      }
-    }
-
     // determine two unit vectors defining circumferential plane
     dealii::Tensor<1, dim, double> normal_vector;
     dealii::Tensor<1, dim, double> unit_vector_1, unit_vector_2;
@@ -213,50 +187,19 @@ LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const
         }
       }
 
-      for(typename std::vector<dealii::Point<dim>>::iterator point_it = points.begin();
-          point_it != points.end();
-          ++point_it)
-      {
-        if(velocity_has_to_be_evaluated == true)
-        {
-          // find adjacent cells and store data required later for evaluating the solution.
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            mapping, dof_handler_velocity.get_triangulation(), *point_it, 1.e-10);
-
-          auto dof_indices_and_shape_values = get_dof_indices_and_shape_values(adjacent_cells,
-                                                                               dof_handler_velocity,
-                                                                               mapping,
-                                                                               velocity);
-
-          for(auto iter = dof_indices_and_shape_values.begin();
-              iter != dof_indices_and_shape_values.end();
-              ++iter)
-          {
-            cells_global_velocity[line_iterator][p].push_back(*iter);
-          }
-        }
-
-        if(pressure_has_to_be_evaluated == true)
-        {
-          // find adjacent cells and store data required later for evaluating the solution.
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            mapping, dof_handler_pressure.get_triangulation(), *point_it, 1.e-10);
-
-          auto dof_indices_and_shape_values = get_dof_indices_and_shape_values(adjacent_cells,
-                                                                               dof_handler_pressure,
-                                                                               mapping,
-                                                                               pressure);
-
-          for(auto iter = dof_indices_and_shape_values.begin();
-              iter != dof_indices_and_shape_values.end();
-              ++iter)
-          {
-            cells_global_pressure[line_iterator][p].push_back(*iter);
-          }
-        }
-      }
+      point_ranges[line_iterator][p] = {evaluation_points.size(), points.size()};
+      evaluation_points.insert(evaluation_points.end(), points.begin(), points.end());
     }
   }
+
+  // Only the root process writes the results to file and therefore needs the point values.
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    evaluation_points.clear();
+
+  point_evaluator.setup(evaluation_points,
+                        dof_handler_velocity.get_triangulation(),
+                        mapping,
+                        data.update_points_before_evaluation);
 }
 
 template<int dim, typename Number>
@@ -268,222 +211,108 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate(VectorType const & veloci
   number_of_samples++;
 
   // Make sure that all data has been initialized before evaluating the solution.
-  if(cell_data_has_been_initialized == false)
+  if(point_evaluator_has_been_initialized == false)
   {
-    initialize_cell_data(velocity, pressure);
+    initialize_point_evaluator();
 
-    cell_data_has_been_initialized = true;
+    point_evaluator_has_been_initialized = true;
   }
 
-  // Iterator for lines
-  unsigned int line_iterator = 0;
-  for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
-      line != data.lines.end();
-      ++line, ++line_iterator)
+  // find out which quantities have to be evaluated
+  bool evaluate_velocity = false, evaluate_pressure = false;
+  for(auto const & line : data.lines)
   {
-    bool evaluate_velocity = false;
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
+    for(auto const & quantity : line->quantities)
     {
-      // evaluate quantities that involve velocity
-      if((*quantity)->type == QuantityType::Velocity or
-         (*quantity)->type == QuantityType::SkinFriction or
-         (*quantity)->type == QuantityType::ReynoldsStresses)
+      if(quantity->type == QuantityType::Velocity or
+         quantity->type == QuantityType::SkinFriction or
+         quantity->type == QuantityType::ReynoldsStresses)
       {
         evaluate_velocity = true;
       }
-    }
-    if(evaluate_velocity == true)
-    {
-      do_evaluate_velocity(velocity, *(*line), line_iterator);
-    }
 
-    bool evaluate_pressure = false;
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      // evaluate quantities that involve velocity
-      if((*quantity)->type == QuantityType::Pressure or
-         (*quantity)->type == QuantityType::PressureCoefficient)
+      if(quantity->type == QuantityType::Pressure or
+         quantity->type == QuantityType::PressureCoefficient)
       {
         evaluate_pressure = true;
       }
     }
-    if(evaluate_pressure == true)
-    {
-      do_evaluate_pressure(pressure, *(*line), line_iterator);
-    }
   }
-}
 
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const & velocity,
-                                                                Line<dim> const &  line,
-                                                                unsigned int const line_iterator)
-{
-  // Local variables for the current line:
+  // Evaluate the solution in all points at once. The point values are only available on the root
+  // process.
+  std::vector<dealii::Tensor<1, dim, Number>> velocity_values;
+  if(evaluate_velocity)
+    velocity_values = point_evaluator.template evaluate<dim>(dof_handler_velocity, velocity);
 
-  // for all points along the line: velocity vector
-  std::vector<dealii::Tensor<1, dim, Number>> velocity_vector_local(line.n_points);
-  // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
+  std::vector<Number> pressure_values;
+  if(evaluate_pressure)
+    pressure_values = point_evaluator.template evaluate<1>(dof_handler_pressure, pressure);
 
-  for(unsigned int p = 0; p < line.n_points; ++p)
-  {
-    auto & adjacent_cells(cells_global_velocity[line_iterator][p]);
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    return;
 
-    // loop over all adjacent, locally owned cells for the current point
-    for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
+  unsigned int line_iterator = 0;
+  for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
+      line != data.lines.end();
+      ++line, ++line_iterator)
+  {
+    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
+          (*line)->quantities.begin();
+        quantity != (*line)->quantities.end();
+        ++quantity)
     {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
-      for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            line.quantities.begin();
-          quantity != line.quantities.end();
-          ++quantity)
+      // Accumulate instantaneous values into global vector. The values are averaged over all
+      // points in circumferential direction. When writing the output files, we calculate the
+      // time-averaged values by dividing the global (accumulated) values by the number of samples.
+      // Points that have not been found in the triangulation are skipped.
+      if((*quantity)->type == QuantityType::Velocity)
       {
-        if((*quantity)->type == QuantityType::Velocity)
+        for(unsigned int p = 0; p < (*line)->n_points; ++p)
         {
-          // interpolate solution using the precomputed shape values and the global dof index
-          dealii::Tensor<1, dim, Number> velocity_value = Interpolator<1, dim, Number>::value(
-            dof_handler_velocity, velocity, iter->first, iter->second);
+          auto const & [first, n] = point_ranges[line_iterator][p];
 
-          // add result to array with velocity values
-          velocity_vector_local[p] += velocity_value;
-        }
-        else
-        {
-          AssertThrow(false, dealii::ExcMessage("Not implemented."));
+          dealii::Tensor<1, dim, Number> velocity_average;
+          unsigned int                   counter = 0;
+          for(unsigned int i = first; i < first + n; ++i)
+          {
+            if(point_evaluator.point_found(i))
+            {
+              velocity_average += velocity_values[i];
+              ++counter;
+            }
+          }
+
+          if(counter > 0)
+            velocity_global[line_iterator][p] += velocity_average / Number(counter);
         }
       }
-    }
-  }
-
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communication as well as averaging for all quantities of the current line.
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
-  {
-    if((*quantity)->type == QuantityType::Velocity)
-    {
-      dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(&velocity_vector_local[0][0],
-                                                                  dim *
-                                                                    velocity_vector_local.size()),
-                                  mpi_comm,
-                                  dealii::ArrayView<Number>(&velocity_vector_local[0][0],
-                                                            dim * velocity_vector_local.size()));
-
-      // Accumulate instantaneous values into global vector.
-      // When writing the output files, we calculate the time-averaged values
-      // by dividing the global (accumulated) values by the number of samples.
-      for(unsigned int p = 0; p < line.n_points; ++p)
+      else if((*quantity)->type == QuantityType::Pressure)
       {
-        // Take average value over all adjacent cells for a given point.
-        for(unsigned int d = 0; d < dim; ++d)
+        for(unsigned int p = 0; p < (*line)->n_points; ++p)
         {
-          if(counter_vector_local[p] > 0)
+          auto const & [first, n] = point_ranges[line_iterator][p];
+
+          Number       pressure_average = 0.0;
+          unsigned int counter          = 0;
+          for(unsigned int i = first; i < first + n; ++i)
           {
-            velocity_global[line_iterator][p][d] +=
-              velocity_vector_local[p][d] / counter_vector_local[p];
+            if(point_evaluator.point_found(i))
+            {
+              pressure_average += pressure_values[i];
+              ++counter;
+            }
           }
-        }
-      }
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
-  }
-}
 
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const & pressure,
-                                                                Line<dim> const &  line,
-                                                                unsigned int const line_iterator)
-{
-  // Local variables for the current line:
-
-  // for all points along the line: pressure value
-  std::vector<Number> pressure_vector_local(line.n_points);
-  // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
-
-  for(unsigned int p = 0; p < line.n_points; ++p)
-  {
-    auto & adjacent_cells(cells_global_pressure[line_iterator][p]);
-
-    // loop over all adjacent, locally owned cells for the current point
-    for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
-    {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
-      for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            line.quantities.begin();
-          quantity != line.quantities.end();
-          ++quantity)
-      {
-        if((*quantity)->type == QuantityType::Pressure)
-        {
-          // interpolate solution using the precomputed shape values and the global dof index
-          Number pressure_value = Interpolator<0, dim, Number>::value(dof_handler_pressure,
-                                                                      pressure,
-                                                                      iter->first,
-                                                                      iter->second);
-
-          // add result to array with pressure values
-          pressure_vector_local[p] += pressure_value;
-        }
-        else
-        {
-          AssertThrow(false, dealii::ExcMessage("Not implemented."));
+          if(counter > 0)
+            pressure_global[line_iterator][p] += pressure_average / Number(counter);
         }
       }
-    }
-  }
-
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communcation as well as averaging for all quantities of the current line.
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
-  {
-    if((*quantity)->type == QuantityType::Pressure)
-    {
-      dealii::Utilities::MPI::sum(pressure_vector_local, mpi_comm, pressure_vector_local);
-
-      // Accumulate instantaneous values into global vector.
-      // When writing the output files, we calculate the time-averaged values
-      // by dividing the global (accumulated) values by the number of samples.
-      for(unsigned int p = 0; p < line.n_points; ++p)
+      else
       {
-        // Take average value over all adjacent cells for a given point.
-        if(counter_vector_local[p] > 0)
-        {
-          pressure_global[line_iterator][p] += pressure_vector_local[p] / counter_vector_local[p];
-        }
+        AssertThrow(false, dealii::ExcMessage("Not implemented."));
       }
     }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
   }
 }
 
@@ -32,6 +32,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
+#include <exadg/postprocessor/solution_interpolation.h>
 #include <exadg/postprocessor/time_control.h>
 
 namespace ExaDG
@@ -65,10 +66,6 @@ class LinePlotCalculatorStatistics
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef typename std::vector<
-    std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>>
-    TYPE;
-
   LinePlotCalculatorStatistics(dealii::DoFHandler<dim> const & dof_handler_velocity_in,
                                dealii::DoFHandler<dim> const & dof_handler_pressure_in,
                                dealii::Mapping<dim> const &    mapping_in,
@@ -93,21 +90,11 @@ private:
   }
 
   void
-  initialize_cell_data(VectorType const & velocity, VectorType const & pressure);
+  initialize_point_evaluator();
 
   void
   do_evaluate(VectorType const & velocity, VectorType const & pressure);
 
-  void
-  do_evaluate_velocity(VectorType const & velocity,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
-
-  void
-  do_evaluate_pressure(VectorType const & pressure,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
-
   void
   do_write_output() const;
 
@@ -123,19 +110,14 @@ private:
   // Global points
   std::vector<std::vector<dealii::Point<dim>>> global_points;
 
-  bool cell_data_has_been_initialized;
+  bool point_evaluator_has_been_initialized;
 
-  // For all lines: for all points along the line: for all relevant cells: dof index of first dof of
-  // current cell and all shape function values
-  std::vector<std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>>
-    cells_global_velocity;
+  // For all lines: for all points along the line: index of the first evaluation point and number
+  // of evaluation points (> 1 in case of averaging in circumferential direction)
+  std::vector<std::vector<std::pair<unsigned int, unsigned int>>> point_ranges;
 
-  // For all lines: for all points along the line: for all relevant cells: dof index of first dof of
-  // current cell and all shape function values
-  std::vector<std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>>
-    cells_global_pressure;
+  // evaluates the solution in the points of all lines
+  PointEvaluator<dim> point_evaluator;
 
   // number of samples for averaging in time
   unsigned int number_of_samples;
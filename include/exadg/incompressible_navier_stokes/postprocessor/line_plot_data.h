@@ -175,7 +175,7 @@ struct LineHomogeneousAveraging : Line<dim>
 template<int dim>
 struct LinePlotDataBase
 {
-  LinePlotDataBase() : directory("output/"), precision(10)
+  LinePlotDataBase() : directory("output/"), precision(10), update_points_before_evaluation(false)
   {
   }
 
@@ -199,6 +199,12 @@ struct LinePlotDataBase
    */
   unsigned int precision;
 
+  /*
+   *  The points along the lines are located in the mesh only once. For moving meshes, set this
+   *  parameter to true to search the points again before every evaluation.
+   */
+  bool update_points_before_evaluation;
+
   /*
    *  a vector of lines along which we want to write output
    */
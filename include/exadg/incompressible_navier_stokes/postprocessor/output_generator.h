@@ -23,6 +23,7 @@
 #define EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 
 // ExaDG
+#include <exadg/postprocessor/asynchronous_output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
@@ -140,6 +141,9 @@ private:
   dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
   dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
   dealii::ObserverPointer<dealii::Mapping<dim> const>    mapping;
+
+  // writes output in the background in case of asynchronous output
+  mutable AsynchronousOutputWriter asynchronous_writer;
 };
 
 } // namespace IncNS
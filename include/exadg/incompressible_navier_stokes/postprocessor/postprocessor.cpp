@@ -58,6 +58,11 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
 
   initialize_derived_fields();
 
+  // the mapping is used in the background thread, but changes in every time step for moving meshes
+  AssertThrow(not(pp_data.output_data.write_asynchronously and
+                  pde_operator.get_parameters().ale_formulation),
+              dealii::ExcMessage("Asynchronous output is not supported for moving meshes (ALE)."));
+
   output_generator.setup(pde_operator.get_dof_handler_u(),
                          pde_operator.get_dof_handler_p(),
                          *pde_operator.get_mapping(),
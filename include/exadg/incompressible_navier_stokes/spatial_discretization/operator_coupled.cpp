@@ -287,6 +287,16 @@ OperatorCoupled<dim, Number>::solve_nonlinear_problem(BlockVectorType &  dst,
   return iter;
 }
 
+template<int dim, typename Number>
+unsigned long long
+OperatorCoupled<dim, Number>::get_estimated_n_saved_linear_iterations_newton() const
+{
+  if(newton_solver)
+    return newton_solver->get_estimated_n_saved_linear_iterations();
+
+  return 0;
+}
+
 template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::evaluate_nonlinear_residual(BlockVectorType &       dst,
@@ -280,6 +280,11 @@ public:
                           double const &     time                = 0.0,
                           double const &     scaling_factor_mass = 1.0);
 
+  /*
+   * Estimated number of linear iterations saved by the inexact Newton method (accumulated).
+   */
+  unsigned long long
+  get_estimated_n_saved_linear_iterations_newton() const;
 
   /*
    * This function evaluates the nonlinear residual.
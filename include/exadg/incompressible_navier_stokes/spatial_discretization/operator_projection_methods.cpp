@@ -22,6 +22,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_projection_methods.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/pipelined_krylov_solvers.h>
 #include <exadg/solvers_and_preconditioners/utilities/check_multigrid.h>
 
 namespace ExaDG
@@ -229,6 +230,25 @@ OperatorProjectionMethods<dim, Number>::setup_solver_pressure_poisson()
                                                      *preconditioner_pressure_poisson,
                                                      solver_data);
   }
+  else if(this->param.solver_pressure_poisson == SolverPressurePoisson::PipelinedCG)
+  {
+    Krylov::SolverDataCG solver_data;
+    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+
+    if(this->param.preconditioner_pressure_poisson != PreconditionerPressurePoisson::None)
+    {
+      solver_data.use_preconditioner = true;
+    }
+
+    pressure_poisson_solver =
+      std::make_shared<Krylov::SolverPipelinedCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                                 PreconditionerBase<Number>,
+                                                 VectorType>>(laplace_operator,
+                                                              *preconditioner_pressure_poisson,
+                                                              solver_data);
+  }
   else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FGMRES)
   {
     Krylov::SolverDataFGMRES solver_data;
@@ -350,6 +370,22 @@ OperatorProjectionMethods<dim, Number>::setup_momentum_solver()
       Krylov::SolverCG<MomentumOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
       this->momentum_operator, *momentum_preconditioner, solver_data);
   }
+  else if(this->param.solver_momentum == SolverMomentum::PipelinedCG)
+  {
+    Krylov::SolverDataCG solver_data;
+    solver_data.max_iter             = this->param.solver_data_momentum.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_momentum.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_momentum.rel_tol;
+    if(this->param.preconditioner_momentum != MomentumPreconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    momentum_linear_solver =
+      std::make_shared<Krylov::SolverPipelinedCG<MomentumOperator<dim, Number>,
+                                                 PreconditionerBase<Number>,
+                                                 VectorType>>(this->momentum_operator,
+                                                              *momentum_preconditioner,
+                                                              solver_data);
+  }
   else if(this->param.solver_momentum == SolverMomentum::GMRES)
   {
     // setup solver data
@@ -367,6 +403,23 @@ OperatorProjectionMethods<dim, Number>::setup_momentum_solver()
       Krylov::SolverGMRES<MomentumOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
       this->momentum_operator, *momentum_preconditioner, solver_data, this->mpi_comm);
   }
+  else if(this->param.solver_momentum == SolverMomentum::GMRESLowSync)
+  {
+    Krylov::SolverDataGMRES solver_data;
+    solver_data.max_iter             = this->param.solver_data_momentum.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_momentum.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_momentum.rel_tol;
+    solver_data.max_n_tmp_vectors    = this->param.solver_data_momentum.max_krylov_size;
+    if(this->param.preconditioner_momentum != MomentumPreconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    momentum_linear_solver =
+      std::make_shared<Krylov::SolverGMRESLowSync<MomentumOperator<dim, Number>,
+                                                  PreconditionerBase<Number>,
+                                                  VectorType>>(this->momentum_operator,
+                                                               *momentum_preconditioner,
+                                                               solver_data);
+  }
   else if(this->param.solver_momentum == SolverMomentum::FGMRES)
   {
     Krylov::SolverDataFGMRES solver_data;
@@ -528,6 +581,16 @@ OperatorProjectionMethods<dim, Number>::solve_nonlinear_momentum_equation(
   return iter;
 }
 
+template<int dim, typename Number>
+unsigned long long
+OperatorProjectionMethods<dim, Number>::get_estimated_n_saved_linear_iterations_momentum() const
+{
+  if(momentum_newton_solver)
+    return momentum_newton_solver->get_estimated_n_saved_linear_iterations();
+
+  return 0;
+}
+
 template<int dim, typename Number>
 void
 OperatorProjectionMethods<dim, Number>::evaluate_nonlinear_residual(
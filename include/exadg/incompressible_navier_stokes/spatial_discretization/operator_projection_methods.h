@@ -199,6 +199,12 @@ public:
                                     bool const &       update_preconditioner,
                                     double const &     scaling_factor_mass);
 
+  /*
+   * Estimated number of linear iterations saved by the inexact Newton method (accumulated).
+   */
+  unsigned long long
+  get_estimated_n_saved_linear_iterations_momentum() const;
+
   /*
    * This function evaluates the nonlinear residual.
    */
@@ -841,6 +841,13 @@ SpatialOperatorBase<dim, Number>::get_quad_index_velocity_linearized() const
   }
 }
 
+template<int dim, typename Number>
+Parameters const &
+SpatialOperatorBase<dim, Number>::get_parameters() const
+{
+  return param;
+}
+
 template<int dim, typename Number>
 std::shared_ptr<dealii::Mapping<dim> const>
 SpatialOperatorBase<dim, Number>::get_mapping() const
@@ -178,6 +178,9 @@ protected:
   get_quad_index_velocity_linearized() const;
 
 public:
+  Parameters const &
+  get_parameters() const;
+
   std::shared_ptr<dealii::Mapping<dim> const>
   get_mapping() const;
 
@@ -256,36 +256,88 @@ template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::read_restart_vectors(BoostInputArchiveType & ia)
 {
-  for(unsigned int i = 0; i < this->order; i++)
+  if(this->restart_data.format == RestartFormat::PartitionIndependent)
   {
-    VectorType tmp = get_velocity(i);
-    read_write_distributed_vector(tmp, ia);
-    set_velocity(tmp, i);
-  }
-  for(unsigned int i = 0; i < this->order; i++)
-  {
-    VectorType tmp = get_pressure(i);
-    read_write_distributed_vector(tmp, ia);
-    set_pressure(tmp, i);
-  }
+    AssertThrow(this->param.ale_formulation == false,
+                dealii::ExcMessage("RestartFormat::PartitionIndependent is not implemented for "
+                                   "the ALE formulation."));
 
-  if(needs_vector_convective_term)
-  {
-    if(this->param.ale_formulation == false)
+    // The vectors are deserialized from the triangulation, which has already been loaded together
+    // with the restart data. The sequence of vectors has to match write_restart_vectors().
+    std::vector<VectorType> velocities(this->order), pressures(this->order);
+
+    std::vector<VectorType *> vectors_velocity, vectors_pressure;
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      velocities[i] = get_velocity(i);
+      vectors_velocity.push_back(&velocities[i]);
+    }
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      pressures[i] = get_pressure(i);
+      vectors_pressure.push_back(&pressures[i]);
+    }
+
+    if(needs_vector_convective_term)
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        read_write_distributed_vector(vec_convective_term[i], ia);
+        vectors_velocity.push_back(&vec_convective_term[i]);
       }
     }
-  }
 
-  if(this->param.ale_formulation)
+    get_additional_restart_vectors(vectors_velocity, vectors_pressure);
+
+    deserialize_vectors<dim, VectorType>({&operator_base->get_dof_handler_u(),
+                                          &operator_base->get_dof_handler_p()},
+                                         {vectors_velocity, vectors_pressure});
+
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      set_velocity(velocities[i], i);
+      set_pressure(pressures[i], i);
+    }
+  }
+  else
   {
-    for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      VectorType tmp = get_velocity(i);
+      read_write_distributed_vector(tmp, ia);
+      set_velocity(tmp, i);
+    }
+    for(unsigned int i = 0; i < this->order; i++)
     {
-      read_write_distributed_vector(vec_grid_coordinates[i], ia);
+      VectorType tmp = get_pressure(i);
+      read_write_distributed_vector(tmp, ia);
+      set_pressure(tmp, i);
     }
+
+    if(needs_vector_convective_term)
+    {
+      if(this->param.ale_formulation == false)
+      {
+        for(unsigned int i = 0; i < this->order; i++)
+        {
+          read_write_distributed_vector(vec_convective_term[i], ia);
+        }
+      }
+    }
+
+    if(this->param.ale_formulation)
+    {
+      for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+      {
+        read_write_distributed_vector(vec_grid_coordinates[i], ia);
+      }
+    }
+
+    std::vector<VectorType *> vectors_velocity, vectors_pressure;
+    get_additional_restart_vectors(vectors_velocity, vectors_pressure);
+    for(VectorType * vector : vectors_velocity)
+      read_write_distributed_vector(*vector, ia);
+    for(VectorType * vector : vectors_pressure)
+      read_write_distributed_vector(*vector, ia);
   }
 }
 
@@ -293,35 +345,96 @@ template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::write_restart_vectors(BoostOutputArchiveType & oa) const
 {
-  for(unsigned int i = 0; i < this->order; i++)
-  {
-    read_write_distributed_vector(get_velocity(i), oa);
-  }
-  for(unsigned int i = 0; i < this->order; i++)
+  if(this->restart_data.format == RestartFormat::PartitionIndependent)
   {
-    read_write_distributed_vector(get_pressure(i), oa);
-  }
+    AssertThrow(this->param.ale_formulation == false,
+                dealii::ExcMessage("RestartFormat::PartitionIndependent is not implemented for "
+                                   "the ALE formulation."));
 
-  if(needs_vector_convective_term)
-  {
-    if(this->param.ale_formulation == false)
+    std::vector<VectorType const *> vectors_velocity, vectors_pressure;
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      vectors_velocity.push_back(&get_velocity(i));
+    }
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      vectors_pressure.push_back(&get_pressure(i));
+    }
+
+    if(needs_vector_convective_term)
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        read_write_distributed_vector(vec_convective_term[i], oa);
+        vectors_velocity.push_back(&vec_convective_term[i]);
       }
     }
-  }
 
-  if(this->param.ale_formulation)
+    get_additional_restart_vectors(vectors_velocity, vectors_pressure);
+
+    serialize_triangulation_and_vectors<dim, VectorType>(this->restart_data.filename,
+                                                         {&operator_base->get_dof_handler_u(),
+                                                          &operator_base->get_dof_handler_p()},
+                                                         {vectors_velocity, vectors_pressure});
+  }
+  else
   {
-    for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+    for(unsigned int i = 0; i < this->order; i++)
+    {
+      read_write_distributed_vector(get_velocity(i), oa);
+    }
+    for(unsigned int i = 0; i < this->order; i++)
     {
-      read_write_distributed_vector(vec_grid_coordinates[i], oa);
+      read_write_distributed_vector(get_pressure(i), oa);
     }
+
+    if(needs_vector_convective_term)
+    {
+      if(this->param.ale_formulation == false)
+      {
+        for(unsigned int i = 0; i < this->order; i++)
+        {
+          read_write_distributed_vector(vec_convective_term[i], oa);
+        }
+      }
+    }
+
+    if(this->param.ale_formulation)
+    {
+      for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
+      {
+        read_write_distributed_vector(vec_grid_coordinates[i], oa);
+      }
+    }
+
+    std::vector<VectorType const *> vectors_velocity, vectors_pressure;
+    get_additional_restart_vectors(vectors_velocity, vectors_pressure);
+    for(VectorType const * vector : vectors_velocity)
+      read_write_distributed_vector(*vector, oa);
+    for(VectorType const * vector : vectors_pressure)
+      read_write_distributed_vector(*vector, oa);
   }
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::get_additional_restart_vectors(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
+{
+  (void)vectors_velocity;
+  (void)vectors_pressure;
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::get_additional_restart_vectors(
+  std::vector<VectorType const *> & vectors_velocity,
+  std::vector<VectorType const *> & vectors_pressure) const
+{
+  (void)vectors_velocity;
+  (void)vectors_pressure;
+}
+
 template<int dim, typename Number>
 double
 TimeIntBDF<dim, Number>::calculate_time_step_size()
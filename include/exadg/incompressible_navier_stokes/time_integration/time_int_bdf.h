@@ -110,10 +110,23 @@ protected:
   setup_derived() override;
 
   void
-  read_restart_vectors(BoostInputArchiveType & ia) override;
+  read_restart_vectors(BoostInputArchiveType & ia) final;
 
   void
-  write_restart_vectors(BoostOutputArchiveType & oa) const override;
+  write_restart_vectors(BoostOutputArchiveType & oa) const final;
+
+  /*
+   * Vectors required for a restart in addition to the solution history of velocity and pressure,
+   * grouped according to the DoFHandler (velocity, pressure) they belong to. The default
+   * implementation adds no vectors.
+   */
+  virtual void
+  get_additional_restart_vectors(std::vector<VectorType *> & vectors_velocity,
+                                 std::vector<VectorType *> & vectors_pressure);
+
+  virtual void
+  get_additional_restart_vectors(std::vector<VectorType const *> & vectors_velocity,
+                                 std::vector<VectorType const *> & vectors_pressure) const;
 
   void
   prepare_vectors_for_next_timestep() override;
@@ -659,6 +659,14 @@ TimeIntBDFCoupled<dim, Number>::print_iterations() const
       iterations_avg[2] = iterations_avg[1] / iterations_avg[0];
     else
       iterations_avg[2] = iterations_avg[1];
+
+    if(this->param.newton_solver_data_coupled.use_inexact_newton)
+    {
+      names.push_back("Coupled system (estimated linear saving by inexact Newton)");
+      iterations_avg.push_back(
+        (double)pde_operator->get_estimated_n_saved_linear_iterations_newton() /
+        std::max(1., (double)iterations.first));
+    }
   }
   else
   {
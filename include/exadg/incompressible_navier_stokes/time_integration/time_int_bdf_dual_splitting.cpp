@@ -79,6 +79,8 @@ TimeIntBDFDualSplitting<dim, Number>::setup_derived()
 {
   Base::setup_derived();
 
+  pressure_solution_history.reinit(this->param.solution_history_size_pressure_poisson);
+
   // velocity_dbc vectors do not have to be initialized in case of a restart, where
   // the vectors are read from restart files.
   if(this->param.restarted_simulation == false)
@@ -89,25 +91,29 @@ TimeIntBDFDualSplitting<dim, Number>::setup_derived()
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(BoostInputArchiveType & ia)
+TimeIntBDFDualSplitting<dim, Number>::get_additional_restart_vectors(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
 {
-  Base::read_restart_vectors(ia);
+  (void)vectors_pressure;
 
   for(unsigned int i = 0; i < velocity_dbc.size(); i++)
   {
-    read_write_distributed_vector(velocity_dbc[i], ia);
+    vectors_velocity.push_back(&velocity_dbc[i]);
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::write_restart_vectors(BoostOutputArchiveType & oa) const
+TimeIntBDFDualSplitting<dim, Number>::get_additional_restart_vectors(
+  std::vector<VectorType const *> & vectors_velocity,
+  std::vector<VectorType const *> & vectors_pressure) const
 {
-  Base::write_restart_vectors(oa);
+  (void)vectors_pressure;
 
   for(unsigned int i = 0; i < velocity_dbc.size(); i++)
   {
-    read_write_distributed_vector(velocity_dbc[i], oa);
+    vectors_velocity.push_back(&velocity_dbc[i]);
   }
 }
 
@@ -446,6 +452,10 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
     pressure_np = pressure_last_iter;
   }
 
+  // replace the initial guess by the projection onto previous solutions (if available)
+  if(pressure_solution_history.is_active())
+    pressure_solution_history.compute_initial_guess(pressure_np, rhs);
+
   // solve linear system of equations
   bool const update_preconditioner =
     this->param.update_preconditioner_pressure_poisson and
@@ -457,6 +467,14 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
   iterations_pressure.first += 1;
   iterations_pressure.second += n_iter;
 
+  // extend basis by the solution of the pressure Poisson equation (before adjusting the level)
+  if(pressure_solution_history.is_active())
+  {
+    pressure_solution_history.update(pressure_np, [&](VectorType & dst, VectorType const & src) {
+      pde_operator->apply_laplace_operator(dst, src);
+    });
+  }
+
   // special case: pressure level is undefined
   // Adjust the pressure level in order to allow a calculation of the pressure error.
   // This is necessary because otherwise the pressure solution moves away from the exact solution.
@@ -470,6 +488,8 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
   {
     this->pcout << std::endl << "Solve pressure step:";
     print_solver_info_linear(this->pcout, n_iter, timer.wall_time());
+    if(pressure_solution_history.is_active())
+      pressure_solution_history.print_info(this->pcout);
   }
 
   this->timer_tree->insert({"Timeloop", "Pressure step"}, timer.wall_time());
@@ -1049,6 +1069,14 @@ TimeIntBDFDualSplitting<dim, Number>::print_iterations() const
       iterations_avg[5] = iterations_avg[4] / iterations_avg[3];
     else
       iterations_avg[5] = iterations_avg[4];
+
+    if(this->param.newton_solver_data_momentum.use_inexact_newton)
+    {
+      names.push_back("Viscous step (estimated saving by inexact Newton)");
+      iterations_avg.push_back(
+        (double)pde_operator->get_estimated_n_saved_linear_iterations_momentum() /
+        std::max(1., (double)iterations_viscous.first));
+    }
   }
   else
   {
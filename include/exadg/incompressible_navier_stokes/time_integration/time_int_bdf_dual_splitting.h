@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf.h>
+#include <exadg/solvers_and_preconditioners/solvers/solution_history_projection.h>
 
 namespace ExaDG
 {
@@ -84,10 +85,12 @@ private:
   setup_derived() final;
 
   void
-  read_restart_vectors(BoostInputArchiveType & ia) final;
+  get_additional_restart_vectors(std::vector<VectorType *> & vectors_velocity,
+                                 std::vector<VectorType *> & vectors_pressure) final;
 
   void
-  write_restart_vectors(BoostOutputArchiveType & oa) const final;
+  get_additional_restart_vectors(std::vector<VectorType const *> & vectors_velocity,
+                                 std::vector<VectorType const *> & vectors_pressure) const final;
 
   void
   do_timestep_solve() final;
@@ -167,6 +170,9 @@ private:
   std::vector<VectorType> velocity_dbc;
   VectorType              velocity_dbc_np;
 
+  // initial guess of the pressure Poisson equation by projection onto previous solutions
+  SolutionHistoryProjection<VectorType> pressure_solution_history;
+
   // required for strongly-coupled partitioned FSI
   VectorType pressure_last_iter;
   VectorType velocity_projection_last_iter;
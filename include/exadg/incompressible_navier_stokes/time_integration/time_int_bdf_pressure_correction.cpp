@@ -88,6 +88,8 @@ TimeIntBDFPressureCorrection<dim, Number>::setup_derived()
 {
   Base::setup_derived();
 
+  pressure_solution_history.reinit(this->param.solution_history_size_pressure_poisson);
+
   // pressure_dbc does not have to be initialized in case of a restart, where
   // the vectors are read from memory.
   if(this->param.restarted_simulation == false)
@@ -98,25 +100,29 @@ TimeIntBDFPressureCorrection<dim, Number>::setup_derived()
 
 template<int dim, typename Number>
 void
-TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(BoostInputArchiveType & ia)
+TimeIntBDFPressureCorrection<dim, Number>::get_additional_restart_vectors(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
 {
-  Base::read_restart_vectors(ia);
+  (void)vectors_velocity;
 
   for(unsigned int i = 0; i < pressure_dbc.size(); i++)
   {
-    read_write_distributed_vector(pressure_dbc[i], ia);
+    vectors_pressure.push_back(&pressure_dbc[i]);
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDFPressureCorrection<dim, Number>::write_restart_vectors(BoostOutputArchiveType & oa) const
+TimeIntBDFPressureCorrection<dim, Number>::get_additional_restart_vectors(
+  std::vector<VectorType const *> & vectors_velocity,
+  std::vector<VectorType const *> & vectors_pressure) const
 {
-  Base::write_restart_vectors(oa);
+  (void)vectors_velocity;
 
   for(unsigned int i = 0; i < pressure_dbc.size(); i++)
   {
-    read_write_distributed_vector(pressure_dbc[i], oa);
+    vectors_pressure.push_back(&pressure_dbc[i]);
   }
 }
 
@@ -601,6 +607,10 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
     pressure_increment = pressure_increment_last_iter;
   }
 
+  // replace the initial guess by the projection onto previous solutions (if available)
+  if(pressure_solution_history.is_active())
+    pressure_solution_history.compute_initial_guess(pressure_increment, rhs);
+
   // solve linear system of equations
   bool const update_preconditioner =
     this->param.update_preconditioner_pressure_poisson and
@@ -614,6 +624,15 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
   iterations_pressure.first += 1;
   iterations_pressure.second += n_iter;
 
+  // extend basis by the solution of the pressure Poisson equation
+  if(pressure_solution_history.is_active())
+  {
+    pressure_solution_history.update(pressure_increment,
+                                     [&](VectorType & dst, VectorType const & src) {
+                                       pde_operator->apply_laplace_operator(dst, src);
+                                     });
+  }
+
   if(this->store_solution)
     pressure_increment_last_iter = pressure_increment;
 
@@ -630,6 +649,8 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
   {
     this->pcout << std::endl << "Solve pressure step:";
     print_solver_info_linear(this->pcout, n_iter, timer.wall_time());
+    if(pressure_solution_history.is_active())
+      pressure_solution_history.print_info(this->pcout);
   }
 
   this->timer_tree->insert({"Timeloop", "Pressure step"}, timer.wall_time());
@@ -1051,6 +1072,14 @@ TimeIntBDFPressureCorrection<dim, Number>::print_iterations() const
       (double)iterations_pressure.second / std::max(1., (double)iterations_pressure.first);
     iterations_avg[4] =
       (double)iterations_projection.second / std::max(1., (double)iterations_projection.first);
+
+    if(this->param.newton_solver_data_momentum.use_inexact_newton)
+    {
+      names.push_back("Momentum (estimated linear saving by inexact Newton)");
+      iterations_avg.push_back(
+        (double)pde_operator->get_estimated_n_saved_linear_iterations_momentum() /
+        std::max(1., (double)iterations_momentum.first));
+    }
   }
   else // linear problem
   {
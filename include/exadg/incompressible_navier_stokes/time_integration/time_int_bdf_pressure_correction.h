@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf.h>
+#include <exadg/solvers_and_preconditioners/solvers/solution_history_projection.h>
 
 namespace ExaDG
 {
@@ -93,10 +94,12 @@ private:
   initialize_former_multistep_dof_vectors() final;
 
   void
-  read_restart_vectors(BoostInputArchiveType & ia) final;
+  get_additional_restart_vectors(std::vector<VectorType *> & vectors_velocity,
+                                 std::vector<VectorType *> & vectors_pressure) final;
 
   void
-  write_restart_vectors(BoostOutputArchiveType & oa) const final;
+  get_additional_restart_vectors(std::vector<VectorType const *> & vectors_velocity,
+                                 std::vector<VectorType const *> & vectors_pressure) const final;
 
   void
   initialize_pressure_on_boundary();
@@ -169,6 +172,9 @@ private:
   // stores pressure Dirichlet boundary values at previous times
   std::vector<VectorType> pressure_dbc;
 
+  // initial guess of the pressure Poisson equation by projection onto previous solutions
+  SolutionHistoryProjection<VectorType> pressure_solution_history;
+
   // required for strongly-coupled partitioned FSI
   VectorType pressure_increment_last_iter;
   VectorType velocity_momentum_last_iter;
@@ -41,6 +41,7 @@
 #include <exadg/poisson/user_interface/field_functions.h>
 #include <exadg/poisson/user_interface/parameters.h>
 #include <exadg/postprocessor/output_parameters.h>
+#include <exadg/time_integration/restart.h>
 
 namespace ExaDG
 {
@@ -96,6 +97,16 @@ public:
     parse_parameters();
 
     set_parameters();
+
+    // In case of a partition-independent restart, the refinement of the mesh is loaded from the
+    // restart files together with the solution vectors.
+    if(param.restarted_simulation and
+       param.restart_data.format == RestartFormat::PartitionIndependent)
+    {
+      param.grid.serialized_triangulation_file =
+        restart_filename_triangulation(param.restart_data.filename);
+    }
+
     param.check(pcout);
     param.print(pcout, "List of parameters:");
 
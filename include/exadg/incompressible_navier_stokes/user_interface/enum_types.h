@@ -357,10 +357,15 @@ enum class QuadratureRuleLinearization
  *  use CG (conjugate gradient) method as default. FGMRES might be necessary
  *  if a Krylov method is used inside the preconditioner (e.g., as multigrid
  *  smoother or as multigrid coarse grid solver)
+ *
+ *  PipelinedCG overlaps the single global reduction per iteration with the
+ *  application of the preconditioner and the operator, and is intended for
+ *  large numbers of MPI ranks where the solver is latency-bound.
  */
 enum class SolverPressurePoisson
 {
   CG,
+  PipelinedCG,
   FGMRES
 };
 
@@ -416,11 +421,16 @@ enum class PreconditionerProjection
  *
  *  - FGMRES might be necessary if a Krylov method is used inside the preconditioner
  *    (e.g., as multigrid smoother or as multigrid coarse grid solver).
+ *
+ *  - PipelinedCG and GMRESLowSync are variants of CG and GMRES with a single global
+ *    reduction per iteration for large numbers of MPI ranks.
  */
 enum class SolverMomentum
 {
   CG,
+  PipelinedCG,
   GMRES,
+  GMRESLowSync,
   FGMRES
 };
 
@@ -152,6 +152,7 @@ Parameters::Parameters()
     multigrid_data_pressure_poisson(MultigridData()),
     update_preconditioner_pressure_poisson(false),
     update_preconditioner_pressure_poisson_every_time_steps(1),
+    solution_history_size_pressure_poisson(0),
 
     // projection step
     solver_projection(SolverProjection::CG),
@@ -447,6 +448,19 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     }
   }
 
+  if(solution_history_size_pressure_poisson > 0)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme or
+                  temporal_discretization == TemporalDiscretization::BDFPressureCorrection,
+                dealii::ExcMessage("The solution history initial guess for the pressure Poisson "
+                                   "equation is only available for projection methods."));
+
+    // the basis is only valid as long as the Laplace operator does not change
+    AssertThrow(not ale_formulation,
+                dealii::ExcMessage("The solution history initial guess for the pressure Poisson "
+                                   "equation is not available for the ALE formulation."));
+  }
+
   // HIGH-ORDER DUAL SPLITTING SCHEME
   if(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme)
   {
@@ -1062,6 +1076,10 @@ Parameters::print_parameters_pressure_poisson(dealii::ConditionalOStream const &
   {
     multigrid_data_pressure_poisson.print(pcout);
   }
+
+  print_parameter(pcout,
+                  "Solution history size (initial guess)",
+                  solution_history_size_pressure_poisson);
 }
 
 void
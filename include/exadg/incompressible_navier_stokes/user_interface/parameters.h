@@ -528,6 +528,13 @@ public:
   // This variable is only used if update of preconditioner is true.
   unsigned int update_preconditioner_pressure_poisson_every_time_steps;
 
+  // Number of vectors of an A-orthonormal basis of previous solutions of the pressure Poisson
+  // equation. If larger than zero, the initial guess of the pressure solve is computed as the
+  // Galerkin projection of the solution onto this basis (method of Fischer) instead of the
+  // extrapolation of old solutions. This requires one additional application of the Laplace
+  // operator per time step. A value of 0 deactivates this option.
+  unsigned int solution_history_size_pressure_poisson;
+
   // PROJECTION STEP
 
   // description: see enum declaration
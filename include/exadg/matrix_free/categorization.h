@@ -35,6 +35,10 @@ namespace Categorization
  *      same category
  *   2) cell based loops are enabled (incl. dealii::FEEvaluationBase::read_cell_data()
  *      for all neighboring cells)
+ *
+ * On locally refined meshes, the cell-based kernels of OperatorBase integrate the contributions
+ * of a coarse cell at a hanging face over the subfaces, using the face batches of the subfaces.
+ * Multigrid levels of locally refined meshes are not supported.
  */
 template<int dim, typename AdditionalData>
 void
@@ -53,8 +57,9 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
   AssertThrow(tria.get_reference_cells().size() == 1,
               dealii::ExcMessage("No mixed meshes allowed."));
 
-  AssertThrow(not tria.has_hanging_nodes(),
-              dealii::ExcMessage("Cell based face loops do not support locally refined meshes."));
+  AssertThrow(not(is_mg and tria.has_hanging_nodes()),
+              dealii::ExcMessage("Cell based face loops do not support multigrid levels of "
+                                 "locally refined meshes."));
 
   unsigned int const n_faces_per_cell = tria.get_reference_cells()[0].n_faces();
 
@@ -82,7 +82,11 @@ private:
   typedef std::pair<unsigned int, unsigned int> Range;
 
 public:
-  InverseMassOperator() : matrix_free(nullptr), dof_index(0), quad_index(0)
+  InverseMassOperator()
+    : matrix_free(nullptr),
+      dof_index(0),
+      quad_index(0),
+      active_category(dealii::numbers::invalid_unsigned_int)
   {
   }
 
@@ -320,6 +324,23 @@ public:
     }
   }
 
+  // dst = M^-1 * src, restricted to the cells of the given cell vectorization category of the
+  // MatrixFree object (e.g. the cells of one time step cluster for local time stepping). Entries
+  // of dst belonging to other cells are not modified.
+  void
+  apply_category(VectorType & dst, VectorType const & src, unsigned int const category) const
+  {
+    AssertThrow(data.implementation_type == InverseMassType::MatrixfreeOperator,
+                dealii::ExcMessage("Restriction to a cell category is only implemented for "
+                                   "InverseMassType::MatrixfreeOperator."));
+
+    active_category = category;
+
+    dst.zero_out_ghost_values();
+    matrix_free->cell_loop(&This::cell_loop_matrix_free_operator, this, dst, src);
+
+    active_category = dealii::numbers::invalid_unsigned_int;
+  }
 
 private:
   void
@@ -328,6 +349,10 @@ private:
                                  VectorType const & src,
                                  Range const &      cell_range) const
   {
+    if(active_category != dealii::numbers::invalid_unsigned_int and
+       matrix_free->get_cell_range_category(cell_range) != active_category)
+      return;
+
     Integrator                      integrator(*matrix_free, dof_index, quad_index);
     InverseMassAsMatrixFreeOperator inverse_mass(integrator);
 
@@ -391,6 +416,9 @@ private:
 
   unsigned int dof_index, quad_index;
 
+  // only cells of this category are considered by the matrix-free cell loop (all cells if invalid)
+  unsigned int mutable active_category;
+
   InverseMassParameters data;
 
   // Variable coefficients not managed by this class.
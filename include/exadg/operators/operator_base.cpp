@@ -86,6 +86,11 @@ OperatorBase<dim, Number, n_components>::reinit(
     this->matrix_free->get_dof_handler(this->data.dof_index);
 
   n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(dof_handler.get_mpi_communicator());
+
+  // subfaces of hanging faces for cell-based loops
+  subfaces_cell_based.clear();
+  if(is_dg and this->data.use_cell_based_loops)
+    initialize_subfaces_cell_based();
 }
 
 template<int dim, typename Number, int n_components>
@@ -154,6 +159,54 @@ OperatorBase<dim, Number, n_components>::vmult(VectorType & dst, VectorType cons
     this->apply(dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::vmult(std::vector<VectorType *> const &       dst,
+                                               std::vector<VectorType const *> const & src) const
+{
+  AssertThrow(dst.size() == src.size(),
+              dealii::ExcMessage("The number of dst and src vectors has to be the same."));
+
+  if(this->data.use_matrix_based_vmult)
+  {
+    for(unsigned int i = 0; i < dst.size(); ++i)
+      this->apply_matrix_based(*dst[i], *src[i]);
+  }
+  else
+  {
+    // MatrixFree::loop() requires a non-const reference to the dst argument
+    std::vector<VectorType *> dst_vectors = dst;
+
+    if(is_dg and evaluate_face_integrals())
+    {
+      matrix_free->loop(&This::cell_loop_multiple,
+                        &This::face_loop_multiple,
+                        &This::boundary_face_loop_hom_operator_multiple,
+                        this,
+                        dst_vectors,
+                        src,
+                        true);
+    }
+    else
+    {
+      matrix_free->cell_loop(&This::cell_loop_multiple, this, dst_vectors, src, true);
+    }
+
+    // see function apply() regarding the treatment of constrained degrees of freedom
+    if(not is_dg)
+    {
+      for(unsigned int i = 0; i < dst.size(); ++i)
+      {
+        for(unsigned int const constrained_index :
+            matrix_free->get_constrained_dofs(this->data.dof_index))
+        {
+          dst[i]->local_element(constrained_index) = src[i]->local_element(constrained_index);
+        }
+      }
+    }
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::vmult_add(VectorType & dst, VectorType const & src) const
@@ -825,6 +878,16 @@ OperatorBase<dim, Number, n_components>::apply_add_block_diagonal_elementwise(
 
       this->reinit_face_cell_based(integrator_m, integrator_p, cell, face, bid);
 
+      // hanging faces are excluded here and integrated over the subfaces below
+      Subfaces const *                subfaces[vectorization_length] = {};
+      dealii::VectorizedArray<Number> regular_face                   = 1.0;
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      {
+        subfaces[v] = this->get_subfaces_cell_based(cell, v, face);
+        if(subfaces[v] != nullptr)
+          regular_face[v] = 0.0;
+      }
+
       for(unsigned int i = 0; i < integrator_m.dofs_per_cell; ++i)
         integrator_m.begin_dof_values()[i] = src[i];
 
@@ -844,7 +907,14 @@ OperatorBase<dim, Number, n_components>::apply_add_block_diagonal_elementwise(
       integrator_m.integrate(integrator_flags.face_integrate);
 
       for(unsigned int i = 0; i < integrator_m.dofs_per_cell; ++i)
-        dst[i] += integrator_m.begin_dof_values()[i];
+        dst[i] += regular_face * integrator_m.begin_dof_values()[i];
+
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      {
+        if(subfaces[v] != nullptr)
+          this->apply_add_subfaces_cell_based(
+            integrator_m, integrator_p, *subfaces[v], dst, src, v);
+      }
     }
   }
 }
@@ -1370,6 +1440,90 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_hom_operator(
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::cell_loop_multiple(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  std::vector<VectorType const *> const & src,
+  Range const &                           range) const
+{
+  IntegratorCell integrator =
+    IntegratorCell(matrix_free, this->data.dof_index, this->data.quad_index);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    this->reinit_cell(integrator, cell);
+
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      integrator.gather_evaluate(*src[i], integrator_flags.cell_evaluate);
+
+      this->do_cell_integral(integrator);
+
+      integrator.integrate_scatter(integrator_flags.cell_integrate, *dst[i]);
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::face_loop_multiple(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  std::vector<VectorType const *> const & src,
+  Range const &                           range) const
+{
+  IntegratorFace integrator_m =
+    IntegratorFace(matrix_free, true, this->data.dof_index, this->data.quad_index);
+  IntegratorFace integrator_p =
+    IntegratorFace(matrix_free, false, this->data.dof_index, this->data.quad_index);
+
+  for(auto face = range.first; face < range.second; ++face)
+  {
+    this->reinit_face(integrator_m, integrator_p, face);
+
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      integrator_m.gather_evaluate(*src[i], integrator_flags.face_evaluate);
+      integrator_p.gather_evaluate(*src[i], integrator_flags.face_evaluate);
+
+      this->do_face_integral(integrator_m, integrator_p);
+
+      integrator_m.integrate_scatter(integrator_flags.face_integrate, *dst[i]);
+      integrator_p.integrate_scatter(integrator_flags.face_integrate, *dst[i]);
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::boundary_face_loop_hom_operator_multiple(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  std::vector<VectorType *> &             dst,
+  std::vector<VectorType const *> const & src,
+  Range const &                           range) const
+{
+  IntegratorFace integrator_m =
+    IntegratorFace(matrix_free, true, this->data.dof_index, this->data.quad_index);
+
+  for(unsigned int face = range.first; face < range.second; face++)
+  {
+    this->reinit_boundary_face(integrator_m, face);
+
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      integrator_m.gather_evaluate(*src[i], integrator_flags.face_evaluate);
+
+      do_boundary_integral(integrator_m,
+                           OperatorType::homogeneous,
+                           matrix_free.get_boundary_id(face));
+
+      integrator_m.integrate_scatter(integrator_flags.face_integrate, *dst[i]);
+    }
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::boundary_face_loop_inhom_operator(
@@ -1684,14 +1838,25 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_diagonal(
 
         this->reinit_face_cell_based(integrator_m, integrator_p, cell, face, bid);
 
-#ifdef DEBUG
         unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
+
+#ifdef DEBUG
         for(unsigned int v = 0; v < n_filled_lanes; v++)
           Assert(bid == bids[v],
                  dealii::ExcMessage(
                    "Cell-based face loop encountered face batch with different bids."));
 #endif
 
+        // hanging faces are excluded here and integrated over the subfaces below
+        Subfaces const *                subfaces[vectorization_length] = {};
+        dealii::VectorizedArray<Number> regular_face                   = 1.0;
+        for(unsigned int v = 0; v < n_filled_lanes; ++v)
+        {
+          subfaces[v] = this->get_subfaces_cell_based(cell, v, face);
+          if(subfaces[v] != nullptr)
+            regular_face[v] = 0.0;
+        }
+
         for(unsigned int j = 0; j < dofs_per_cell; ++j)
         {
           this->create_standard_basis(j, integrator_m);
@@ -1711,7 +1876,14 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_diagonal(
 
           // note: += for accumulation of all contributions of this (macro) cell
           //          including: cell-, face-, boundary-stiffness matrix
-          local_diag[j] += integrator_m.begin_dof_values()[j];
+          local_diag[j] += regular_face * integrator_m.begin_dof_values()[j];
+        }
+
+        for(unsigned int v = 0; v < n_filled_lanes; ++v)
+        {
+          if(subfaces[v] != nullptr)
+            this->add_subfaces_diagonal_cell_based(
+              integrator_m, integrator_p, *subfaces[v], local_diag, v);
         }
       }
     }
@@ -1954,6 +2126,11 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_block_diagonal(
                    "Cell-based face loop encountered face batch with different bids."));
 #endif
 
+        // hanging faces are excluded here and integrated over the subfaces below
+        Subfaces const * subfaces[vectorization_length] = {};
+        for(unsigned int v = 0; v < n_filled_lanes; ++v)
+          subfaces[v] = this->get_subfaces_cell_based(cell, v, face);
+
         for(unsigned int j = 0; j < dofs_per_cell; ++j)
         {
           this->create_standard_basis(j, integrator_m);
@@ -1973,14 +2150,157 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_block_diagonal(
 
           for(unsigned int i = 0; i < dofs_per_cell; ++i)
             for(unsigned int v = 0; v < n_filled_lanes; ++v)
-              matrices[cell * vectorization_length + v](i, j) +=
-                integrator_m.begin_dof_values()[i][v];
+              if(subfaces[v] == nullptr)
+                matrices[cell * vectorization_length + v](i, j) +=
+                  integrator_m.begin_dof_values()[i][v];
+        }
+
+        for(unsigned int v = 0; v < n_filled_lanes; ++v)
+        {
+          if(subfaces[v] != nullptr)
+            this->add_subfaces_block_diagonal_cell_based(
+              integrator_m, integrator_p, *subfaces[v], matrices[cell * vectorization_length + v]);
         }
       }
     }
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::initialize_subfaces_cell_based()
+{
+  unsigned int const n_faces = dealii::ReferenceCells::template get_hypercube<dim>().n_faces();
+  unsigned int const n_owned_cells = matrix_free->n_cell_batches() * vectorization_length;
+
+  auto const add_subfaces = [&](unsigned int const face) {
+    auto const & face_info = matrix_free->get_face_info(face);
+
+    // At a hanging face, the fine cell is the interior cell and the coarse cell the exterior cell.
+    if(face_info.subface_index == dealii::GeometryInfo<dim>::max_children_per_cell)
+      return;
+
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_face_batch(face); ++v)
+    {
+      unsigned int const cell = face_info.cells_exterior[v];
+      if(cell < n_owned_cells)
+        subfaces_cell_based[cell * n_faces + face_info.exterior_face_no].emplace_back(face, v);
+    }
+  };
+
+  // Since cell-based loops hold all faces to owned cells, subfaces with a fine ghost cell are
+  // contained in the ghost inner faces.
+  unsigned int const n_inner_faces = matrix_free->n_inner_face_batches();
+  for(unsigned int face = 0; face < n_inner_faces; ++face)
+    add_subfaces(face);
+
+  unsigned int const ghost_faces_begin = n_inner_faces + matrix_free->n_boundary_face_batches();
+  for(unsigned int face = ghost_faces_begin;
+      face < ghost_faces_begin + matrix_free->n_ghost_inner_face_batches();
+      ++face)
+    add_subfaces(face);
+}
+
+template<int dim, typename Number, int n_components>
+typename OperatorBase<dim, Number, n_components>::Subfaces const *
+OperatorBase<dim, Number, n_components>::get_subfaces_cell_based(unsigned int const cell,
+                                                                 unsigned int const v,
+                                                                 unsigned int const face) const
+{
+  if(subfaces_cell_based.empty())
+    return nullptr;
+
+  unsigned int const n_faces = dealii::ReferenceCells::template get_hypercube<dim>().n_faces();
+
+  auto const it = subfaces_cell_based.find((cell * vectorization_length + v) * n_faces + face);
+
+  return it == subfaces_cell_based.end() ? nullptr : &it->second;
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::add_subfaces_diagonal_cell_based(
+  IntegratorFace &                                         integrator_m,
+  IntegratorFace &                                         integrator_p,
+  Subfaces const &                                         subfaces,
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag,
+  unsigned int const                                       v) const
+{
+  for(auto const & [face, v_face] : subfaces)
+  {
+    this->reinit_face(integrator_m, integrator_p, face);
+
+    for(unsigned int j = 0; j < integrator_p.dofs_per_cell; ++j)
+    {
+      this->create_standard_basis(j, integrator_p);
+
+      integrator_p.evaluate(integrator_flags.face_evaluate);
+
+      this->do_face_ext_integral(integrator_m, integrator_p);
+
+      integrator_p.integrate(integrator_flags.face_integrate);
+
+      local_diag[j][v] += integrator_p.begin_dof_values()[j][v_face];
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::add_subfaces_block_diagonal_cell_based(
+  IntegratorFace & integrator_m,
+  IntegratorFace & integrator_p,
+  Subfaces const & subfaces,
+  LAPACKMatrix &   matrix) const
+{
+  for(auto const & [face, v_face] : subfaces)
+  {
+    this->reinit_face(integrator_m, integrator_p, face);
+
+    for(unsigned int j = 0; j < integrator_p.dofs_per_cell; ++j)
+    {
+      this->create_standard_basis(j, integrator_p);
+
+      integrator_p.evaluate(integrator_flags.face_evaluate);
+
+      this->do_face_ext_integral(integrator_m, integrator_p);
+
+      integrator_p.integrate(integrator_flags.face_integrate);
+
+      for(unsigned int i = 0; i < integrator_p.dofs_per_cell; ++i)
+        matrix(i, j) += integrator_p.begin_dof_values()[i][v_face];
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_add_subfaces_cell_based(
+  IntegratorFace &                              integrator_m,
+  IntegratorFace &                              integrator_p,
+  Subfaces const &                              subfaces,
+  dealii::VectorizedArray<Number> * const       dst,
+  dealii::VectorizedArray<Number> const * const src,
+  unsigned int const                            v) const
+{
+  for(auto const & [face, v_face] : subfaces)
+  {
+    this->reinit_face(integrator_m, integrator_p, face);
+
+    for(unsigned int i = 0; i < integrator_p.dofs_per_cell; ++i)
+      integrator_p.begin_dof_values()[i] = src[i][v];
+
+    integrator_p.evaluate(integrator_flags.face_evaluate);
+
+    this->do_face_ext_integral(integrator_m, integrator_p);
+
+    integrator_p.integrate(integrator_flags.face_integrate);
+
+    for(unsigned int i = 0; i < integrator_p.dofs_per_cell; ++i)
+      dst[i][v] += integrator_p.begin_dof_values()[i][v_face];
+  }
+}
+
 template<int dim, typename Number, int n_components>
 template<typename SparseMatrix>
 void
@@ -22,6 +22,9 @@
 #ifndef EXADG_OPERATORS_OPERATOR_BASE_H_
 #define EXADG_OPERATORS_OPERATOR_BASE_H_
 
+// C++
+#include <map>
+
 // deal.II
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/dofs/dof_handler.h>
@@ -172,6 +175,15 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Applies the operator to several vectors, dst[i] = A * src[i], within a single loop over cells
+   * and faces. Geometry and coefficient data are loaded only once per cell (face) batch for all
+   * vectors, which increases the arithmetic intensity compared to calling vmult() for each vector
+   * separately.
+   */
+  void
+  vmult(std::vector<VectorType *> const & dst, std::vector<VectorType const *> const & src) const;
+
   void
   vmult_add(VectorType & dst, VectorType const & src) const;
 
@@ -588,6 +600,29 @@ private:
                                   VectorType const &                      src,
                                   Range const &                           range) const;
 
+  /*
+   * Same as cell_loop(), face_loop(), and boundary_face_loop_hom_operator(), but for several
+   * vectors. The integrators are initialized once per cell (face) batch and reused for all
+   * vectors.
+   */
+  void
+  cell_loop_multiple(dealii::MatrixFree<dim, Number> const & matrix_free,
+                     std::vector<VectorType *> &             dst,
+                     std::vector<VectorType const *> const & src,
+                     Range const &                           range) const;
+
+  void
+  face_loop_multiple(dealii::MatrixFree<dim, Number> const & matrix_free,
+                     std::vector<VectorType *> &             dst,
+                     std::vector<VectorType const *> const & src,
+                     Range const &                           range) const;
+
+  void
+  boundary_face_loop_hom_operator_multiple(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                           std::vector<VectorType *> &             dst,
+                                           std::vector<VectorType const *> const & src,
+                                           Range const &                           range) const;
+
   // inhomogeneous operator
   void
   boundary_face_loop_inhom_operator(dealii::MatrixFree<dim, Number> const & matrix_free,
@@ -674,6 +709,50 @@ private:
                                  std::vector<LAPACKMatrix> const &       src,
                                  Range const &                           range) const;
 
+  /*
+   * Hanging faces in cell-based loops: The face data by cells of a coarse cell does not resolve the
+   * subfaces of a face with refined neighbors. The contributions of the coarse cell are therefore
+   * computed on the exterior side of the face batches of the subfaces, as in the face-based loops.
+   */
+
+  // list of subfaces given as (face batch, lane)
+  typedef std::vector<std::pair<unsigned int, unsigned int>> Subfaces;
+
+  // collect the subfaces for each face of a coarse cell (cell batch, lane)
+  void
+  initialize_subfaces_cell_based();
+
+  // returns nullptr if the face of the given cell is not a hanging face
+  Subfaces const *
+  get_subfaces_cell_based(unsigned int const cell,
+                          unsigned int const v,
+                          unsigned int const face) const;
+
+  // add the diagonal entries of lane v of a coarse cell resulting from the given subfaces
+  void
+  add_subfaces_diagonal_cell_based(
+    IntegratorFace &                                         integrator_m,
+    IntegratorFace &                                         integrator_p,
+    Subfaces const &                                         subfaces,
+    dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag,
+    unsigned int const                                       v) const;
+
+  // add the entries of the block matrix of a coarse cell resulting from the given subfaces
+  void
+  add_subfaces_block_diagonal_cell_based(IntegratorFace & integrator_m,
+                                         IntegratorFace & integrator_p,
+                                         Subfaces const & subfaces,
+                                         LAPACKMatrix &   matrix) const;
+
+  // apply the contributions of the given subfaces to the dof values src of lane v of a coarse cell
+  void
+  apply_add_subfaces_cell_based(IntegratorFace &                              integrator_m,
+                                IntegratorFace &                              integrator_p,
+                                Subfaces const &                              subfaces,
+                                dealii::VectorizedArray<Number> * const       dst,
+                                dealii::VectorizedArray<Number> const * const src,
+                                unsigned int const                            v) const;
+
   /*
    * Apply inverse block diagonal:
    *
@@ -765,6 +844,12 @@ private:
    */
   mutable VectorType weights;
 
+  /*
+   * Subfaces of hanging faces for cell-based loops, see initialize_subfaces_cell_based(). The key
+   * is (cell batch * vectorization_length + lane) * n_faces_per_cell + face.
+   */
+  std::map<unsigned int, Subfaces> subfaces_cell_based;
+
   unsigned int n_mpi_processes;
 
   // sparse matrices for matrix-based vmult
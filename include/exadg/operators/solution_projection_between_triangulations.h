@@ -185,22 +185,16 @@ assemble_projection_rhs(
 }
 
 /**
- * Utilitiy function to project vectors from a source to a target triangulation via
- * matrix-free mass operator evaluation and preconditioned CG solver.
+ * Utility function to set up the inverse mass operator of the target grid used for the projection.
  */
-template<int dim, typename Number, int n_components, typename VectorType>
-void
-project_vectors(
-  std::vector<VectorType *> const &                                        source_vectors,
-  dealii::DoFHandler<dim> const &                                          source_dof_handler,
-  std::shared_ptr<dealii::Mapping<dim> const> const &                      source_mapping,
-  std::vector<VectorType *> const &                                        target_vectors,
+template<int dim, int n_components, typename Number>
+std::shared_ptr<InverseMassOperator<dim, n_components, Number>>
+setup_inverse_mass_operator(
   dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> const & target_matrix_free,
   unsigned int const                                                       dof_index,
   unsigned int const                                                       quad_index,
   GridToGridProjectionData<dim> const &                                    data)
 {
-  // Setup inverse mass operator.
   InverseMassOperatorData<Number> inverse_mass_operator_data;
   inverse_mass_operator_data.dof_index                      = dof_index;
   inverse_mass_operator_data.quad_index                     = quad_index;
@@ -208,10 +202,28 @@ project_vectors(
   inverse_mass_operator_data.parameters.solver_data         = data.solver_data;
   inverse_mass_operator_data.parameters.implementation_type = data.inverse_mass_type;
 
-  InverseMassOperator<dim, n_components, Number> inverse_mass_operator;
-  inverse_mass_operator.initialize(target_matrix_free, inverse_mass_operator_data);
+  auto inverse_mass_operator = std::make_shared<InverseMassOperator<dim, n_components, Number>>();
+  inverse_mass_operator->initialize(target_matrix_free, inverse_mass_operator_data);
+
+  return inverse_mass_operator;
+}
 
-  dealii::Utilities::MPI::RemotePointEvaluation<dim> rpe_source(data.rpe_data);
+/**
+ * Utility function to set up the `RemotePointEvaluation` of the source grid in the integration
+ * points of the target grid, i.e., the point-to-cell lookup and the communication pattern.
+ */
+template<int dim, typename Number>
+std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>>
+setup_remote_point_evaluation(
+  dealii::DoFHandler<dim> const &                                          source_dof_handler,
+  std::shared_ptr<dealii::Mapping<dim> const> const &                      source_mapping,
+  dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> const & target_matrix_free,
+  unsigned int const                                                       dof_index,
+  unsigned int const                                                       quad_index,
+  GridToGridProjectionData<dim> const &                                    data)
+{
+  auto rpe_source = std::make_shared<dealii::Utilities::MPI::RemotePointEvaluation<dim>>(
+    data.rpe_data);
 
   // The sequence of integration points follows from the sequence of points as encountered during
   // cell batch loop.
@@ -220,11 +232,11 @@ project_vectors(
                                                           dof_index,
                                                           quad_index);
 
-  rpe_source.reinit(integration_points_target,
-                    source_dof_handler.get_triangulation(),
-                    *source_mapping);
+  rpe_source->reinit(integration_points_target,
+                     source_dof_handler.get_triangulation(),
+                     *source_mapping);
 
-  if(not rpe_source.all_points_found())
+  if(not rpe_source->all_points_found())
   {
     write_points_in_dummy_triangulation(
       integration_points_target, "./", "all_points", 0, source_dof_handler.get_mpi_communicator());
@@ -233,7 +245,7 @@ project_vectors(
     points_not_found.reserve(integration_points_target.size());
     for(unsigned int i = 0; i < integration_points_target.size(); ++i)
     {
-      if(not rpe_source.point_found(i))
+      if(not rpe_source->point_found(i))
       {
         points_not_found.push_back(integration_points_target[i]);
       }
@@ -242,12 +254,31 @@ project_vectors(
     write_points_in_dummy_triangulation(
       points_not_found, "./", "points_not_found", 0, source_dof_handler.get_mpi_communicator());
 
-    AssertThrow(rpe_source.all_points_found(),
+    AssertThrow(rpe_source->all_points_found(),
                 dealii::ExcMessage(
                   "Could not interpolate source grid vector in target grid. "
                   "Points exported to `./all_points.pvtu` and `./points_not_found.pvtu`"));
   }
 
+  return rpe_source;
+}
+
+/**
+ * Utility function to project vectors from a source to a target triangulation given a readily
+ * set up `RemotePointEvaluation` and inverse mass operator.
+ */
+template<int dim, typename Number, int n_components, typename VectorType>
+void
+do_project_vectors(
+  std::vector<VectorType *> const &                                        source_vectors,
+  dealii::DoFHandler<dim> const &                                          source_dof_handler,
+  dealii::Utilities::MPI::RemotePointEvaluation<dim> const &               rpe_source,
+  std::vector<VectorType *> const &                                        target_vectors,
+  dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> const & target_matrix_free,
+  InverseMassOperator<dim, n_components, Number> const &                   inverse_mass_operator,
+  unsigned int const                                                       dof_index,
+  unsigned int const                                                       quad_index)
+{
   // Loop over vectors and project.
   for(unsigned int i = 0; i < target_vectors.size(); ++i)
   {
@@ -276,22 +307,95 @@ project_vectors(
 }
 
 /**
- * Utility function to perform matrix-free grid-to-grid projection. We assume we only have a single
- * `dealii::FiniteElement` per `dealii::DoFHandler`. This function requires a suitable `MatrixFree`
- * object.
+ * Utilitiy function to project vectors from a source to a target triangulation via
+ * matrix-free mass operator evaluation and preconditioned CG solver.
  */
-template<int dim, typename Number, typename VectorType>
+template<int dim, typename Number, int n_components, typename VectorType>
 void
-do_grid_to_grid_projection(
+project_vectors(
+  std::vector<VectorType *> const &                                        source_vectors,
+  dealii::DoFHandler<dim> const &                                          source_dof_handler,
+  std::shared_ptr<dealii::Mapping<dim> const> const &                      source_mapping,
+  std::vector<VectorType *> const &                                        target_vectors,
+  dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> const & target_matrix_free,
+  unsigned int const                                                       dof_index,
+  unsigned int const                                                       quad_index,
+  GridToGridProjectionData<dim> const &                                    data)
+{
+  std::shared_ptr<InverseMassOperator<dim, n_components, Number>> inverse_mass_operator =
+    setup_inverse_mass_operator<dim, n_components, Number>(target_matrix_free,
+                                                           dof_index,
+                                                           quad_index,
+                                                           data);
+
+  std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>> rpe_source =
+    setup_remote_point_evaluation<dim, Number>(
+      source_dof_handler, source_mapping, target_matrix_free, dof_index, quad_index, data);
+
+  do_project_vectors<dim, Number, n_components, VectorType>(source_vectors,
+                                                            source_dof_handler,
+                                                            *rpe_source,
+                                                            target_vectors,
+                                                            target_matrix_free,
+                                                            *inverse_mass_operator,
+                                                            dof_index,
+                                                            quad_index);
+}
+
+/**
+ * Utility function to set up a `MatrixFree` object on the target grid suitable for the
+ * grid-to-grid projection, with one `dealii::DoFHandler` and quadrature per index.
+ */
+template<int dim, typename Number>
+void
+setup_matrix_free(
+  dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> & matrix_free,
+  std::vector<dealii::DoFHandler<dim> const *> const &               target_dof_handlers,
+  std::shared_ptr<dealii::Mapping<dim> const> const &                target_mapping,
+  GridToGridProjectionData<dim> const &                              data)
+{
+  // Setup a single `dealii::MatrixFree` object with multiple `dealii::DoFHandler`s.
+  MatrixFreeData<dim, Number> matrix_free_data;
+
+  MappingFlags mapping_flags;
+  mapping_flags.cells =
+    dealii::update_quadrature_points | dealii::update_values | dealii::update_JxW_values;
+  matrix_free_data.append_mapping_flags(mapping_flags);
+
+  dealii::AffineConstraints<Number> empty_constraints;
+  empty_constraints.clear();
+  empty_constraints.close();
+  for(unsigned int i = 0; i < target_dof_handlers.size(); ++i)
+  {
+    matrix_free_data.insert_dof_handler(target_dof_handlers[i], std::to_string(i));
+    matrix_free_data.insert_constraint(&empty_constraints, std::to_string(i));
+
+    ElementType element_type = get_element_type(target_dof_handlers[i]->get_triangulation());
+
+    std::shared_ptr<dealii::Quadrature<dim>> quadrature = create_quadrature<dim>(
+      element_type, target_dof_handlers[i]->get_fe().degree + data.additional_quadrature_points);
+
+    matrix_free_data.insert_quadrature(*quadrature, std::to_string(i));
+  }
+
+  matrix_free.reinit(*target_mapping,
+                     matrix_free_data.get_dof_handler_vector(),
+                     matrix_free_data.get_constraint_vector(),
+                     matrix_free_data.get_quadrature_vector(),
+                     matrix_free_data.data);
+}
+
+/**
+ * Utility function checking the dimensions of the vectors passed to the grid-to-grid projection.
+ */
+template<int dim, typename VectorType>
+void
+check_projection_input(
   std::vector<std::vector<VectorType *>> const &       source_vectors_per_dof_handler,
   std::vector<dealii::DoFHandler<dim> const *> const & source_dof_handlers,
-  std::shared_ptr<dealii::Mapping<dim> const> const &  source_mapping,
-  std::vector<std::vector<VectorType *>> &             target_vectors_per_dof_handler,
-  std::vector<dealii::DoFHandler<dim> const *> const & target_dof_handlers,
-  dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> const & matrix_free,
-  GridToGridProjectionData<dim> const &                                    data)
+  std::vector<std::vector<VectorType *>> const &       target_vectors_per_dof_handler,
+  std::vector<dealii::DoFHandler<dim> const *> const & target_dof_handlers)
 {
-  // Check input dimensions.
   AssertThrow(source_vectors_per_dof_handler.size() == source_dof_handlers.size(),
               dealii::ExcMessage("First dimension of source vector of vectors "
                                  "has to match source DoFHandler count."));
@@ -308,6 +412,29 @@ do_grid_to_grid_projection(
                   target_vectors_per_dof_handler.at(i).size(),
                 dealii::ExcMessage("Vectors of source and target vectors need to have same size."));
   }
+}
+
+/**
+ * Utility function to perform matrix-free grid-to-grid projection. We assume we only have a single
+ * `dealii::FiniteElement` per `dealii::DoFHandler`. This function requires a suitable `MatrixFree`
+ * object.
+ */
+template<int dim, typename Number, typename VectorType>
+void
+do_grid_to_grid_projection(
+  std::vector<std::vector<VectorType *>> const &       source_vectors_per_dof_handler,
+  std::vector<dealii::DoFHandler<dim> const *> const & source_dof_handlers,
+  std::shared_ptr<dealii::Mapping<dim> const> const &  source_mapping,
+  std::vector<std::vector<VectorType *>> &             target_vectors_per_dof_handler,
+  std::vector<dealii::DoFHandler<dim> const *> const & target_dof_handlers,
+  dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> const & matrix_free,
+  GridToGridProjectionData<dim> const &                                    data)
+{
+  // Check input dimensions.
+  check_projection_input<dim, VectorType>(source_vectors_per_dof_handler,
+                                          source_dof_handlers,
+                                          target_vectors_per_dof_handler,
+                                          target_dof_handlers);
 
   // Project vectors per `dealii::DoFHandler`.
   for(unsigned int i = 0; i < target_dof_handlers.size(); ++i)
@@ -372,36 +499,8 @@ grid_to_grid_projection(
   std::shared_ptr<dealii::Mapping<dim> const> const &  target_mapping,
   GridToGridProjectionData<dim> const &                data)
 {
-  // Setup a single `dealii::MatrixFree` object with multiple `dealii::DoFHandler`s.
-  MatrixFreeData<dim, Number> matrix_free_data;
-
-  MappingFlags mapping_flags;
-  mapping_flags.cells =
-    dealii::update_quadrature_points | dealii::update_values | dealii::update_JxW_values;
-  matrix_free_data.append_mapping_flags(mapping_flags);
-
-  dealii::AffineConstraints<Number> empty_constraints;
-  empty_constraints.clear();
-  empty_constraints.close();
-  for(unsigned int i = 0; i < target_dof_handlers.size(); ++i)
-  {
-    matrix_free_data.insert_dof_handler(target_dof_handlers[i], std::to_string(i));
-    matrix_free_data.insert_constraint(&empty_constraints, std::to_string(i));
-
-    ElementType element_type = get_element_type(target_dof_handlers[i]->get_triangulation());
-
-    std::shared_ptr<dealii::Quadrature<dim>> quadrature = create_quadrature<dim>(
-      element_type, target_dof_handlers[i]->get_fe().degree + data.additional_quadrature_points);
-
-    matrix_free_data.insert_quadrature(*quadrature, std::to_string(i));
-  }
-
   dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> matrix_free;
-  matrix_free.reinit(*target_mapping,
-                     matrix_free_data.get_dof_handler_vector(),
-                     matrix_free_data.get_constraint_vector(),
-                     matrix_free_data.get_quadrature_vector(),
-                     matrix_free_data.data);
+  setup_matrix_free<dim, Number>(matrix_free, target_dof_handlers, target_mapping, data);
 
   do_grid_to_grid_projection<dim, Number, VectorType>(source_vectors_per_dof_handler,
                                                       source_dof_handlers,
@@ -412,6 +511,151 @@ grid_to_grid_projection(
                                                       data);
 }
 
+/**
+ * Class for repeated projections between the same pair of grids, e.g., from a precursor to the
+ * main domain in every time step. In contrast to the functions above, the `MatrixFree` object of
+ * the target grid, the `RemotePointEvaluation` objects (point-to-cell lookup and communication
+ * pattern) and the inverse mass operators including their preconditioners are set up only once
+ * in `reinit()`, such that `project()` only evaluates the source vectors and solves the mass
+ * systems. `reinit()` has to be called again if one of the grids or mappings changes.
+ */
+template<int dim, typename Number, typename VectorType>
+class GridToGridProjector
+{
+  typedef dealii::MatrixFree<dim, Number, dealii::VectorizedArray<Number>> MatrixFreeType;
+
+public:
+  void
+  reinit(std::vector<dealii::DoFHandler<dim> const *> const & source_dof_handlers_in,
+         std::shared_ptr<dealii::Mapping<dim> const> const &  source_mapping_in,
+         std::vector<dealii::DoFHandler<dim> const *> const & target_dof_handlers_in,
+         std::shared_ptr<dealii::Mapping<dim> const> const &  target_mapping_in,
+         GridToGridProjectionData<dim> const &                data_in)
+  {
+    AssertThrow(source_dof_handlers_in.size() == target_dof_handlers_in.size(),
+                dealii::ExcMessage("Target and source DoFHandler counts have to match"));
+
+    source_dof_handlers = source_dof_handlers_in;
+    target_dof_handlers = target_dof_handlers_in;
+    source_mapping      = source_mapping_in;
+    target_mapping      = target_mapping_in.get();
+    data                = data_in;
+
+    // The MatrixFree object is referenced by the inverse mass operators and must therefore not
+    // be moved once these are set up.
+    matrix_free = std::make_shared<MatrixFreeType>();
+    setup_matrix_free<dim, Number>(*matrix_free, target_dof_handlers, target_mapping_in, data);
+
+    unsigned int const n_dof_handlers = target_dof_handlers.size();
+    rpe_source.clear();
+    rpe_source.resize(n_dof_handlers);
+    inverse_mass_scalar.clear();
+    inverse_mass_scalar.resize(n_dof_handlers);
+    inverse_mass_vectorial.clear();
+    inverse_mass_vectorial.resize(n_dof_handlers);
+    inverse_mass_conserved.clear();
+    inverse_mass_conserved.resize(n_dof_handlers);
+
+    for(unsigned int i = 0; i < n_dof_handlers; ++i)
+    {
+      unsigned int const n_components = target_dof_handlers[i]->get_fe().n_components();
+      if(n_components == 1)
+        setup<1>(i, inverse_mass_scalar[i]);
+      else if(n_components == dim)
+        setup<dim>(i, inverse_mass_vectorial[i]);
+      else if(n_components == dim + 2)
+        setup<dim + 2>(i, inverse_mass_conserved[i]);
+      else
+        AssertThrow(false,
+                    dealii::ExcMessage("The requested number of components is not "
+                                       "supported in `GridToGridProjector`."));
+    }
+  }
+
+  void
+  project(std::vector<std::vector<VectorType *>> const & source_vectors_per_dof_handler,
+          std::vector<std::vector<VectorType *>> &       target_vectors_per_dof_handler) const
+  {
+    AssertThrow(matrix_free.get() != nullptr,
+                dealii::ExcMessage("GridToGridProjector has not been initialized."));
+
+    check_projection_input<dim, VectorType>(source_vectors_per_dof_handler,
+                                            source_dof_handlers,
+                                            target_vectors_per_dof_handler,
+                                            target_dof_handlers);
+
+    for(unsigned int i = 0; i < target_dof_handlers.size(); ++i)
+    {
+      if(inverse_mass_scalar[i].get() != nullptr)
+        do_project_vectors<dim, Number, 1 /* n_components */, VectorType>(
+          source_vectors_per_dof_handler.at(i),
+          *source_dof_handlers.at(i),
+          *rpe_source[i],
+          target_vectors_per_dof_handler.at(i),
+          *matrix_free,
+          *inverse_mass_scalar[i],
+          i /* dof_index */,
+          i /* quad_index */);
+      else if(inverse_mass_vectorial[i].get() != nullptr)
+        do_project_vectors<dim, Number, dim /* n_components */, VectorType>(
+          source_vectors_per_dof_handler.at(i),
+          *source_dof_handlers.at(i),
+          *rpe_source[i],
+          target_vectors_per_dof_handler.at(i),
+          *matrix_free,
+          *inverse_mass_vectorial[i],
+          i /* dof_index */,
+          i /* quad_index */);
+      else
+        do_project_vectors<dim, Number, dim + 2 /* n_components */, VectorType>(
+          source_vectors_per_dof_handler.at(i),
+          *source_dof_handlers.at(i),
+          *rpe_source[i],
+          target_vectors_per_dof_handler.at(i),
+          *matrix_free,
+          *inverse_mass_conserved[i],
+          i /* dof_index */,
+          i /* quad_index */);
+    }
+  }
+
+private:
+  template<int n_components>
+  void
+  setup(unsigned int const                                                dof_index,
+        std::shared_ptr<InverseMassOperator<dim, n_components, Number>> & inverse_mass_operator)
+  {
+    inverse_mass_operator = setup_inverse_mass_operator<dim, n_components, Number>(
+      *matrix_free, dof_index, dof_index /* quad_index */, data);
+
+    rpe_source[dof_index] =
+      setup_remote_point_evaluation<dim, Number>(*source_dof_handlers[dof_index],
+                                                 source_mapping,
+                                                 *matrix_free,
+                                                 dof_index,
+                                                 dof_index /* quad_index */,
+                                                 data);
+  }
+
+  std::vector<dealii::DoFHandler<dim> const *> source_dof_handlers;
+  std::vector<dealii::DoFHandler<dim> const *> target_dof_handlers;
+  std::shared_ptr<dealii::Mapping<dim> const>  source_mapping;
+  GridToGridProjectionData<dim>                data;
+
+  // The MatrixFree object only references the target mapping (as well as the target
+  // triangulations), which therefore has to outlive this object.
+  dealii::ObserverPointer<dealii::Mapping<dim> const> target_mapping;
+
+  std::shared_ptr<MatrixFreeType> matrix_free;
+
+  // one entry per DoFHandler, only the inverse mass operator matching the number of components
+  // of the respective finite element is set up
+  std::vector<std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>>> rpe_source;
+  std::vector<std::shared_ptr<InverseMassOperator<dim, 1, Number>>>       inverse_mass_scalar;
+  std::vector<std::shared_ptr<InverseMassOperator<dim, dim, Number>>>     inverse_mass_vectorial;
+  std::vector<std::shared_ptr<InverseMassOperator<dim, dim + 2, Number>>> inverse_mass_conserved;
+};
+
 } // namespace GridToGridProjection
 } // namespace ExaDG
 
@@ -183,20 +183,34 @@ template<int dim, typename Number>
 std::tuple<unsigned int, dealii::types::global_dof_index, double>
 Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
                                     unsigned int const   n_repetitions_inner,
-                                    unsigned int const   n_repetitions_outer) const
+                                    unsigned int const   n_repetitions_outer,
+                                    unsigned int const   n_vectors) const
 {
   pcout << std::endl << "Computing matrix-vector product ..." << std::endl;
 
-  dealii::LinearAlgebra::distributed::Vector<Number> dst, src;
-  pde_operator->initialize_dof_vector(src);
-  pde_operator->initialize_dof_vector(dst);
-  src = 1.0;
+  AssertThrow(n_vectors >= 1, dealii::ExcMessage("At least one vector is needed."));
+  AssertThrow(n_vectors == 1 or operator_type == OperatorType::Apply,
+              dealii::ExcMessage("Several vectors are only implemented for OperatorType::Apply."));
+
+  std::vector<dealii::LinearAlgebra::distributed::Vector<Number>> dst(n_vectors), src(n_vectors);
+  std::vector<dealii::LinearAlgebra::distributed::Vector<Number> *>       dst_ptrs(n_vectors);
+  std::vector<dealii::LinearAlgebra::distributed::Vector<Number> const *> src_ptrs(n_vectors);
+  for(unsigned int i = 0; i < n_vectors; ++i)
+  {
+    pde_operator->initialize_dof_vector(src[i]);
+    pde_operator->initialize_dof_vector(dst[i]);
+    src[i]      = 1.0;
+    dst_ptrs[i] = &dst[i];
+    src_ptrs[i] = &src[i];
+  }
 
   const std::function<void(void)> operator_evaluation = [&](void) {
     if(operator_type == OperatorType::Evaluate)
-      pde_operator->evaluate(dst, src, 0.0);
+      pde_operator->evaluate(dst[0], src[0], 0.0);
+    else if(operator_type == OperatorType::Apply and n_vectors == 1)
+      pde_operator->vmult(dst[0], src[0]);
     else if(operator_type == OperatorType::Apply)
-      pde_operator->vmult(dst, src);
+      pde_operator->vmult(dst_ptrs, src_ptrs);
     else
       AssertThrow(false, dealii::ExcMessage("not implemented."));
   };
@@ -211,7 +225,7 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
   // calculate throughput
   dealii::types::global_dof_index const dofs = pde_operator->get_number_of_dofs();
 
-  double const throughput = (double)dofs / wall_time;
+  double const throughput = (double)dofs * n_vectors / wall_time;
 
   unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
@@ -219,6 +233,7 @@ Driver<dim, Number>::apply_operator(OperatorType const & operator_type,
   {
     // clang-format off
     pcout << std::endl
+          << "Number of vectors: " << n_vectors << std::endl
           << std::scientific << std::setprecision(4)
           << "DoFs/sec:        " << throughput << std::endl
           << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl;
@@ -62,12 +62,15 @@ public:
   print_performance_results(double const total_time) const;
 
   /*
-   * Throughput study
+   * Throughput study. For n_vectors > 1, the operator is applied to n_vectors vectors within a
+   * single loop (only for OperatorType::Apply), and the throughput refers to the DoFs of all
+   * vectors.
    */
   std::tuple<unsigned int, dealii::types::global_dof_index, double>
   apply_operator(OperatorType const & operator_type,
                  unsigned int const   n_repetitions_inner,
-                 unsigned int const   n_repetitions_outer) const;
+                 unsigned int const   n_repetitions_outer,
+                 unsigned int const   n_vectors = 1) const;
 
 private:
   // MPI communicator
@@ -454,6 +454,14 @@ Operator<dim, n_components, Number>::vmult(VectorType & dst, VectorType const &
   laplace_operator.vmult(dst, src);
 }
 
+template<int dim, int n_components, typename Number>
+void
+Operator<dim, n_components, Number>::vmult(std::vector<VectorType *> const &       dst,
+                                           std::vector<VectorType const *> const & src) const
+{
+  laplace_operator.vmult(dst, src);
+}
+
 template<int dim, int n_components, typename Number>
 void
 Operator<dim, n_components, Number>::evaluate(VectorType &       dst,
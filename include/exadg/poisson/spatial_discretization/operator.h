@@ -92,6 +92,12 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Applies the operator to several vectors at once, see OperatorBase::vmult().
+   */
+  void
+  vmult(std::vector<VectorType *> const & dst, std::vector<VectorType const *> const & src) const;
+
   void
   evaluate(VectorType & dst, VectorType const & src, double const time = 0.0) const;
 
@@ -81,7 +81,8 @@ run(ThroughputParameters<Poisson::OperatorType> const & throughput,
     unsigned int const                                  refine_space,
     unsigned int const                                  n_cells_1d,
     MPI_Comm const &                                    mpi_comm,
-    bool const                                          is_test)
+    bool const                                          is_test,
+    unsigned int const                                  n_vectors)
 {
   std::shared_ptr<Poisson::ApplicationBase<dim, 1, Number>> application =
     Poisson::get_application<dim, 1, Number>(input_file, mpi_comm);
@@ -96,7 +97,8 @@ run(ThroughputParameters<Poisson::OperatorType> const & throughput,
   std::tuple<unsigned int, dealii::types::global_dof_index, double> wall_time =
     driver->apply_operator(throughput.operator_type,
                            throughput.n_repetitions_inner,
-                           throughput.n_repetitions_outer);
+                           throughput.n_repetitions_outer,
+                           n_vectors);
 
   throughput.wall_times.push_back(wall_time);
 }
@@ -146,6 +148,9 @@ main(int argc, char ** argv)
   ExaDG::Poisson::SpatialDiscretization spatial_discretization =
     ExaDG::Poisson::SpatialDiscretization::Undefined;
 
+  // numbers of vectors the operator is applied to simultaneously
+  std::vector<unsigned int> n_vectors_list = {1};
+
   dealii::ParameterHandler prm;
   prm.enter_subsection("Throughput");
   {
@@ -154,6 +159,11 @@ main(int argc, char ** argv)
                       "Spatial discretization (CG vs. DG).",
                       ExaDG::Patterns::Enum<ExaDG::Poisson::SpatialDiscretization>(),
                       true);
+    prm.add_parameter("NumberOfVectors",
+                      n_vectors_list,
+                      "List of numbers of vectors the operator is applied to within one loop.",
+                      dealii::Patterns::List(dealii::Patterns::Integer(1)),
+                      false);
   }
   prm.leave_subsection();
 
@@ -172,42 +182,80 @@ main(int argc, char ** argv)
   // fill resolution vector depending on the operator_type
   resolution.fill_resolution_vector(lambda_get_dofs_per_element);
 
-  // loop over resolutions vector and run simulations
-  for(auto iter = resolution.resolutions.begin(); iter != resolution.resolutions.end(); ++iter)
+  // loop over numbers of vectors
+  for(unsigned int const n_vectors : n_vectors_list)
   {
-    unsigned int const degree       = std::get<0>(*iter);
-    unsigned int const refine_space = std::get<1>(*iter);
-    unsigned int const n_cells_1d   = std::get<2>(*iter);
-
-    if(general.dim == 2 and general.precision == "float")
-    {
-      ExaDG::run<2, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else if(general.dim == 2 and general.precision == "double")
-    {
-      ExaDG::run<2, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else if(general.dim == 3 and general.precision == "float")
+    // loop over resolutions vector and run simulations
+    for(auto iter = resolution.resolutions.begin(); iter != resolution.resolutions.end(); ++iter)
     {
-      ExaDG::run<3, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
+      unsigned int const degree       = std::get<0>(*iter);
+      unsigned int const refine_space = std::get<1>(*iter);
+      unsigned int const n_cells_1d   = std::get<2>(*iter);
+
+      if(general.dim == 2 and general.precision == "float")
+      {
+        ExaDG::run<2, float>(throughput,
+                             input_file,
+                             degree,
+                             refine_space,
+                             n_cells_1d,
+                             mpi_comm,
+                             general.is_test,
+                             n_vectors);
+      }
+      else if(general.dim == 2 and general.precision == "double")
+      {
+        ExaDG::run<2, double>(throughput,
+                              input_file,
+                              degree,
+                              refine_space,
+                              n_cells_1d,
+                              mpi_comm,
+                              general.is_test,
+                              n_vectors);
+      }
+      else if(general.dim == 3 and general.precision == "float")
+      {
+        ExaDG::run<3, float>(throughput,
+                             input_file,
+                             degree,
+                             refine_space,
+                             n_cells_1d,
+                             mpi_comm,
+                             general.is_test,
+                             n_vectors);
+      }
+      else if(general.dim == 3 and general.precision == "double")
+      {
+        ExaDG::run<3, double>(throughput,
+                              input_file,
+                              degree,
+                              refine_space,
+                              n_cells_1d,
+                              mpi_comm,
+                              general.is_test,
+                              n_vectors);
+      }
+      else
+      {
+        AssertThrow(false,
+                    dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
+      }
     }
-    else if(general.dim == 3 and general.precision == "double")
-    {
-      ExaDG::run<3, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
-    }
-    else
+
+    if(not(general.is_test))
     {
-      AssertThrow(false,
-                  dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
+      if(n_vectors > 1)
+        ExaDG::print_throughput(throughput.wall_times,
+                                ExaDG::Utilities::enum_to_string(throughput.operator_type) +
+                                  " (" + std::to_string(n_vectors) + " vectors)",
+                                mpi_comm);
+      else
+        throughput.print_results(mpi_comm);
     }
-  }
 
-  if(not(general.is_test))
-    throughput.print_results(mpi_comm);
+    throughput.wall_times.clear();
+  }
 
 #ifdef EXADG_WITH_LIKWID
   LIKWID_MARKER_CLOSE;
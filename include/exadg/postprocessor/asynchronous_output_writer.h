@@ -0,0 +1,66 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_POSTPROCESSOR_ASYNCHRONOUS_OUTPUT_WRITER_H_
+#define EXADG_POSTPROCESSOR_ASYNCHRONOUS_OUTPUT_WRITER_H_
+
+// C/C++
+#include <functional>
+#include <future>
+
+namespace ExaDG
+{
+/**
+ * Runs output tasks in the background, one at a time. Submitting a new task waits for the
+ * previous one to be completed (back-pressure), and the destructor waits for the last one.
+ */
+class AsynchronousOutputWriter
+{
+public:
+  ~AsynchronousOutputWriter()
+  {
+    if(task.valid())
+      task.wait();
+  }
+
+  void
+  submit(std::function<void()> const & output_task)
+  {
+    wait();
+
+    task = std::async(std::launch::async, output_task);
+  }
+
+  void
+  wait()
+  {
+    // get() re-throws exceptions that occurred in the background task
+    if(task.valid())
+      task.get();
+  }
+
+private:
+  std::future<void> task;
+};
+
+} // namespace ExaDG
+
+#endif /* EXADG_POSTPROCESSOR_ASYNCHRONOUS_OUTPUT_WRITER_H_ */
@@ -70,13 +70,21 @@ public:
   /**
    * Constructor
    *
-   * @param write     flush simulation data to hard drive for later post processing
-   * @param inplace   create energy spectrum at run time
+   * @param write           flush simulation data to hard drive for later post processing
+   * @param inplace         create energy spectrum at run time
+   * @param measure_plans   create FFTW plans with FFTW_MEASURE instead of FFTW_ESTIMATE
+   * @param wisdom_file     file to load/store FFTW wisdom (empty: no wisdom)
    *
    */
-  DealSpectrumWrapper(MPI_Comm const & comm, bool write, bool inplace)
+  DealSpectrumWrapper(MPI_Comm const &    comm,
+                      bool                write,
+                      bool                inplace,
+                      bool                measure_plans = false,
+                      std::string const & wisdom_file   = "")
     : comm(comm), write(write), inplace(inplace), s(comm), ipol(comm, s), fftw(comm, s)
   {
+    s.measure_plans = measure_plans;
+    s.wisdom_file   = wisdom_file;
   }
 
   virtual ~DealSpectrumWrapper()
@@ -312,7 +320,7 @@ namespace ExaDG
 class DealSpectrumWrapper
 {
 public:
-  DealSpectrumWrapper(MPI_Comm const &, bool, bool)
+  DealSpectrumWrapper(MPI_Comm const &, bool, bool, bool = false, std::string const & = "")
   {
   }
 
@@ -601,8 +609,11 @@ KineticEnergySpectrumCalculator<dim, Number>::setup(
 
     if(deal_spectrum_wrapper == nullptr)
     {
-      deal_spectrum_wrapper =
-        std::make_shared<DealSpectrumWrapper>(mpi_comm, data.write_raw_data_to_files, data.do_fftw);
+      deal_spectrum_wrapper = std::make_shared<DealSpectrumWrapper>(mpi_comm,
+                                                                    data.write_raw_data_to_files,
+                                                                    data.do_fftw,
+                                                                    data.fftw_measure_plans,
+                                                                    data.fftw_wisdom_file);
     }
 
     unsigned int evaluation_points = std::max(data.degree + 1, data.evaluation_points_per_cell);
@@ -655,8 +666,12 @@ KineticEnergySpectrumCalculator<dim, Number>::evaluate(VectorType const & veloci
       unsigned int n_cells_1d =
         data.n_cells_1d_coarse_grid * dealii::Utilities::pow(2, data.refine_level);
 
-      velocity_full = std::make_shared<VectorType>();
-      initialize_dof_vector(*velocity_full, *dof_handler_full);
+      // the full vector is created once and reused for subsequent evaluations
+      if(velocity_full == nullptr)
+      {
+        velocity_full = std::make_shared<VectorType>();
+        initialize_dof_vector(*velocity_full, *dof_handler_full);
+      }
 
       apply_taylor_green_symmetry(*dof_handler,
                                   *dof_handler_full,
@@ -41,6 +41,8 @@ struct KineticEnergySpectrumData
   KineticEnergySpectrumData()
     : write_raw_data_to_files(false),
       do_fftw(true),
+      fftw_measure_plans(false),
+      fftw_wisdom_file(""),
       directory("output/"),
       filename("energy_spectrum"),
       clear_file(true),
@@ -64,6 +66,12 @@ struct KineticEnergySpectrumData
       pcout << std::endl << "  Calculate kinetic energy spectrum:" << std::endl;
       print_parameter(pcout, "Write raw data to files", write_raw_data_to_files);
       print_parameter(pcout, "Do FFTW", do_fftw);
+      if(do_fftw)
+      {
+        print_parameter(pcout, "Measure FFTW plans", fftw_measure_plans);
+        if(not fftw_wisdom_file.empty())
+          print_parameter(pcout, "FFTW wisdom file", fftw_wisdom_file);
+      }
       print_parameter(pcout, "Directory of output files", directory);
       print_parameter(pcout, "Filename", filename);
       print_parameter(pcout, "Clear file", clear_file);
@@ -85,6 +93,12 @@ struct KineticEnergySpectrumData
   bool write_raw_data_to_files;
   bool do_fftw;
 
+  // FFTW plans are created once and reused for all evaluations. Measuring plans (FFTW_MEASURE)
+  // increases the setup costs but typically pays off if the spectrum is evaluated frequently.
+  // Wisdom is loaded from and stored to the specified file if it is not empty.
+  bool        fftw_measure_plans;
+  std::string fftw_wisdom_file;
+
   // these parameters are only relevant if do_fftw = true
   std::string directory;
   std::string filename;
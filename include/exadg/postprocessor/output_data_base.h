@@ -22,12 +22,21 @@
 #ifndef EXADG_POSTPROCESSOR_OUTPUT_DATA_BASE_H_
 #define EXADG_POSTPROCESSOR_OUTPUT_DATA_BASE_H_
 
+// deal.II
+#include <deal.II/base/data_out_base.h>
+
 // ExaDG
 #include <exadg/postprocessor/time_control.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
 {
+enum class OutputFormat
+{
+  VTU,
+  HDF5
+};
+
 struct OutputDataBase
 {
   OutputDataBase()
@@ -39,8 +48,37 @@ struct OutputDataBase
       write_aspect_ratio(false),
       write_processor_id(false),
       write_higher_order(true),
-      degree(1)
+      degree(1),
+      compression_level(dealii::DataOutBase::VtkFlags().compression_level),
+      output_format(OutputFormat::VTU),
+      n_output_groups(dealii::numbers::invalid_unsigned_int),
+      write_asynchronously(false)
+  {
+  }
+
+  void
+  check() const
   {
+    if(write_asynchronously)
+    {
+      AssertThrow(output_format == OutputFormat::VTU,
+                  dealii::ExcMessage("Asynchronous output is only implemented for VTU output."));
+
+      AssertThrow(get_n_output_groups() == 0,
+                  dealii::ExcMessage("Asynchronous output writes one file per process. Set "
+                                     "n_output_groups = 0 or keep the default in order to use "
+                                     "asynchronous output."));
+    }
+  }
+
+  // number of output groups resolving the default, see n_output_groups
+  unsigned int
+  get_n_output_groups() const
+  {
+    if(n_output_groups == dealii::numbers::invalid_unsigned_int)
+      return write_asynchronously ? 0 : 4;
+    else
+      return n_output_groups;
   }
 
   void
@@ -61,6 +99,12 @@ struct OutputDataBase
 
       print_parameter(pcout, "Write higher order", write_higher_order);
       print_parameter(pcout, "Polynomial degree", degree);
+      print_parameter(pcout, "Compression level", compression_level);
+
+      print_parameter(pcout, "Output format", output_format);
+      if(output_format == OutputFormat::VTU)
+        print_parameter(pcout, "Number of output groups", get_n_output_groups());
+      print_parameter(pcout, "Write asynchronously", write_asynchronously);
     }
   }
 
@@ -100,6 +144,36 @@ struct OutputDataBase
   // case of write_higher_order = false, this variable defines the number of subdivisions of a cell,
   // with ParaView using linear interpolation for visualization on these subdivided cells.
   unsigned int degree;
+
+  // zlib compression level of the binary data in .vtu files. Stronger compression reduces the
+  // amount of data written to disk at the price of more computational work when writing. Note
+  // that deal.II stores the field data of .vtu files in single precision (Float32) anyway, so
+  // compression is the remaining knob to reduce file sizes. The default is the one of deal.II.
+  dealii::DataOutBase::CompressionLevel compression_level;
+
+  // file format of the solution fields written in every output step:
+  //  - VTU: one or several .vtu files per output step (see n_output_groups) and a .pvtu record
+  //  - HDF5: a single .h5 file per output step, written by all processes via collective MPI-IO,
+  //    and an .xdmf file describing its content. This avoids creating a large number of files on
+  //    large process counts. Requires deal.II to be configured with HDF5. Note that higher order
+  //    cells are not supported by XDMF, i.e., cells are subdivided according to degree and
+  //    visualized with linear interpolation on the subcells.
+  OutputFormat output_format;
+
+  // number of .vtu files written per output step in case of OutputFormat::VTU, i.e., the number
+  // of groups of processes aggregating their data into one file via MPI-IO. A value of 0 writes
+  // one file per process. By default (dealii::numbers::invalid_unsigned_int), 4 groups are used
+  // for synchronous output and one file per process for asynchronous output.
+  unsigned int n_output_groups;
+
+  // Build patches and write files in a background thread while the time loop continues. The
+  // vectors are copied synchronously. A new output waits for the previous one to be completed.
+  // Since the background thread must not communicate, each process writes its own .vtu file,
+  // i.e., n_output_groups has to be 0 (the default in this case), and only OutputFormat::VTU is
+  // supported. The mesh/mapping must not change while output is written, i.e., this option is not
+  // supported for moving meshes (ALE), and solvers with adaptive mesh refinement wait for the
+  // output to be completed before changing the mesh.
+  bool write_asynchronously;
 };
 
 } // namespace ExaDG
@@ -41,6 +41,8 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
   mapping     = &mapping_in;
   output_data = output_data_in;
 
+  output_data.check();
+
   time_control.setup(output_data_in.time_control_data);
 
   if(output_data_in.time_control_data.is_active)
@@ -90,13 +92,21 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & solution,
 {
   print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
 
-  VectorWriter<dim, Number> vector_writer(output_data, time_control.get_counter(), mpi_comm);
+  auto vector_writer =
+    std::make_shared<VectorWriter<dim, Number>>(output_data, time_control.get_counter(), mpi_comm);
+
+  vector_writer->add_data_vector(solution, *dof_handler, {"solution"});
 
-  vector_writer.add_data_vector(solution, *dof_handler, {"solution"});
+  vector_writer->write_aspect_ratio(*dof_handler, *mapping);
 
-  vector_writer.write_aspect_ratio(*dof_handler, *mapping);
+  write_vector_output(vector_writer, output_data, asynchronous_writer, &(*mapping), time);
+}
 
-  vector_writer.write_pvtu(&(*mapping));
+template<int dim, typename Number>
+void
+OutputGenerator<dim, Number>::wait_for_output()
+{
+  asynchronous_writer.wait();
 }
 
 template class OutputGenerator<2, float>;
@@ -28,6 +28,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/postprocessor/asynchronous_output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/time_control.h>
 
@@ -49,6 +50,10 @@ public:
   void
   evaluate(VectorType const & solution, double const time, bool const unsteady);
 
+  // wait until asynchronous output has been written, e.g., before the mesh is changed
+  void
+  wait_for_output();
+
   TimeControl time_control;
 
 private:
@@ -57,6 +62,9 @@ private:
   dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::ObserverPointer<dealii::Mapping<dim> const>    mapping;
   OutputDataBase                                         output_data;
+
+  // writes output in the background in case of asynchronous output
+  mutable AsynchronousOutputWriter asynchronous_writer;
 };
 
 } // namespace ExaDG
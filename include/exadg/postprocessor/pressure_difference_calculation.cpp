@@ -24,7 +24,6 @@
 
 // ExaDG
 #include <exadg/postprocessor/pressure_difference_calculation.h>
-#include <exadg/postprocessor/solution_interpolation.h>
 #include <exadg/utilities/create_directories.h>
 #include <exadg/utilities/print_functions.h>
 
@@ -41,6 +40,7 @@ PressureDifferenceData<dim>::print(dealii::ConditionalOStream & pcout, bool cons
 
     print_parameter(pcout, "Point 1", point_1);
     print_parameter(pcout, "Point 2", point_2);
+    print_parameter(pcout, "Update points before evaluation", update_points_before_evaluation);
 
     print_parameter(pcout, "Directory", directory);
     print_parameter(pcout, "Filename", filename);
@@ -67,7 +67,19 @@ PressureDifferenceCalculator<dim, Number>::setup(
   time_control.setup(data.time_control_data);
 
   if(data.time_control_data.is_active)
+  {
     create_directories(data.directory, mpi_comm);
+
+    // only the root process writes the results to file and therefore needs the point values
+    std::vector<dealii::Point<dim>> points;
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      points = {data.point_1, data.point_2};
+
+    point_evaluator.setup(points,
+                          dof_handler_pressure->get_triangulation(),
+                          *mapping,
+                          data.update_points_before_evaluation);
+  }
 }
 
 template<int dim, typename Number>
@@ -75,21 +87,15 @@ void
 PressureDifferenceCalculator<dim, Number>::evaluate(VectorType const & pressure,
                                                     double const       time) const
 {
-  Number pressure_1 = 0.0, pressure_2 = 0.0;
+  std::vector<Number> const values =
+    point_evaluator.template evaluate<1>(*dof_handler_pressure, pressure);
 
-  dealii::Point<dim> point_1, point_2;
-  point_1 = data.point_1;
-  point_2 = data.point_2;
-
-  evaluate_scalar_quantity_in_point(
-    pressure_1, *dof_handler_pressure, *mapping, pressure, point_1, mpi_comm);
-  evaluate_scalar_quantity_in_point(
-    pressure_2, *dof_handler_pressure, *mapping, pressure, point_2, mpi_comm);
-
-  Number const pressure_difference = pressure_1 - pressure_2;
+  AssertThrow(point_evaluator.all_points_found(), dealii::ExcMessage("No points found."));
 
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
+    Number const pressure_difference = values[0] - values[1];
+
     std::string filename = data.directory + data.filename;
 
     unsigned int precision = 12;
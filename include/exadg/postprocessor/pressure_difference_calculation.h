@@ -31,6 +31,7 @@
 
 // ExaDG
 #include <exadg/postprocessor/solution_field.h>
+#include <exadg/postprocessor/solution_interpolation.h>
 #include <exadg/postprocessor/time_control.h>
 
 namespace ExaDG
@@ -38,7 +39,8 @@ namespace ExaDG
 template<int dim>
 struct PressureDifferenceData
 {
-  PressureDifferenceData() : directory("output/"), filename("pressure_difference")
+  PressureDifferenceData()
+    : update_points_before_evaluation(false), directory("output/"), filename("pressure_difference")
   {
   }
 
@@ -54,6 +56,12 @@ struct PressureDifferenceData
   dealii::Point<dim> point_1;
   dealii::Point<dim> point_2;
 
+  /*
+   *  The points are located in the mesh only once. For moving meshes, set this parameter to true
+   *  to search the points again before every evaluation.
+   */
+  bool update_points_before_evaluation;
+
   /*
    *  directory and filename
    */
@@ -91,6 +99,8 @@ private:
   dealii::ObserverPointer<dealii::Mapping<dim> const>    mapping;
 
   PressureDifferenceData<dim> data;
+
+  PointEvaluator<dim> point_evaluator;
 };
 
 } // namespace ExaDG
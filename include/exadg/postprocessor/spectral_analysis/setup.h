@@ -24,6 +24,7 @@
 
 // C/C++
 #include <mpi.h>
+#include <string>
 
 // define helper funtions
 #ifndef MIN
@@ -86,6 +87,10 @@ public:
   int bins;
   // time stemp
   double time = 0.0;
+  // create FFTW plans with FFTW_MEASURE instead of FFTW_ESTIMATE
+  bool measure_plans = false;
+  // file from which FFTW wisdom is loaded and to which it is stored (empty: no wisdom)
+  std::string wisdom_file;
 
   /**
    * Constructor
@@ -98,6 +98,10 @@ public:
       return;
     this->initialized = true;
 
+    // the MPI interface of FFTW has to be initialized before any other fftw_mpi function is called
+    // (repeated calls are harmless)
+    fftw_mpi_init();
+
     // extract settings
     this->N    = s.cells * s.points_dst;
     this->dim  = s.dim;
@@ -139,10 +143,6 @@ public:
     // ... and save required size
     this->bsize = 2 * alloc_local;
 
-    // initialize input array with zero (not needed: only useful for IO -> hard zero)
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
-      u_real[i] = 0;
-
     // set pointer for v input field
     v_real = u_real + 2 * alloc_local;
 
@@ -157,6 +157,14 @@ public:
       w_comp = fftw_alloc_complex(alloc_local);
     }
 
+    // create plans once (planning with FFTW_MEASURE overwrites the arrays, so this has to be done
+    // before the input array is initialized)
+    create_plans();
+
+    // initialize input array with zero (not needed: only useful for IO -> hard zero)
+    for(int i = 0; i < 2 * alloc_local * dim; i++)
+      u_real[i] = 0;
+
     // allocate memory and ...
     this->e = new double[N];
     this->E = new double[N];
@@ -178,6 +186,11 @@ public:
     // free data structures
     delete[] _indices_proc_rows;
 
+    fftw_destroy_plan(plan_u);
+    fftw_destroy_plan(plan_v);
+    if(dim == 3)
+      fftw_destroy_plan(plan_w);
+
     free(n);
     fftw_free(u_comp);
     fftw_free(v_comp);
@@ -197,28 +210,20 @@ public:
   }
 
   /**
-   * Perform FFT with FFTW
+   * Perform FFT with FFTW using the plans created in init()
    */
   void
   execute()
   {
-    // perform FFT for u
-    fftw_plan pu = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pu);
-    fftw_destroy_plan(pu);
+    // perform FFT for u ...
+    fftw_execute(plan_u);
 
     // ... for v
-    fftw_plan pv = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pv);
-    fftw_destroy_plan(pv);
+    fftw_execute(plan_v);
 
     // ... for w
     if(dim == 3)
-    {
-      fftw_plan pw = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, FFTW_ESTIMATE);
-      fftw_execute(pw);
-      fftw_destroy_plan(pw);
-    }
+      fftw_execute(plan_w);
   }
 
   void
@@ -470,6 +475,37 @@ public:
   }
 
 private:
+  /**
+   * Create the r2c plans for all velocity components. If a wisdom file is specified in the
+   * setup, it is read by rank 0 and broadcast before planning, and the (possibly extended) wisdom
+   * is gathered and written back afterwards, such that subsequent runs can skip the measurement.
+   */
+  void
+  create_plans()
+  {
+    unsigned int const flags = s.measure_plans ? FFTW_MEASURE : FFTW_ESTIMATE;
+
+    bool const use_wisdom = not s.wisdom_file.empty();
+    if(use_wisdom)
+    {
+      if(rank == 0)
+        fftw_import_wisdom_from_filename(s.wisdom_file.c_str());
+      fftw_mpi_broadcast_wisdom(comm);
+    }
+
+    plan_u = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, flags);
+    plan_v = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, flags);
+    if(dim == 3)
+      plan_w = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, flags);
+
+    if(use_wisdom)
+    {
+      fftw_mpi_gather_wisdom(comm);
+      if(rank == 0)
+        fftw_export_wisdom_to_filename(s.wisdom_file.c_str());
+    }
+  }
+
   // number of dofs in each direction
   int N;
   // dimensions
@@ -505,6 +541,12 @@ private:
   fftw_complex * v_comp;
   // ... for w
   fftw_complex * w_comp;
+  // FFTW plan for u (created once in init() and reused for every call of execute())
+  fftw_plan plan_u;
+  // ... for v
+  fftw_plan plan_v;
+  // ... for w
+  fftw_plan plan_w;
 
 private:
   // array for locally collecting energy
@@ -26,6 +26,9 @@
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/distributed/tria_base.h>
 #include <deal.II/fe/fe_values.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 // ExaDG
 #include <exadg/grid/grid_data.h>
@@ -292,10 +295,115 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
 
     AssertThrow(y_glob.size() == n_points_y_glob, dealii::ExcInternalError());
 
+    if(data.use_matrix_free_evaluation)
+      setup_matrix_free_evaluation();
+
     create_directories(data.directory, mpi_comm);
   }
 }
 
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::setup_matrix_free_evaluation()
+{
+  dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+  AssertThrow(fe.n_base_elements() == 1 and fe.element_multiplicity(0) == dim,
+              dealii::ExcMessage("The matrix-free evaluation of turbulent channel statistics "
+                                 "requires a vector-valued FESystem of a scalar element."));
+
+  unsigned int const fe_degree = fe.degree;
+
+  // The matrix-free data structures are only used to loop over batches of cells and to read the
+  // degrees of freedom. The quadrature points in the x-z-planes are the points of dealii::QGauss,
+  // as in the dealii::FEValues-based evaluation.
+  dealii::QGauss<1> const gauss_1d(fe_degree + 1);
+
+  dealii::AffineConstraints<Number> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme =
+    dealii::MatrixFree<dim, Number>::AdditionalData::TasksParallelScheme::none;
+  matrix_free.reinit(mapping, dof_handler, constraints, gauss_1d, additional_data);
+
+  matrix_free.initialize_dof_vector(velocity_matrix_free);
+
+  // 1d shape values
+  std::vector<dealii::Point<1>> points_y(n_points_y_per_cell);
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+    points_y[i][0] = (double)i / (n_points_y_per_cell - 1);
+  dealii::Quadrature<1> const quadrature_y(
+    points_y, std::vector<double>(n_points_y_per_cell, 1. / n_points_y_per_cell));
+
+  dealii::internal::MatrixFreeFunctions::ShapeInfo<Number> const shape_info_xz(gauss_1d, fe, 0);
+  dealii::internal::MatrixFreeFunctions::ShapeInfo<Number> const shape_info_y(quadrature_y, fe, 0);
+
+  shape_values_xz = shape_info_xz.data[0].shape_values;
+  shape_values_y  = shape_info_y.data[0].shape_values;
+
+  // precompute area elements and the indices of all x-z-planes in y_glob
+  dealii::QGauss<dim - 1> const gauss_2d(fe_degree + 1);
+
+  unsigned int const n_lanes        = dealii::VectorizedArray<Number>::size();
+  unsigned int const n_cell_batches = matrix_free.n_cell_batches();
+
+  area_elements.resize(n_cell_batches * n_points_y_per_cell * gauss_2d.size());
+  plane_indices.resize(n_cell_batches * n_lanes * n_points_y_per_cell, 0);
+
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  {
+    std::vector<dealii::Point<dim>> points(gauss_2d.size());
+    std::vector<double>             weights(gauss_2d.size());
+    for(unsigned int j = 0; j < gauss_2d.size(); ++j)
+    {
+      points[j][0] = gauss_2d.point(j)[0];
+      if(dim == 3)
+        points[j][2] = gauss_2d.point(j)[1];
+      points[j][1] = (double)i / (n_points_y_per_cell - 1);
+      weights[j]   = gauss_2d.weight(j);
+    }
+
+    dealii::FEValues<dim> fe_values(mapping,
+                                    fe.base_element(0),
+                                    dealii::Quadrature<dim>(points, weights),
+                                    dealii::update_jacobians | dealii::update_quadrature_points);
+
+    for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        fe_values.reinit(typename dealii::Triangulation<dim>::active_cell_iterator(
+          matrix_free.get_cell_iterator(cell, v)));
+
+        for(unsigned int q = 0; q < fe_values.n_quadrature_points; ++q)
+        {
+          double det = 0.;
+          if(dim == 3)
+          {
+            dealii::Tensor<2, 2> reduced_jacobian;
+            reduced_jacobian[0][0] = fe_values.jacobian(q)[0][0];
+            reduced_jacobian[0][1] = fe_values.jacobian(q)[0][2];
+            reduced_jacobian[1][0] = fe_values.jacobian(q)[2][0];
+            reduced_jacobian[1][1] = fe_values.jacobian(q)[2][2];
+            det                    = determinant(reduced_jacobian);
+          }
+          else
+          {
+            det = std::abs(fe_values.jacobian(q)[0][0]);
+          }
+
+          area_elements[(cell * n_points_y_per_cell + i) * gauss_2d.size() + q][v] =
+            det * fe_values.get_quadrature().weight(q);
+        }
+
+        plane_indices[(cell * n_lanes + v) * n_points_y_per_cell + i] =
+          get_index_y(fe_values.quadrature_point(0)[1]);
+      }
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::evaluate(VectorType const & velocity, bool const unsteady)
@@ -333,9 +441,16 @@ template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::evaluate_statistics(VectorType const & velocity)
 {
-  std::vector<VectorType const *> vecs;
-  vecs.push_back(&velocity);
-  do_evaluate(vecs);
+  if(data.use_matrix_free_evaluation)
+  {
+    do_evaluate_matrix_free(velocity);
+  }
+  else
+  {
+    std::vector<VectorType const *> vecs;
+    vecs.push_back(&velocity);
+    do_evaluate(vecs);
+  }
 }
 
 template<int dim, typename Number>
@@ -486,31 +601,7 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
         }
 
         // Tranform cell index 'i' to global index 'idx' of y_glob-vector
-
-        // find index within the y-values: first do a binary search to find
-        // the next larger value of y in the list...
-        double const y = fe_values[i]->quadrature_point(0)[1];
-        // std::lower_bound: returns iterator to first element that is >= y.
-        // Note that the vector y_glob has to be sorted. As a result, the
-        // index might be too large.
-        unsigned int idx =
-          std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
-
-        // make sure that the index does not exceed the array bounds in case of round-off errors
-        if(idx == y_glob.size())
-          idx--;
-
-        // reduce index by 1 in case that the previous point is closer to y than
-        // the next point
-        if(idx > 0 and std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
-          idx--;
-
-        AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
-                    dealii::ExcMessage("Could not locate " + std::to_string(y) +
-                                       " among pre-evaluated points. Closest point is " +
-                                       std::to_string(y_glob[idx]) + " at distance " +
-                                       std::to_string(std::abs(y_glob[idx] - y)) +
-                                       ". Check transform() function given to constructor."));
+        unsigned int const idx = get_index_y(fe_values[i]->quadrature_point(0)[1]);
 
         // Add results of cellwise integral to xxx_loc vectors since we want
         // to average/integrate over all locally owned cells.
@@ -526,6 +617,151 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
     }
   }
 
+  add_to_global_vectors(vel_loc, velsq_loc, veluv_loc, area_loc);
+}
+
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::do_evaluate_matrix_free(VectorType const & velocity)
+{
+  typedef dealii::VectorizedArray<Number> VectorizedArrayType;
+
+  // Use local vectors xxx_loc in order to average/integrate over all
+  // locally owned cells of current processor.
+  std::vector<double> area_loc(vel_glob[0].size());
+
+  std::vector<std::vector<double>> vel_loc(dim, std::vector<double>(vel_glob[0].size()));
+  std::vector<std::vector<double>> velsq_loc(dim, std::vector<double>(vel_glob[0].size()));
+  std::vector<double>              veluv_loc(vel_glob[0].size());
+
+  dealii::FEEvaluation<dim, -1, 0, dim, Number> fe_eval(matrix_free);
+
+  unsigned int const n_dofs_1d = dof_handler.get_fe().degree + 1;
+  unsigned int const n_q_1d    = n_dofs_1d;
+  unsigned int const n_y       = n_points_y_per_cell;
+  unsigned int const n_dofs_z  = (dim == 3) ? n_dofs_1d : 1;
+  unsigned int const n_q_z     = (dim == 3) ? n_q_1d : 1;
+  unsigned int const n_q_plane = n_q_1d * n_q_z;
+  unsigned int const n_lanes   = VectorizedArrayType::size();
+
+  unsigned int const dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+
+  dealii::AlignedVector<VectorizedArrayType> tmp_x(n_dofs_z * n_dofs_1d * n_q_1d);
+  dealii::AlignedVector<VectorizedArrayType> tmp_z(n_q_z * n_dofs_1d * n_q_1d);
+  dealii::AlignedVector<VectorizedArrayType> values(dim * n_y * n_q_plane);
+
+  velocity_matrix_free.copy_locally_owned_data_from(velocity);
+  velocity_matrix_free.update_ghost_values();
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    fe_eval.reinit(cell);
+    fe_eval.read_dof_values(velocity_matrix_free);
+
+    // Interpolate all velocity components into the points of all x-z-planes by sum factorization:
+    // Gauss points in x- and z-direction, equidistant points in y-direction. The degrees of
+    // freedom are stored in lexicographic order u[k][j][i] with i running in x-direction.
+    for(unsigned int c = 0; c < dim; ++c)
+    {
+      VectorizedArrayType const * dofs = fe_eval.begin_dof_values() + c * dofs_per_component;
+
+      // x-direction
+      for(unsigned int kj = 0; kj < n_dofs_z * n_dofs_1d; ++kj)
+        for(unsigned int qx = 0; qx < n_q_1d; ++qx)
+        {
+          VectorizedArrayType sum = 0.;
+          for(unsigned int i = 0; i < n_dofs_1d; ++i)
+            sum += shape_values_xz[i * n_q_1d + qx] * dofs[kj * n_dofs_1d + i];
+          tmp_x[kj * n_q_1d + qx] = sum;
+        }
+
+      // z-direction
+      VectorizedArrayType const * tmp_xz = tmp_x.begin();
+      if(dim == 3)
+      {
+        for(unsigned int qz = 0; qz < n_q_z; ++qz)
+          for(unsigned int jq = 0; jq < n_dofs_1d * n_q_1d; ++jq)
+          {
+            VectorizedArrayType sum = 0.;
+            for(unsigned int k = 0; k < n_dofs_z; ++k)
+              sum += shape_values_xz[k * n_q_1d + qz] * tmp_x[k * n_dofs_1d * n_q_1d + jq];
+            tmp_z[qz * n_dofs_1d * n_q_1d + jq] = sum;
+          }
+        tmp_xz = tmp_z.begin();
+      }
+
+      // y-direction
+      VectorizedArrayType * values_c = values.begin() + c * n_y * n_q_plane;
+      for(unsigned int py = 0; py < n_y; ++py)
+        for(unsigned int qz = 0; qz < n_q_z; ++qz)
+          for(unsigned int qx = 0; qx < n_q_1d; ++qx)
+          {
+            VectorizedArrayType sum = 0.;
+            for(unsigned int j = 0; j < n_dofs_1d; ++j)
+              sum += shape_values_y[j * n_y + py] * tmp_xz[(qz * n_dofs_1d + j) * n_q_1d + qx];
+            values_c[(py * n_q_z + qz) * n_q_1d + qx] = sum;
+          }
+    }
+
+    // Perform integrals over all x-z-planes of the current cell batch. The sums are accumulated
+    // in double precision lane by lane, since the velocity might be given in single precision.
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      for(unsigned int py = 0; py < n_y; ++py)
+      {
+        double vel[dim], velsq[dim];
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          vel[d]   = 0.;
+          velsq[d] = 0.;
+        }
+        double area = 0., veluv = 0.;
+
+        VectorizedArrayType const * area_elements_plane =
+          area_elements.begin() + (cell * n_y + py) * n_q_plane;
+
+        for(unsigned int q = 0; q < n_q_plane; ++q)
+        {
+          double const area_ele = area_elements_plane[q][v];
+          area += area_ele;
+
+          for(unsigned int d = 0; d < dim; ++d)
+          {
+            double const u = values[(d * n_y + py) * n_q_plane + q][v];
+            vel[d] += u * area_ele;
+            velsq[d] += u * u * area_ele;
+          }
+
+          veluv += static_cast<double>(values[py * n_q_plane + q][v]) *
+                   static_cast<double>(values[(n_y + py) * n_q_plane + q][v]) * area_ele;
+        }
+
+        unsigned int const idx = plane_indices[(cell * n_lanes + v) * n_y + py];
+
+        for(unsigned int d = 0; d < dim; d++)
+          vel_loc[d][idx] += vel[d];
+
+        for(unsigned int d = 0; d < dim; d++)
+          velsq_loc[d][idx] += velsq[d];
+
+        veluv_loc[idx] += veluv;
+        area_loc[idx] += area;
+      }
+    }
+  }
+
+  velocity_matrix_free.zero_out_ghost_values();
+
+  add_to_global_vectors(vel_loc, velsq_loc, veluv_loc, area_loc);
+}
+
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::add_to_global_vectors(std::vector<std::vector<double>> & vel_loc,
+                                                      std::vector<std::vector<double>> & velsq_loc,
+                                                      std::vector<double> &              veluv_loc,
+                                                      std::vector<double> &              area_loc)
+{
   // accumulate data over all processors overwriting
   // the processor-local data in xxx_loc since we want
   // to average/integrate over the global x-z-plane.
@@ -556,6 +792,38 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
   number_of_samples++;
 }
 
+template<int dim, typename Number>
+unsigned int
+StatisticsManager<dim, Number>::get_index_y(double const y) const
+{
+  // find index within the y-values: first do a binary search to find
+  // the next larger value of y in the list...
+
+  // std::lower_bound: returns iterator to first element that is >= y.
+  // Note that the vector y_glob has to be sorted. As a result, the
+  // index might be too large.
+  unsigned int idx =
+    std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
+
+  // make sure that the index does not exceed the array bounds in case of round-off errors
+  if(idx == y_glob.size())
+    idx--;
+
+  // reduce index by 1 in case that the previous point is closer to y than
+  // the next point
+  if(idx > 0 and std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
+    idx--;
+
+  AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
+              dealii::ExcMessage("Could not locate " + std::to_string(y) +
+                                 " among pre-evaluated points. Closest point is " +
+                                 std::to_string(y_glob[idx]) + " at distance " +
+                                 std::to_string(std::abs(y_glob[idx] - y)) +
+                                 ". Check transform() function given to constructor."));
+
+  return idx;
+}
+
 template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::do_write_output(std::string const filename,
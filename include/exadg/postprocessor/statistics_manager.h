@@ -25,6 +25,7 @@
 // deal.II
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
 #include <exadg/postprocessor/time_control_statistics.h>
@@ -38,6 +39,7 @@ struct TurbulentChannelData
 {
   TurbulentChannelData()
     : cells_are_stretched(false),
+      use_matrix_free_evaluation(false),
       viscosity(1.0),
       density(1.0),
       directory("output/"),
@@ -57,6 +59,7 @@ struct TurbulentChannelData
       time_control_data_statistics.print(pcout, true /*unsteady*/);
 
       print_parameter(pcout, "Cells are stretched", cells_are_stretched);
+      print_parameter(pcout, "Use matrix-free evaluation", use_matrix_free_evaluation);
       print_parameter(pcout, "Dynamic viscosity", viscosity);
       print_parameter(pcout, "Density", density);
       print_parameter(pcout, "Directory of output files", directory);
@@ -69,6 +72,11 @@ struct TurbulentChannelData
   // are cells stretched, i.e., is a volume manifold applied?
   bool cells_are_stretched;
 
+  // Evaluate the velocity in the x-z-planes by sum factorization on batches of cells instead of
+  // dealii::FEValues. The geometry factors of all planes are precomputed in setup(), which requires
+  // memory comparable to that of the velocity vector.
+  bool use_matrix_free_evaluation;
+
   // dynamic viscosity
   double viscosity;
 
@@ -120,6 +128,21 @@ private:
   void
   do_evaluate(const std::vector<VectorType const *> & velocity);
 
+  void
+  setup_matrix_free_evaluation();
+
+  void
+  do_evaluate_matrix_free(VectorType const & velocity);
+
+  void
+  add_to_global_vectors(std::vector<std::vector<double>> & vel_loc,
+                        std::vector<std::vector<double>> & velsq_loc,
+                        std::vector<double> &              veluv_loc,
+                        std::vector<double> &              area_loc);
+
+  unsigned int
+  get_index_y(double const y) const;
+
   void
   do_write_output(std::string const filename, double const dynamic_viscosity, double const density);
 
@@ -142,6 +165,25 @@ private:
   // number of samples
   int number_of_samples;
 
+  // data structures for the matrix-free evaluation
+  dealii::MatrixFree<dim, Number> matrix_free;
+
+  // The velocity vector passed to evaluate() is compatible with the MatrixFree object of the flow
+  // solver, whose partitioner differs from the one of the MatrixFree object above (e.g. due to
+  // ghost entries required by face integrals). Therefore, the velocity is copied into this vector.
+  VectorType velocity_matrix_free;
+
+  // 1d shape values in the Gauss points (x- and z-direction) and the equidistant points
+  // (y-direction), stored as shape_values[i * n_points + q]
+  dealii::AlignedVector<Number> shape_values_xz;
+  dealii::AlignedVector<Number> shape_values_y;
+
+  // area element for all cell batches, all x-z-planes and all points of a plane
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> area_elements;
+
+  // index in y_glob for all cell batches, all lanes and all x-z-planes
+  std::vector<unsigned int> plane_indices;
+
   bool write_final_output;
 
   TurbulentChannelData data;
@@ -24,6 +24,7 @@
 
 // C/C++
 #include <fstream>
+#include <list>
 
 // deal.II
 #include <deal.II/base/bounding_box.h>
@@ -40,6 +41,7 @@
 // ExaDG
 #include <exadg/grid/grid_data.h>
 #include <exadg/operators/quadrature.h>
+#include <exadg/postprocessor/asynchronous_output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/solution_field.h>
 
@@ -163,23 +165,31 @@ public:
   VectorWriter(OutputDataBase const & output_data,
                unsigned int const &   output_counter,
                MPI_Comm const &       mpi_comm)
-    : output_data(output_data), output_counter(output_counter), mpi_comm(mpi_comm)
+    : output_data(output_data),
+      output_counter(output_counter),
+      mpi_comm(mpi_comm),
+      rank(dealii::Utilities::MPI::this_mpi_process(mpi_comm)),
+      n_ranks(dealii::Utilities::MPI::n_mpi_processes(mpi_comm))
   {
     // Write higher order output.
     dealii::DataOutBase::VtkFlags flags;
     flags.write_higher_order_cells = output_data.write_higher_order;
+    flags.compression_level        = output_data.compression_level;
     data_out.set_flags(flags);
   }
 
-  // Note that the vectors must remain valid until we call `write_pvtu()`, which is not the
-  // responsibility of this class.
+  // Note that the vectors must remain valid until we call `write()`, which is not the
+  // responsibility of this class. In case of asynchronous output, the vectors are copied and the
+  // originals may be modified as soon as this function returns.
   template<typename VectorType>
   void
-  add_data_vector(VectorType const &               vector,
+  add_data_vector(VectorType const &               vector_in,
                   dealii::DoFHandler<dim> const &  dof_handler,
                   std::vector<std::string> const & component_names,
                   std::vector<bool> const &        component_is_part_of_vector = {false})
   {
+    VectorType const & vector = buffer(vector_in);
+
     unsigned int n_components = component_names.size();
     AssertThrow(n_components > 0, dealii::ExcMessage("Provide names for each component."));
 
@@ -214,15 +224,17 @@ public:
   {
     for(auto & additional_field : additional_fields)
     {
+      auto const & vector = buffer(additional_field->get());
+
       if(additional_field->get_type() == SolutionFieldType::scalar)
       {
         data_out.add_data_vector(additional_field->get_dof_handler(),
-                                 additional_field->get(),
+                                 vector,
                                  additional_field->get_name());
       }
       else if(additional_field->get_type() == SolutionFieldType::cellwise)
       {
-        data_out.add_data_vector(additional_field->get(), additional_field->get_name());
+        data_out.add_data_vector(vector, additional_field->get_name());
       }
       else if(additional_field->get_type() == SolutionFieldType::vector)
       {
@@ -232,7 +244,7 @@ public:
             dim, dealii::DataComponentInterpretation::component_is_part_of_vector);
 
         data_out.add_data_vector(additional_field->get_dof_handler(),
-                                 additional_field->get(),
+                                 vector,
                                  names,
                                  component_interpretation);
       }
@@ -261,8 +273,12 @@ public:
     }
   }
 
+  /**
+   * Build patches and write the data in the format specified by OutputDataBase::output_format.
+   * The time is only used to annotate HDF5/XDMF output.
+   */
   void
-  write_pvtu(dealii::Mapping<dim> const * mapping = nullptr)
+  write(dealii::Mapping<dim> const * mapping = nullptr, double const time = 0.0)
   {
     // Build patches, vectors to export must stay in scope until after this call.
     if(mapping == nullptr)
@@ -276,22 +292,163 @@ public:
                              dealii::DataOut<dim>::curved_inner_cells);
     }
 
-    unsigned int constexpr n_groups = 4;
-    data_out.write_vtu_with_pvtu_record(
-      output_data.directory, output_data.filename, output_counter, mpi_comm, n_groups);
+    if(output_data.write_asynchronously)
+    {
+      AssertThrow(output_data.output_format == OutputFormat::VTU,
+                  dealii::ExcMessage("Asynchronous output is only implemented for VTU output."));
+
+      write_vtu_per_rank();
+    }
+    else if(output_data.output_format == OutputFormat::VTU)
+    {
+      data_out.write_vtu_with_pvtu_record(output_data.directory,
+                                          output_data.filename,
+                                          output_counter,
+                                          mpi_comm,
+                                          output_data.get_n_output_groups());
+    }
+    else if(output_data.output_format == OutputFormat::HDF5)
+    {
+      write_hdf5_with_xdmf_record(time);
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("This `OutputFormat` is not implemented."));
+    }
   }
 
 private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> BufferVectorType;
+
+  /**
+   * In case of asynchronous output, store a copy of the vector (with up-to-date ghost values) that
+   * remains valid until the output has been written in the background. Otherwise, the vector is
+   * simply returned.
+   */
+  template<typename VectorType>
+  VectorType const &
+  buffer(VectorType const & vector)
+  {
+    if(not output_data.write_asynchronously)
+      return vector;
+
+    if constexpr(std::is_same_v<VectorType, BufferVectorType>)
+    {
+      vector_buffer.emplace_back(vector);
+      vector_buffer.back().update_ghost_values();
+      return vector_buffer.back();
+    }
+    else
+    {
+      AssertThrow(false,
+                  dealii::ExcMessage("Asynchronous output is only implemented for vectors of type "
+                                     "dealii::LinearAlgebra::distributed::Vector<Number>."));
+      return vector;
+    }
+  }
+
+  /**
+   * Write one .vtu file per process and the .pvtu record on rank 0. In contrast to
+   * write_vtu_with_pvtu_record(), this function does not communicate and can therefore be called
+   * from a background thread.
+   */
+  void
+  write_vtu_per_rank() const
+  {
+    std::string const name =
+      output_data.filename + "_" + dealii::Utilities::int_to_string(output_counter, 4);
+
+    unsigned int const n_digits = std::max(4u, dealii::Utilities::needed_digits(n_ranks));
+
+    auto const piece_name = [&](unsigned int const r) {
+      return name + "." + dealii::Utilities::int_to_string(r, n_digits) + ".vtu";
+    };
+
+    std::ofstream out(output_data.directory + piece_name(rank));
+    AssertThrow(out, dealii::ExcMessage("Can not open file " + piece_name(rank) + "."));
+    data_out.write_vtu(out);
+
+    if(rank == 0)
+    {
+      std::vector<std::string> piece_names(n_ranks);
+      for(unsigned int r = 0; r < n_ranks; ++r)
+        piece_names[r] = piece_name(r);
+
+      std::ofstream pvtu_out(output_data.directory + name + ".pvtu");
+      data_out.write_pvtu_record(pvtu_out, piece_names);
+    }
+  }
+
+  /**
+   * Write all patches into a single HDF5 file using collective MPI-IO and describe its content
+   * by an XDMF file written by rank 0. Each output step gets its own pair of files, which
+   * ParaView/VisIt group into a time series.
+   */
+  void
+  write_hdf5_with_xdmf_record(double const time)
+  {
+#ifdef DEAL_II_WITH_HDF5
+    std::string const name =
+      output_data.filename + "_" + dealii::Utilities::int_to_string(output_counter, 4);
+
+    // Duplicate vertices must not be filtered since the fields are discontinuous.
+    dealii::DataOutBase::DataOutFilter data_filter(
+      dealii::DataOutBase::DataOutFilterFlags(false /* filter_duplicate_vertices */,
+                                              true /* xdmf_hdf5_output */));
+    data_out.write_filtered_data(data_filter);
+    data_out.write_hdf5_parallel(data_filter, output_data.directory + name + ".h5", mpi_comm);
+
+    // The XDMF file refers to the HDF5 file relative to its own location.
+    std::vector<dealii::XDMFEntry> xdmf_entries(
+      {data_out.create_xdmf_entry(data_filter, name + ".h5", time, mpi_comm)});
+    data_out.write_xdmf_file(xdmf_entries, output_data.directory + name + ".xdmf", mpi_comm);
+#else
+    (void)time;
+    AssertThrow(false,
+                dealii::ExcMessage("OutputFormat::HDF5 requires deal.II to be configured with "
+                                   "HDF5 (DEAL_II_WITH_HDF5)."));
+#endif
+  }
+
   OutputDataBase const                                output_data;
   unsigned int                                        output_counter;
   dealii::ObserverPointer<dealii::Mapping<dim> const> mapping;
   MPI_Comm const                                      mpi_comm;
+  unsigned int const                                  rank;
+  unsigned int const                                  n_ranks;
 
   dealii::Vector<double> aspect_ratios;
 
+  // copies of the vectors in case of asynchronous output (std::list: references remain valid)
+  std::list<BufferVectorType> vector_buffer;
+
   dealii::DataOut<dim> data_out;
 };
 
+/**
+ * Writes the output of the given VectorWriter, either directly or in the background by means of
+ * the AsynchronousOutputWriter, depending on OutputDataBase::write_asynchronously.
+ */
+template<int dim, typename Number>
+void
+write_vector_output(std::shared_ptr<VectorWriter<dim, Number>> vector_writer,
+                    OutputDataBase const &                     output_data,
+                    AsynchronousOutputWriter &                 asynchronous_writer,
+                    dealii::Mapping<dim> const *               mapping,
+                    double const                               time)
+{
+  if(output_data.write_asynchronously)
+  {
+    // the lambda owns the writer and, hence, the buffered vectors until the output is written
+    asynchronous_writer.submit(
+      [vector_writer, mapping, time]() { vector_writer->write(mapping, time); });
+  }
+  else
+  {
+    vector_writer->write(mapping, time);
+  }
+}
+
 } // namespace ExaDG
 
 #endif /* EXADG_POSTPROCESSOR_WRITE_OUTPUT_H_ */
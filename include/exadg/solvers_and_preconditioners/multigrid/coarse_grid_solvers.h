@@ -27,6 +27,8 @@
 #include <deal.II/lac/solver_cg.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/trilinos_solver.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/multigrid/mg_base.h>
 #include <deal.II/numerics/vector_tools_mean_value.h>
 
@@ -371,6 +373,88 @@ private:
   std::shared_ptr<PreconditionerAMG<Operator, Number>> amg_preconditioner;
 };
 
+#ifdef DEAL_II_WITH_TRILINOS
+/**
+ * Direct coarse-grid solver. The coarse operator is assembled into a sparse matrix via the
+ * matrix-based path of the operator and factorized by a sparse direct solver (Amesos KLU, which
+ * gathers the matrix onto a single process). The factorization is computed once and reused in
+ * every application of the coarse-grid solver. A call to update() only marks the factorization as
+ * outdated, and the matrix is re-assembled and re-factorized lazily at the next application.
+ */
+template<typename Operator>
+class MGCoarseDirect : public CoarseGridSolverBase<Operator>
+{
+private:
+  typedef typename Operator::value_type Number;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  MGCoarseDirect(Operator const & op, bool const initialize, bool const operator_is_singular)
+    : pde_operator(op), factorization_is_outdated(true)
+  {
+    AssertThrow(not operator_is_singular,
+                dealii::ExcMessage("The direct coarse-grid solver can not be used for singular "
+                                   "operators. Use an iterative coarse-grid solver instead."));
+
+    pde_operator.init_system_matrix(system_matrix,
+                                    op.get_matrix_free().get_dof_handler().get_mpi_communicator());
+
+    if(initialize)
+    {
+      factorize();
+    }
+  }
+
+  void
+  update() final
+  {
+    factorization_is_outdated = true;
+  }
+
+  void
+  operator()(unsigned int const /*level*/, VectorType & dst, VectorType const & src) const final
+  {
+    if(factorization_is_outdated)
+      factorize();
+
+    apply_function_in_double_precision(
+      dst,
+      src,
+      [&](dealii::LinearAlgebra::distributed::Vector<double> &       dst_double,
+          dealii::LinearAlgebra::distributed::Vector<double> const & src_double) {
+        solver->solve(dst_double, src_double);
+      });
+  }
+
+private:
+  void
+  factorize() const
+  {
+    // clear content of matrix since calculate_system_matrix() adds the result
+    system_matrix = 0.0;
+
+    pde_operator.calculate_system_matrix(system_matrix);
+
+    solver = std::make_unique<dealii::TrilinosWrappers::SolverDirect>(
+      solver_control, dealii::TrilinosWrappers::SolverDirect::AdditionalData(false, "Amesos_Klu"));
+    solver->initialize(system_matrix);
+
+    factorization_is_outdated = false;
+  }
+
+  Operator const & pde_operator;
+
+  mutable dealii::TrilinosWrappers::SparseMatrix system_matrix;
+
+  mutable dealii::SolverControl solver_control;
+
+  mutable std::unique_ptr<dealii::TrilinosWrappers::SolverDirect> solver;
+
+  mutable bool factorization_is_outdated;
+};
+#endif
+
 } // namespace ExaDG
 
 #endif /* EXADG_SOLVERS_AND_PRECONDITIONERS_MULTIGRID_COARSE_GRID_SOLVERS_H_ */
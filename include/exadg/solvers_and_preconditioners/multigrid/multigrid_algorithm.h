@@ -32,18 +32,10 @@
 #include <deal.II/multigrid/multigrid.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfer_base.h>
 #include <exadg/utilities/timer_tree.h>
 
-/*
- * Activate timings if desired.
- */
-#define ENABLE_TIMING false
-
-#ifndef ENABLE_TIMING
-#  define ENABLE_TIMING false
-#endif
-
 namespace ExaDG
 {
 /*
@@ -59,7 +51,8 @@ public:
                      MultigridTransferBase<VectorType> const &                    transfer,
                      dealii::MGLevelObject<std::shared_ptr<SmootherType>> const & smoother,
                      MPI_Comm const &                                             comm,
-                     unsigned int const                                           n_cycles = 1)
+                     bool const           enable_timings = false,
+                     MultigridCycle const cycle_type     = MultigridCycle::V)
     : minlevel(matrix.min_level()),
       maxlevel(matrix.max_level()),
       defect(minlevel, maxlevel),
@@ -70,10 +63,9 @@ public:
       transfer(transfer),
       smoother(&smoother, typeid(*this).name()),
       mpi_comm(comm),
-      n_cycles(n_cycles)
+      enable_timings(enable_timings),
+      cycle_type(cycle_type)
   {
-    AssertThrow(n_cycles == 1, dealii::ExcNotImplemented());
-
     for(unsigned int level = minlevel; level <= maxlevel; ++level)
     {
       matrix[level]->initialize_dof_vector(solution[level]);
@@ -81,6 +73,11 @@ public:
       t[level]      = solution[level];
     }
 
+    // the coarse grid solver is applied to the residual of the current coarse-level solution if
+    // the coarse level is visited with a non-zero initial guess, i.e., for repeated visits within
+    // W- and F-cycles or when used as a solver
+    coarse_correction = solution[minlevel];
+
     timer_tree = std::make_shared<TimerTree>();
   }
 
@@ -88,23 +85,17 @@ public:
   void
   vmult(OtherVectorType & dst, OtherVectorType const & src) const
   {
-#if ENABLE_TIMING
     dealii::Timer timer;
-#endif
 
-    for(unsigned int i = minlevel; i < maxlevel; i++)
-    {
-      defect[i] = 0.0;
-    }
     defect[maxlevel].copy_locally_owned_data_from(src);
 
-    v_cycle(maxlevel, false);
+    // We can assume that solution[level] = 0 when used as a preconditioner.
+    cycle(maxlevel, cycle_type, true);
 
     dst.copy_locally_owned_data_from(solution[maxlevel]);
 
-#if ENABLE_TIMING
-    timer_tree->insert({"Multigrid"}, timer.wall_time());
-#endif
+    if(enable_timings)
+      timer_tree->insert({"Multigrid"}, timer.wall_time());
   }
 
   template<class OtherVectorType>
@@ -130,12 +121,8 @@ public:
     bool converged = norm_r_0 < abstol;
     while(not converged)
     {
-      for(unsigned int i = minlevel; i < maxlevel; i++)
-      {
-        defect[i] = 0.0;
-      }
-
-      v_cycle(maxlevel, true);
+      // One has to take into account the initial guess of the solution when used as a solver.
+      cycle(maxlevel, cycle_type, false);
 
       // calculate residual and check convergence
       norm_r = calculate_residual(residual);
@@ -165,77 +152,142 @@ public:
     return timer_tree;
   }
 
+  /**
+   * Returns the number of smoother applications (pre- and post-smoothing) per level for one
+   * multigrid cycle, i.e., one application of the preconditioner. The vector is indexed by
+   * level - minlevel.
+   */
+  std::vector<unsigned int>
+  get_n_smoother_applications_per_cycle() const
+  {
+    std::vector<unsigned int> n_applications(maxlevel - minlevel + 1, 0);
+    count_smoother_applications(n_applications, maxlevel, cycle_type);
+    return n_applications;
+  }
+
 private:
   /**
-   * Implements the V-cycle
+   * Implements the multigrid cycle on the given level. The coarse grid correction of a V-cycle
+   * visits the next coarser level once, whereas a W-cycle visits the next coarser level twice with
+   * a W-cycle. An F-cycle performs an F-cycle followed by a V-cycle on the next coarser level.
+   *
+   * The parameter zero_initial_guess indicates whether solution[level] can be assumed to be zero
+   * on entry, which allows to skip the evaluation of the initial residual in the pre-smoother
+   * and the coarse grid solver. This is the case for the first visit of a level within a cycle
+   * if multigrid is used as a preconditioner.
    */
   void
-  v_cycle(unsigned int const level, bool const multigrid_is_a_solver) const
+  cycle(unsigned int const level, MultigridCycle const type, bool const zero_initial_guess) const
   {
-#if ENABLE_TIMING
     dealii::Timer timer;
-#endif
 
     // call coarse grid solver
     if(level == minlevel)
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
-
-      (*coarse)(level, solution[level], defect[level]);
+      if(zero_initial_guess)
+      {
+        (*coarse)(level, solution[level], defect[level]);
+      }
+      else
+      {
+        // apply coarse grid solver to the residual and add the correction
+        (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
+        t[level].sadd(-1.0, 1.0, defect[level]);
+        (*coarse)(level, coarse_correction, t[level]);
+        solution[level] += coarse_correction;
+      }
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      record_timing(timer, level, "Coarse grid solver");
     }
     else
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
-
       // pre-smoothing
-      if(multigrid_is_a_solver)
+      if(zero_initial_guess)
       {
-        // One has to take into account the initial guess of the solution when used as a solver
-        // and, therefore, call the function step().
-        (*smoother)[level]->step(solution[level], defect[level]);
-      }
-      else
-      {
-        // We can assume that solution[level] = 0 when used as a preconditioner
-        // and, therefore, call the function vmult(), which makes use of this assumption
+        // call the function vmult(), which makes use of the assumption solution[level] = 0
         // in order to apply optimizations (e.g., one does not need to evaluate the residual in
         // the first iteration of the smoother).
         (*smoother)[level]->vmult(solution[level], defect[level]);
       }
+      else
+      {
+        // take into account the initial guess of the solution and call the function step().
+        (*smoother)[level]->step(solution[level], defect[level]);
+      }
 
-      // restriction
+      record_timing(timer, level, "Pre-smoothing");
+
+      // residual
       (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
       t[level].sadd(-1.0, 1.0, defect[level]);
+
+      record_timing(timer, level, "Residual");
+
+      // restriction
+      defect[level - 1] = 0.0;
       transfer.restrict_and_add(level, defect[level - 1], t[level]);
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      record_timing(timer, level, "Restriction");
 
       // coarse grid correction
-      v_cycle(level - 1, false);
+      cycle(level - 1, type, true);
+      if(type == MultigridCycle::W)
+        cycle(level - 1, MultigridCycle::W, false);
+      else if(type == MultigridCycle::F)
+        cycle(level - 1, MultigridCycle::V, false);
 
-#if ENABLE_TIMING
-      timer.restart();
-#endif
+      if(enable_timings)
+        timer.restart();
 
       // prolongation
       transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
 
+      record_timing(timer, level, "Prolongation");
+
       // post-smoothing
       (*smoother)[level]->step(solution[level], defect[level]);
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      record_timing(timer, level, "Post-smoothing");
+    }
+  }
+
+  /**
+   * Counts the smoother applications of a multigrid cycle without applying it, following the same
+   * recursion as the function cycle().
+   */
+  void
+  count_smoother_applications(std::vector<unsigned int> & n_applications,
+                              unsigned int const          level,
+                              MultigridCycle const        type) const
+  {
+    if(level == minlevel)
+      return;
+
+    n_applications[level - minlevel] += 2;
+
+    count_smoother_applications(n_applications, level - 1, type);
+    if(type == MultigridCycle::W)
+      count_smoother_applications(n_applications, level - 1, MultigridCycle::W);
+    else if(type == MultigridCycle::F)
+      count_smoother_applications(n_applications, level - 1, MultigridCycle::V);
+  }
+
+  /**
+   * Adds the wall time measured by the timer to the given component of the multigrid cycle on the
+   * given level and restarts the timer. Does nothing if timings are disabled.
+   */
+  void
+  record_timing(dealii::Timer & timer, unsigned int const level, std::string const & name) const
+  {
+    if(enable_timings)
+    {
+      double const       wall_time = timer.wall_time();
+      std::string const level_name = "level " + std::to_string(level);
+
+      timer_tree->insert({"Multigrid", level_name}, wall_time);
+      timer_tree->insert({"Multigrid", level_name, name}, wall_time);
+
+      timer.restart();
     }
   }
 
@@ -265,6 +317,12 @@ private:
    */
   mutable dealii::MGLevelObject<VectorType> t;
 
+  /**
+   * Auxiliary vector for the coarse grid correction if the coarse level is visited with a
+   * non-zero initial guess.
+   */
+  mutable VectorType coarse_correction;
+
   /**
    * The matrix for each level.
    */
@@ -287,7 +345,15 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  unsigned int const n_cycles;
+  /**
+   * Record wall times of the individual components of the multigrid cycle per level.
+   */
+  bool const enable_timings;
+
+  /**
+   * Type of the multigrid cycle.
+   */
+  MultigridCycle const cycle_type;
 
   std::shared_ptr<TimerTree> timer_tree;
 };
@@ -56,6 +56,25 @@ enum class MultigridType
   phcMG
 };
 
+enum class MultigridCycle
+{
+  V,
+  W,
+  F
+};
+
+/*
+ * Storage format of level data on the coarse levels, i.e., on all multigrid levels except the
+ * finest level (the levels after the first h-, p-, or c-coarsening). BFloat16 stores the data in
+ * a 16-bit format with the exponent range of float, while all computations are done in the
+ * multigrid number type.
+ */
+enum class MultigridCoarseLevelStorage
+{
+  MultigridNumber,
+  BFloat16
+};
+
 enum class PSequenceType
 {
   GoToOne,
@@ -83,7 +102,8 @@ enum class MultigridCoarseGridSolver
   Chebyshev,
   CG,
   GMRES,
-  AMG
+  AMG,
+  Direct
 };
 
 enum class MultigridCoarseGridPreconditioner
@@ -230,9 +250,13 @@ struct CoarseGridData
   print(dealii::ConditionalOStream const & pcout) const
   {
     print_parameter(pcout, "Coarse grid solver", solver);
-    print_parameter(pcout, "Coarse grid preconditioner", preconditioner);
 
-    solver_data.print(pcout);
+    if(solver != MultigridCoarseGridSolver::Direct)
+    {
+      print_parameter(pcout, "Coarse grid preconditioner", preconditioner);
+
+      solver_data.print(pcout);
+    }
 
     if(solver == MultigridCoarseGridSolver::AMG or
        preconditioner == MultigridCoarseGridPreconditioner::AMG)
@@ -259,9 +283,12 @@ struct MultigridData
 {
   MultigridData()
     : type(MultigridType::hMG),
+      cycle(MultigridCycle::V),
       p_sequence(PSequenceType::Bisect),
       smoother_data(SmootherData()),
-      coarse_problem(CoarseGridData())
+      coarse_problem(CoarseGridData()),
+      coarse_level_storage(MultigridCoarseLevelStorage::MultigridNumber),
+      enable_timings(false)
   {
   }
 
@@ -270,6 +297,8 @@ struct MultigridData
   {
     print_parameter(pcout, "Multigrid type", type);
 
+    print_parameter(pcout, "Multigrid cycle", cycle);
+
     if(involves_p_transfer())
     {
       print_parameter(pcout, "p-sequence", p_sequence);
@@ -278,6 +307,10 @@ struct MultigridData
     smoother_data.print(pcout);
 
     coarse_problem.print(pcout);
+
+    print_parameter(pcout, "Coarse level storage", coarse_level_storage);
+
+    print_parameter(pcout, "Enable multigrid timings", enable_timings);
   }
 
   bool
@@ -292,6 +325,11 @@ struct MultigridData
   // Multigrid type: p-MG vs. h-MG
   MultigridType type;
 
+  // Multigrid cycle: V-cycle, W-cycle, or F-cycle. W- and F-cycles visit coarser levels more
+  // often than the V-cycle, which typically reduces the number of iterations at the price of
+  // additional smoother applications on coarse levels.
+  MultigridCycle cycle;
+
   // Sequence of polynomial degrees during p-multigrid
   PSequenceType p_sequence;
 
@@ -300,6 +338,20 @@ struct MultigridData
 
   // Coarse grid problem
   CoarseGridData coarse_problem;
+
+  // Storage format of the level data on the coarse levels. Currently, this applies to the inverse
+  // diagonal of point-Jacobi preconditioned Chebyshev and Jacobi smoothers, which is read in every
+  // smoothing iteration. Level vectors and MatrixFree data are stored in the multigrid number type
+  // since deal.II does not provide vectorized arithmetic for 16-bit types.
+  MultigridCoarseLevelStorage coarse_level_storage;
+
+  // Measure wall times of smoothing, residual evaluation, transfer, and coarse grid solver
+  // separately for every multigrid level. The timings are added to the timer tree of the
+  // multigrid preconditioner and are, therefore, reported along with the timings of the
+  // iterative solver. In addition, the number of smoother applications per level and cycle is
+  // printed during setup. Since the measurement involves some overhead (and unsynchronized timings
+  // of operations that are latency-bound on coarse levels), this option is disabled by default.
+  bool enable_timings;
 };
 
 } // namespace ExaDG
@@ -19,7 +19,11 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <iomanip>
+
 // deal.II
+#include <deal.II/base/conditional_ostream.h>
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_simplex_p.h>
@@ -705,6 +709,19 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoother(
               dealii::ExcMessage(
                 "Multigrid level is invalid when initializing multigrid smoother!"));
 
+  // reduced storage of level data on all levels except the finest level
+  bool const reduced_storage =
+    data.coarse_level_storage == MultigridCoarseLevelStorage::BFloat16 and
+    level < this->get_number_of_levels() - 1;
+
+  AssertThrow(not reduced_storage or
+                ((data.smoother_data.smoother == MultigridSmoother::Chebyshev or
+                  data.smoother_data.smoother == MultigridSmoother::Jacobi) and
+                 data.smoother_data.preconditioner == PreconditionerSmoother::PointJacobi),
+              dealii::ExcMessage("Reduced storage on coarse multigrid levels is only implemented "
+                                 "for Chebyshev and Jacobi smoothers with point-Jacobi "
+                                 "preconditioner."));
+
   switch(data.smoother_data.smoother)
   {
     case MultigridSmoother::Chebyshev:
@@ -718,6 +735,7 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoother(
       smoother_data.degree          = data.smoother_data.iterations;
       smoother_data.iterations_eigenvalue_estimation =
         data.smoother_data.iterations_eigenvalue_estimation;
+      smoother_data.reduced_storage_diagonal = reduced_storage;
 
       std::shared_ptr<Chebyshev> smoother = std::dynamic_pointer_cast<Chebyshev>(smoothers[level]);
       smoother->setup(mg_operator, initialize_preconditioner, smoother_data);
@@ -758,6 +776,7 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoother(
       smoother_data.preconditioner            = data.smoother_data.preconditioner;
       smoother_data.number_of_smoothing_steps = data.smoother_data.iterations;
       smoother_data.damping_factor            = data.smoother_data.relaxation_factor;
+      smoother_data.reduced_storage_diagonal  = reduced_storage;
 
       std::shared_ptr<Jacobi> smoother = std::dynamic_pointer_cast<Jacobi>(smoothers[level]);
       smoother->setup(mg_operator, initialize_preconditioner, smoother_data);
@@ -838,6 +857,17 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_coarse_sol
 
       break;
     }
+    case MultigridCoarseGridSolver::Direct:
+    {
+#ifdef DEAL_II_WITH_TRILINOS
+      coarse_grid_solver = std::make_shared<MGCoarseDirect<Operator>>(coarse_operator,
+                                                                      initialize_preconditioners,
+                                                                      operator_is_singular);
+#else
+      AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
+#endif
+      break;
+    }
     default:
     {
       AssertThrow(false, dealii::ExcMessage("Unknown coarse-grid solver specified."));
@@ -869,7 +899,32 @@ void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_multigrid_algorithm()
 {
   multigrid_algorithm = std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(
-    operators, *coarse_grid_solver, *transfers, smoothers, mpi_comm);
+    operators,
+    *coarse_grid_solver,
+    *transfers,
+    smoothers,
+    mpi_comm,
+    data.enable_timings,
+    data.cycle);
+
+  if(data.enable_timings)
+  {
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+    std::vector<unsigned int> const n_applications =
+      multigrid_algorithm->get_n_smoother_applications_per_cycle();
+
+    pcout << std::endl
+          << "Smoother applications per multigrid cycle (" << Utilities::enum_to_string(data.cycle)
+          << "-cycle):" << std::endl;
+    for(unsigned int level = 1; level < level_info.size(); ++level)
+    {
+      pcout << "  level " << std::setw(2) << level << " (h-level = " << std::setw(2)
+            << level_info[level].h_level() << ", degree = " << std::setw(2)
+            << level_info[level].degree() << "): " << n_applications[level] << std::endl;
+    }
+  }
 }
 
 template class MultigridPreconditionerBase<2, float>;
@@ -59,7 +59,8 @@ public:
       : preconditioner(PreconditionerSmoother::PointJacobi),
         smoothing_range(20),
         degree(5),
-        iterations_eigenvalue_estimation(20)
+        iterations_eigenvalue_estimation(20),
+        reduced_storage_diagonal(false)
     {
     }
 
@@ -74,6 +75,9 @@ public:
 
     // number of CG iterations for estimation of eigenvalues
     unsigned int iterations_eigenvalue_estimation;
+
+    // store the inverse diagonal of the point-Jacobi preconditioner in bfloat16 format
+    bool reduced_storage_diagonal;
   };
 
   void
@@ -158,7 +162,8 @@ public:
     {
       preconditioner_point_jacobi =
         std::make_shared<JacobiPreconditioner<Operator>>(*underlying_operator,
-                                                         initialize_preconditioner);
+                                                         initialize_preconditioner,
+                                                         data.reduced_storage_diagonal);
 
       additional_data_point.preconditioner      = preconditioner_point_jacobi;
       additional_data_point.smoothing_range     = data.smoothing_range;
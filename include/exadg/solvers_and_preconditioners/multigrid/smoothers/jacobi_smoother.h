@@ -58,7 +58,8 @@ public:
     AdditionalData()
       : preconditioner(PreconditionerSmoother::PointJacobi),
         number_of_smoothing_steps(5),
-        damping_factor(1.0)
+        damping_factor(1.0),
+        reduced_storage_diagonal(false)
     {
     }
 
@@ -70,6 +71,9 @@ public:
 
     // damping factor
     double damping_factor;
+
+    // store the inverse diagonal of the point-Jacobi preconditioner in bfloat16 format
+    bool reduced_storage_diagonal;
   };
 
   void
@@ -83,8 +87,9 @@ public:
 
     if(data.preconditioner == PreconditionerSmoother::PointJacobi)
     {
-      preconditioner =
-        new JacobiPreconditioner<Operator>(*underlying_operator, initialize_preconditioner);
+      preconditioner = new JacobiPreconditioner<Operator>(*underlying_operator,
+                                                          initialize_preconditioner,
+                                                          data.reduced_storage_diagonal);
     }
     else if(data.preconditioner == PreconditionerSmoother::BlockJacobi)
     {
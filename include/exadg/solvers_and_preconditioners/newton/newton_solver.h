@@ -22,8 +22,13 @@
 #ifndef EXADG_SOLVERS_AND_PRECONDITIONERS_NEWTON_NEWTON_SOLVER_H_
 #define EXADG_SOLVERS_AND_PRECONDITIONERS_NEWTON_NEWTON_SOLVER_H_
 
+// C/C++
+#include <cmath>
+
 // deal.II
 #include <deal.II/base/exceptions.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
@@ -46,7 +51,8 @@ public:
     : solver_data(solver_data_in),
       nonlinear_operator(nonlinear_operator_in),
       linear_operator(linear_operator_in),
-      linear_solver(linear_solver_in)
+      linear_solver(linear_solver_in),
+      n_saved_linear_iterations(0.0)
   {
   }
 
@@ -55,10 +61,9 @@ public:
   {
     unsigned int newton_iterations = 0, linear_iterations = 0;
 
-    VectorType residual, increment, temporary;
-    residual.reinit(solution);
-    increment.reinit(solution);
-    temporary.reinit(solution);
+    // the work vectors are kept alive across calls (e.g. time steps) and only reinitialized if
+    // the layout of the solution vector has changed
+    reinit_work_vectors(solution);
 
     // evaluate residual using initial guess of solution
     nonlinear_operator.evaluate_residual(residual, solution);
@@ -66,6 +71,13 @@ public:
     double norm_r   = residual.l2_norm();
     double norm_r_0 = norm_r;
 
+    // inexact Newton: forcing term of the previous iteration and the tolerance specified for
+    // the linear solver, which is used as lower bound for the forcing term
+    double       forcing_term      = solver_data.forcing_term_max;
+    double const linear_tolerance  = linear_solver.get_default_relative_tolerance();
+    double       norm_r_previous   = norm_r;
+    double const nonlinear_tol_abs = std::max(solver_data.abs_tol, solver_data.rel_tol * norm_r_0);
+
     while(norm_r > this->solver_data.abs_tol and norm_r / norm_r_0 > solver_data.rel_tol and
           newton_iterations < solver_data.max_iter)
     {
@@ -85,8 +97,45 @@ public:
       // update the preconditioner
       linear_solver.update_preconditioner(update_now);
 
+      if(solver_data.use_inexact_newton)
+      {
+        if(newton_iterations > 0)
+          forcing_term = compute_forcing_term(norm_r, norm_r_previous, forcing_term);
+
+        // avoid oversolving in the last Newton iteration: the linear residual does not need to
+        // be reduced below the nonlinear tolerance
+        forcing_term = std::max(forcing_term, 0.5 * nonlinear_tol_abs / norm_r);
+        forcing_term = std::max(forcing_term, linear_tolerance);
+
+        linear_solver.set_relative_tolerance(forcing_term);
+      }
+
       // solve linear problem
-      unsigned int const n_iter_linear = linear_solver.solve(increment, residual);
+      unsigned int n_iter_linear = 0;
+      try
+      {
+        n_iter_linear = linear_solver.solve(increment, residual);
+      }
+      catch(...)
+      {
+        // reset the tolerance of the linear solver in case the caller recovers from the failure,
+        // e.g. by reducing the load increment
+        if(solver_data.use_inexact_newton)
+          linear_solver.set_relative_tolerance(0.0);
+
+        throw;
+      }
+
+      if(solver_data.use_inexact_newton)
+      {
+        linear_solver.set_relative_tolerance(0.0);
+
+        // Estimate the number of linear iterations that would have been needed to reach the
+        // specified linear tolerance, assuming a constant rate of convergence.
+        if(forcing_term > linear_tolerance and linear_tolerance > 0.0)
+          n_saved_linear_iterations +=
+            double(n_iter_linear) * (std::log(linear_tolerance) / std::log(forcing_term) - 1.0);
+      }
 
       // damped Newton scheme
       double             omega         = 1.0; // damping factor (begin with 1)
@@ -94,11 +143,16 @@ public:
       unsigned int       n_iter_damp   = 0;   // counts iteration of damping scheme
       unsigned int const max_iter_damp = 10;  // max iterations of damping scheme
       double const       tau           = 0.5; // a parameter (has to be smaller than 1)
+
+      // the temporary solution is updated in place in the damping iterations, which avoids a copy
+      // of the solution vector per damping iteration
+      double omega_temporary = 0.0; // damping factor of the increment contained in temporary
+      temporary              = solution;
       do
       {
         // add increment to solution vector but scale by a factor omega <= 1
-        temporary = solution;
-        temporary.add(omega, increment);
+        temporary.add(omega - omega_temporary, increment);
+        omega_temporary = omega;
 
         // evaluate residual using the temporary solution
         nonlinear_operator.evaluate_residual(residual, temporary);
@@ -117,9 +171,11 @@ public:
                   dealii::ExcMessage("Damped Newton iteration did not converge. "
                                      "Maximum number of iterations exceeded!"));
 
-      // update solution and residual
-      solution = temporary;
-      norm_r   = norm_r_damp;
+      // update solution and residual (the old solution is no longer needed, so swapping the
+      // vectors avoids a copy)
+      solution.swap(temporary);
+      norm_r_previous = norm_r;
+      norm_r          = norm_r_damp;
 
       // increment iteration counter
       ++newton_iterations;
@@ -142,11 +198,83 @@ public:
     return std::tuple<unsigned int, unsigned int>(newton_iterations, linear_iterations);
   }
 
+  /*
+   * Estimated number of linear iterations saved by the inexact Newton method compared to solving
+   * all linearized problems to the tolerance specified for the linear solver, accumulated over
+   * all calls of solve().
+   */
+  unsigned long long
+  get_estimated_n_saved_linear_iterations() const
+  {
+    return static_cast<unsigned long long>(std::round(n_saved_linear_iterations));
+  }
+
 private:
+  void
+  reinit_work_vectors(VectorType const & solution)
+  {
+    if(not vectors_have_same_layout(residual, solution))
+    {
+      residual.reinit(solution);
+      increment.reinit(solution);
+      temporary.reinit(solution);
+    }
+  }
+
+  template<typename Number>
+  static bool
+  vectors_have_same_layout(dealii::LinearAlgebra::distributed::Vector<Number> const & vector_1,
+                           dealii::LinearAlgebra::distributed::Vector<Number> const & vector_2)
+  {
+    return vector_1.size() == vector_2.size() and
+           vector_1.get_partitioner() == vector_2.get_partitioner();
+  }
+
+  template<typename Number>
+  static bool
+  vectors_have_same_layout(
+    dealii::LinearAlgebra::distributed::BlockVector<Number> const & vector_1,
+    dealii::LinearAlgebra::distributed::BlockVector<Number> const & vector_2)
+  {
+    if(vector_1.n_blocks() != vector_2.n_blocks())
+      return false;
+
+    for(unsigned int b = 0; b < vector_1.n_blocks(); ++b)
+      if(not vectors_have_same_layout(vector_1.block(b), vector_2.block(b)))
+        return false;
+
+    return true;
+  }
+
+  /*
+   * Forcing term according to Eisenstat and Walker (1996), choice 2, including the safeguard
+   * against a too rapid decrease of the forcing term.
+   */
+  double
+  compute_forcing_term(double const norm_r, double const norm_r_previous, double const eta_previous)
+    const
+  {
+    double const gamma = 0.9;
+    double const alpha = 2.0;
+
+    double eta = gamma * std::pow(norm_r / norm_r_previous, alpha);
+
+    double const eta_safeguard = gamma * std::pow(eta_previous, alpha);
+    if(eta_safeguard > 0.1)
+      eta = std::max(eta, eta_safeguard);
+
+    return std::min(eta, solver_data.forcing_term_max);
+  }
+
   SolverData          solver_data;
   NonlinearOperator & nonlinear_operator;
   LinearOperator &    linear_operator;
   LinearSolver &      linear_solver;
+
+  // work vectors
+  VectorType residual, increment, temporary;
+
+  double n_saved_linear_iterations;
 };
 
 } // namespace Newton
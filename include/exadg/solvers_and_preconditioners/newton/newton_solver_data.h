@@ -34,12 +34,21 @@ namespace Newton
 {
 struct SolverData
 {
-  SolverData() : max_iter(100), abs_tol(1.e-12), rel_tol(1.e-12)
+  SolverData()
+    : max_iter(100),
+      abs_tol(1.e-12),
+      rel_tol(1.e-12),
+      use_inexact_newton(false),
+      forcing_term_max(0.9)
   {
   }
 
   SolverData(unsigned int const max_iter_, double const abs_tol_, double const rel_tol_)
-    : max_iter(max_iter_), abs_tol(abs_tol_), rel_tol(rel_tol_)
+    : max_iter(max_iter_),
+      abs_tol(abs_tol_),
+      rel_tol(rel_tol_),
+      use_inexact_newton(false),
+      forcing_term_max(0.9)
   {
   }
 
@@ -49,11 +58,22 @@ struct SolverData
     print_parameter(pcout, "Maximum number of iterations", max_iter);
     print_parameter(pcout, "Absolute solver tolerance", abs_tol);
     print_parameter(pcout, "Relative solver tolerance", rel_tol);
+    print_parameter(pcout, "Inexact Newton", use_inexact_newton);
+    if(use_inexact_newton)
+      print_parameter(pcout, "Maximum forcing term", forcing_term_max);
   }
 
   unsigned int max_iter;
   double       abs_tol;
   double       rel_tol;
+
+  // Inexact Newton method: the relative tolerance of the linear solver (forcing term) is chosen
+  // adaptively from the history of nonlinear residuals according to Eisenstat and Walker (1996),
+  // choice 2. The relative tolerance specified for the linear solver acts as lower bound.
+  bool use_inexact_newton;
+
+  // upper bound for the forcing term, also used in the first Newton iteration
+  double forcing_term_max;
 };
 
 struct UpdateData
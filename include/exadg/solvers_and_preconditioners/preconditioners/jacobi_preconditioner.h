@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/solvers_and_preconditioners/utilities/bfloat16_vector.h>
 
 namespace ExaDG
 {
@@ -36,8 +37,14 @@ class JacobiPreconditioner : public PreconditionerBase<typename Operator::value_
 public:
   typedef typename PreconditionerBase<typename Operator::value_type>::VectorType VectorType;
 
-  JacobiPreconditioner(Operator const & underlying_operator_in, bool const initialize)
-    : underlying_operator(underlying_operator_in)
+  /*
+   * If reduced_storage is true, the inverse diagonal is stored in the 16-bit bfloat16 format and
+   * the full precision vector is only used temporarily when updating the preconditioner.
+   */
+  JacobiPreconditioner(Operator const & underlying_operator_in,
+                       bool const       initialize,
+                       bool const       reduced_storage = false)
+    : underlying_operator(underlying_operator_in), reduced_storage(reduced_storage)
   {
     underlying_operator.initialize_dof_vector(inverse_diagonal);
 
@@ -50,7 +57,11 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const final
   {
-    if(dealii::PointerComparison::equal(&dst, &src))
+    if(reduced_storage)
+    {
+      inverse_diagonal_reduced.scale(dst, src);
+    }
+    else if(dealii::PointerComparison::equal(&dst, &src))
     {
       dst.scale(inverse_diagonal);
     }
@@ -64,21 +75,34 @@ public:
   unsigned int
   get_size_of_diagonal()
   {
-    return inverse_diagonal.size();
+    return reduced_storage ? inverse_diagonal_reduced.size() : inverse_diagonal.size();
   }
 
   void
   update() final
   {
+    if(inverse_diagonal.size() == 0)
+      underlying_operator.initialize_dof_vector(inverse_diagonal);
+
     underlying_operator.calculate_inverse_diagonal(inverse_diagonal);
 
+    if(reduced_storage)
+    {
+      inverse_diagonal_reduced.copy_locally_owned_data_from(inverse_diagonal);
+      inverse_diagonal.reinit(0);
+    }
+
     this->update_needed = false;
   }
 
 private:
   Operator const & underlying_operator;
 
+  bool const reduced_storage;
+
   VectorType inverse_diagonal;
+
+  BFloat16Vector inverse_diagonal_reduced;
 };
 
 } // namespace ExaDG
@@ -39,7 +39,7 @@ template<typename VectorType>
 class SolverBase
 {
 public:
-  SolverBase() : l2_0(1.0), l2_n(1.0), n(0), rho(0.0), n10(0)
+  SolverBase() : l2_0(1.0), l2_n(1.0), n(0), rho(0.0), n10(0), relative_tolerance_override(0.0)
   {
     timer_tree = std::make_shared<TimerTree>();
   }
@@ -77,6 +77,26 @@ public:
     return timer_tree;
   }
 
+  /*
+   * Overrides the relative solver tolerance of the next calls to solve(), e.g. for inexact
+   * Newton methods that choose the forcing term adaptively. A value of 0 restores the tolerance
+   * specified in the solver data.
+   */
+  void
+  set_relative_tolerance(double const relative_tolerance) const
+  {
+    relative_tolerance_override = relative_tolerance;
+  }
+
+  /*
+   * Relative solver tolerance as specified in the solver data (0 if not applicable).
+   */
+  virtual double
+  get_default_relative_tolerance() const
+  {
+    return 0.0;
+  }
+
   // performance metrics
   mutable double       l2_0; // norm of initial residual
   mutable double       l2_n; // norm of final residual
@@ -85,7 +105,17 @@ public:
   mutable double       n10;  // number of iterations needed to reduce the residual by 1e10
 
 protected:
+  double
+  get_relative_tolerance() const
+  {
+    return relative_tolerance_override > 0.0 ? relative_tolerance_override :
+                                               get_default_relative_tolerance();
+  }
+
   std::shared_ptr<TimerTree> timer_tree;
+
+private:
+  mutable double relative_tolerance_override;
 };
 
 struct SolverDataCG
@@ -131,6 +161,12 @@ public:
     }
   }
 
+  double
+  get_default_relative_tolerance() const override
+  {
+    return solver_data.solver_tolerance_rel;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
@@ -138,7 +174,7 @@ public:
 
     dealii::ReductionControl solver_control(solver_data.max_iter,
                                             solver_data.solver_tolerance_abs,
-                                            solver_data.solver_tolerance_rel);
+                                            this->get_relative_tolerance());
 
     dealii::SolverCG<VectorType> solver(solver_control);
 
@@ -249,6 +285,12 @@ public:
     }
   }
 
+  double
+  get_default_relative_tolerance() const override
+  {
+    return solver_data.solver_tolerance_rel;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
@@ -256,7 +298,7 @@ public:
 
     dealii::ReductionControl solver_control(solver_data.max_iter,
                                             solver_data.solver_tolerance_abs,
-                                            solver_data.solver_tolerance_rel);
+                                            this->get_relative_tolerance());
 
     typename dealii::SolverGMRES<VectorType>::AdditionalData additional_data;
     additional_data.max_n_tmp_vectors     = solver_data.max_n_tmp_vectors;
@@ -360,6 +402,12 @@ public:
     }
   }
 
+  double
+  get_default_relative_tolerance() const override
+  {
+    return solver_data.solver_tolerance_rel;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
@@ -367,7 +415,7 @@ public:
 
     dealii::ReductionControl solver_control(solver_data.max_iter,
                                             solver_data.solver_tolerance_abs,
-                                            solver_data.solver_tolerance_rel);
+                                            this->get_relative_tolerance());
 
     typename dealii::SolverFGMRES<VectorType>::AdditionalData additional_data;
     additional_data.max_basis_size = solver_data.max_n_tmp_vectors;
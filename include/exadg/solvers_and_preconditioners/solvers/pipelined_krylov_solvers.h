@@ -0,0 +1,579 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_PIPELINED_KRYLOV_SOLVERS_H_
+#define EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_PIPELINED_KRYLOV_SOLVERS_H_
+
+// C++
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Pipelined preconditioned conjugate gradient method according to
+ *
+ *   Ghysels, Vanroose (2014). Hiding global synchronization latency in the preconditioned
+ *   conjugate gradient algorithm. Parallel Computing 40(7), 224-238.
+ *
+ * The three inner products of one iteration are computed in a single local sweep over the
+ * vectors and reduced by one non-blocking MPI_Iallreduce, which overlaps with the application
+ * of the preconditioner and the operator. All vector updates of one iteration are fused into
+ * one further sweep. Compared to the standard CG method, the pipelined variant needs four
+ * additional vectors and one additional preconditioner application at the very beginning.
+ * Due to the recurrences used for the auxiliary vectors, the attainable accuracy is slightly
+ * lower than for the standard CG method, which is irrelevant for the usual relative
+ * tolerances.
+ *
+ * The solver uses the same solver data as SolverCG and checks the unpreconditioned l2-norm of
+ * the residual.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  SolverPipelinedCG(Operator const &     underlying_operator_in,
+                    Preconditioner &     preconditioner_in,
+                    SolverDataCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      if(preconditioner.needs_update() or update_preconditioner)
+      {
+        preconditioner.update();
+      }
+    }
+  }
+
+  double
+  get_default_relative_tolerance() const override
+  {
+    return solver_data.solver_tolerance_rel;
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    dealii::Timer timer;
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            this->get_relative_tolerance());
+
+    if(solver_data.use_preconditioner == false)
+    {
+      do_solve(solver_control, dst, rhs, dealii::PreconditionIdentity());
+    }
+    else
+    {
+      do_solve(solver_control, dst, rhs, preconditioner);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverPipelinedCG"}, timer.wall_time());
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      this->timer_tree->insert({"SolverPipelinedCG"}, preconditioner.get_timings());
+    }
+
+    return this->timer_tree;
+  }
+
+private:
+  template<typename PreconditionerType>
+  void
+  do_solve(dealii::SolverControl &    solver_control,
+           VectorType &               x,
+           VectorType const &         b,
+           PreconditionerType const & M) const
+  {
+    typedef typename VectorType::value_type Number;
+
+    VectorType r, u, w, m, n, p, q, s, z;
+    r.reinit(b, true);
+    u.reinit(b, true);
+    w.reinit(b, true);
+    m.reinit(b, true);
+    n.reinit(b, true);
+    p.reinit(b);
+    q.reinit(b);
+    s.reinit(b);
+    z.reinit(b);
+
+    // r = b - A x, u = M r, w = A u
+    underlying_operator.vmult(r, x);
+    r.sadd(-1.0, 1.0, b);
+    M.vmult(u, r);
+    underlying_operator.vmult(w, u);
+
+    unsigned int const local_size = b.locally_owned_size();
+    MPI_Comm const     mpi_comm   = b.get_mpi_communicator();
+
+    // local contributions to (r,u), (w,u), (r,r)
+    std::array<double, 3> dots = {{0.0, 0.0, 0.0}};
+    {
+      Number const * r_ptr = r.begin();
+      Number const * u_ptr = u.begin();
+      Number const * w_ptr = w.begin();
+      for(unsigned int i = 0; i < local_size; ++i)
+      {
+        dots[0] += static_cast<double>(r_ptr[i]) * u_ptr[i];
+        dots[1] += static_cast<double>(w_ptr[i]) * u_ptr[i];
+        dots[2] += static_cast<double>(r_ptr[i]) * r_ptr[i];
+      }
+    }
+
+    double gamma_old = 0.0, alpha_old = 0.0;
+
+    dealii::SolverControl::State state = dealii::SolverControl::iterate;
+    for(unsigned int iter = 0; state == dealii::SolverControl::iterate; ++iter)
+    {
+      // start the global reduction and hide its latency behind m = M w and n = A m
+      MPI_Request request;
+      int ierr = MPI_Iallreduce(
+        MPI_IN_PLACE, dots.data(), int(dots.size()), MPI_DOUBLE, MPI_SUM, mpi_comm, &request);
+      AssertThrowMPI(ierr);
+
+      M.vmult(m, w);
+      underlying_operator.vmult(n, m);
+
+      ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      double const gamma = dots[0];
+      double const delta = dots[1];
+
+      state = solver_control.check(iter, std::sqrt(std::abs(dots[2])));
+      if(state != dealii::SolverControl::iterate)
+        break;
+
+      double beta = 0.0, alpha = 0.0;
+      if(iter == 0)
+      {
+        alpha = gamma / delta;
+      }
+      else
+      {
+        beta  = gamma / gamma_old;
+        alpha = gamma / (delta - beta * gamma / alpha_old);
+      }
+
+      AssertThrow(std::isfinite(alpha),
+                  dealii::ExcMessage("Breakdown of pipelined CG method (alpha is not finite)."));
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+
+      Number const a  = static_cast<Number>(alpha);
+      Number const bt = static_cast<Number>(beta);
+
+      // fused vector updates and local contributions to the inner products of the next
+      // iteration
+      dots = {{0.0, 0.0, 0.0}};
+
+      Number *       x_ptr = x.begin();
+      Number *       r_ptr = r.begin();
+      Number *       u_ptr = u.begin();
+      Number *       w_ptr = w.begin();
+      Number const * m_ptr = m.begin();
+      Number const * n_ptr = n.begin();
+      Number *       p_ptr = p.begin();
+      Number *       q_ptr = q.begin();
+      Number *       s_ptr = s.begin();
+      Number *       z_ptr = z.begin();
+      for(unsigned int i = 0; i < local_size; ++i)
+      {
+        z_ptr[i] = n_ptr[i] + bt * z_ptr[i];
+        q_ptr[i] = m_ptr[i] + bt * q_ptr[i];
+        s_ptr[i] = w_ptr[i] + bt * s_ptr[i];
+        p_ptr[i] = u_ptr[i] + bt * p_ptr[i];
+
+        x_ptr[i] += a * p_ptr[i];
+        r_ptr[i] -= a * s_ptr[i];
+        u_ptr[i] -= a * q_ptr[i];
+        w_ptr[i] -= a * z_ptr[i];
+
+        dots[0] += static_cast<double>(r_ptr[i]) * u_ptr[i];
+        dots[1] += static_cast<double>(w_ptr[i]) * u_ptr[i];
+        dots[2] += static_cast<double>(r_ptr[i]) * r_ptr[i];
+      }
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+  Operator const &   underlying_operator;
+  Preconditioner &   preconditioner;
+  SolverDataCG const solver_data;
+};
+
+/*
+ * Restarted GMRES method with right preconditioning and a single global reduction per
+ * iteration (low-synchronization GMRES).
+ *
+ * The new Krylov vector is orthogonalized by classical Gram-Schmidt. All inner products with
+ * the previous basis vectors as well as the squared norm of the unorthogonalized vector are
+ * computed in one sweep over the vectors and reduced by one MPI_Allreduce. The norm of the
+ * orthogonalized vector is then obtained from the Pythagorean identity
+ *
+ *   || w - sum_i h_i v_i ||^2 = ||w||^2 - sum_i h_i^2 ,
+ *
+ * which avoids the second reduction. If this identity suffers from cancellation (i.e., the
+ * new vector is almost contained in the Krylov space), a second Gram-Schmidt pass with an
+ * explicit norm computation is done, which costs one additional reduction in these rare
+ * cases. The standard dealii::SolverGMRES with modified Gram-Schmidt needs j+2 reductions in
+ * iteration j instead.
+ *
+ * If the Krylov space becomes invariant (breakdown), the Arnoldi process is stopped and the
+ * least squares problem is solved for the columns computed so far. A column that does not
+ * extend the range of the Hessenberg matrix (singular operator) is dropped before.
+ *
+ * The solver uses the same solver data as SolverGMRES, where max_n_tmp_vectors is the restart
+ * length. The computation of eigenvalues is not supported.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverGMRESLowSync : public SolverBase<VectorType>
+{
+public:
+  SolverGMRESLowSync(Operator const &        underlying_operator_in,
+                     Preconditioner &        preconditioner_in,
+                     SolverDataGMRES const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+    AssertThrow(solver_data.compute_eigenvalues == false,
+                dealii::ExcMessage(
+                  "SolverGMRESLowSync does not support the computation of eigenvalues."));
+
+    AssertThrow(solver_data.max_n_tmp_vectors > 2,
+                dealii::ExcMessage("SolverGMRESLowSync requires max_n_tmp_vectors > 2."));
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      if(preconditioner.needs_update() or update_preconditioner)
+      {
+        preconditioner.update();
+      }
+    }
+  }
+
+  double
+  get_default_relative_tolerance() const override
+  {
+    return solver_data.solver_tolerance_rel;
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    dealii::Timer timer;
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            this->get_relative_tolerance());
+
+    if(solver_data.use_preconditioner == false)
+    {
+      do_solve(solver_control, dst, rhs, dealii::PreconditionIdentity());
+    }
+    else
+    {
+      do_solve(solver_control, dst, rhs, preconditioner);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Last iteration step contained NaN or Inf values."));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverGMRESLowSync"}, timer.wall_time());
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+    {
+      this->timer_tree->insert({"SolverGMRESLowSync"}, preconditioner.get_timings());
+    }
+
+    return this->timer_tree;
+  }
+
+private:
+  /*
+   * Computes h_i = (v_i, w) for i < n_basis and, in the last entry, (w, w) with a single
+   * global reduction.
+   */
+  static void
+  compute_inner_products(std::vector<double> &           h,
+                         std::vector<VectorType> const & basis,
+                         unsigned int const              n_basis,
+                         VectorType const &              w)
+  {
+    typedef typename VectorType::value_type Number;
+
+    h.assign(n_basis + 1, 0.0);
+
+    unsigned int const local_size = w.locally_owned_size();
+    Number const *     w_ptr      = w.begin();
+    for(unsigned int k = 0; k < n_basis; ++k)
+    {
+      Number const * v_ptr = basis[k].begin();
+      double         sum   = 0.0;
+      for(unsigned int i = 0; i < local_size; ++i)
+        sum += static_cast<double>(v_ptr[i]) * w_ptr[i];
+      h[k] = sum;
+    }
+
+    double sum = 0.0;
+    for(unsigned int i = 0; i < local_size; ++i)
+      sum += static_cast<double>(w_ptr[i]) * w_ptr[i];
+    h[n_basis] = sum;
+
+    dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(h.data(), h.size()),
+                                w.get_mpi_communicator(),
+                                dealii::ArrayView<double>(h.data(), h.size()));
+  }
+
+  /*
+   * w -= sum_i h_i v_i, fused into one sweep over w.
+   */
+  static void
+  subtract_projection(VectorType &                    w,
+                      std::vector<VectorType> const & basis,
+                      std::vector<double> const &     h,
+                      unsigned int const              n_basis)
+  {
+    typedef typename VectorType::value_type Number;
+
+    unsigned int const local_size = w.locally_owned_size();
+    Number *           w_ptr      = w.begin();
+    for(unsigned int k = 0; k < n_basis; ++k)
+    {
+      Number const * v_ptr = basis[k].begin();
+      Number const   h_k   = static_cast<Number>(h[k]);
+      for(unsigned int i = 0; i < local_size; ++i)
+        w_ptr[i] -= h_k * v_ptr[i];
+    }
+  }
+
+  template<typename PreconditionerType>
+  void
+  do_solve(dealii::SolverControl &    solver_control,
+           VectorType &               x,
+           VectorType const &         b,
+           PreconditionerType const & M) const
+  {
+    unsigned int const restart = solver_data.max_n_tmp_vectors - 1;
+
+    std::vector<VectorType> basis(restart + 1);
+    for(auto & v : basis)
+      v.reinit(b, true);
+
+    VectorType tmp;
+    tmp.reinit(b, true);
+
+    // Hessenberg matrix (column-wise), Givens rotations and right-hand side of least squares
+    // problem
+    std::vector<std::vector<double>> H(restart, std::vector<double>(restart + 1, 0.0));
+    std::vector<double>              cs(restart), sn(restart), g(restart + 1), y(restart);
+    std::vector<double>              h;
+
+    // threshold on ||w - sum_i h_i v_i||^2 / ||w||^2 below which the Pythagorean norm
+    // estimate is considered unreliable and a second Gram-Schmidt pass is done
+    double const cancellation_threshold = 1.e-6;
+
+    unsigned int                 iter  = 0;
+    dealii::SolverControl::State state = dealii::SolverControl::iterate;
+    while(state == dealii::SolverControl::iterate)
+    {
+      // r = b - A x
+      underlying_operator.vmult(basis[0], x);
+      basis[0].sadd(-1.0, 1.0, b);
+      double const beta = basis[0].l2_norm();
+
+      state = solver_control.check(iter, beta);
+      if(state != dealii::SolverControl::iterate)
+        break;
+
+      basis[0] *= 1.0 / beta;
+      std::fill(g.begin(), g.end(), 0.0);
+      g[0] = beta;
+
+      // number of columns of the least squares problem, which is smaller than the number of
+      // Arnoldi steps if the last column had to be dropped due to a breakdown
+      unsigned int n_columns = 0;
+      bool         breakdown = false;
+      for(unsigned int j = 0;
+          j < restart and state == dealii::SolverControl::iterate and not breakdown;
+          ++j)
+      {
+        // w = A M^{-1} v_j (right preconditioning)
+        M.vmult(tmp, basis[j]);
+        underlying_operator.vmult(basis[j + 1], tmp);
+
+        // classical Gram-Schmidt with a single fused reduction
+        VectorType & w = basis[j + 1];
+        compute_inner_products(h, basis, j + 1, w);
+        subtract_projection(w, basis, h, j + 1);
+
+        double const w_norm_square = h[j + 1];
+        double       proj_square   = 0.0;
+        for(unsigned int k = 0; k <= j; ++k)
+        {
+          H[j][k] = h[k];
+          proj_square += h[k] * h[k];
+        }
+        double h_next_square = w_norm_square - proj_square;
+
+        if(h_next_square <= cancellation_threshold * w_norm_square)
+        {
+          // second Gram-Schmidt pass with explicit norm computation
+          compute_inner_products(h, basis, j + 1, w);
+          subtract_projection(w, basis, h, j + 1);
+
+          double correction_square = 0.0;
+          for(unsigned int k = 0; k <= j; ++k)
+          {
+            H[j][k] += h[k];
+            correction_square += h[k] * h[k];
+          }
+          h_next_square = h[j + 1] - correction_square;
+        }
+
+        double const h_next = std::sqrt(std::max(h_next_square, 0.0));
+        H[j][j + 1]         = h_next;
+
+        // Breakdown: A M^{-1} v_j lies in the current Krylov space, which is hence invariant.
+        // The new basis vector can not be normalized and the Arnoldi process has to stop.
+        double const column_norm = std::sqrt(w_norm_square);
+
+        breakdown = (h_next <= std::numeric_limits<double>::epsilon() * column_norm);
+
+        if(not breakdown)
+          w *= 1.0 / h_next;
+
+        // apply previous Givens rotations to the new column and compute a new one
+        for(unsigned int k = 0; k < j; ++k)
+        {
+          double const tmp_k = cs[k] * H[j][k] + sn[k] * H[j][k + 1];
+          H[j][k + 1]        = -sn[k] * H[j][k] + cs[k] * H[j][k + 1];
+          H[j][k]            = tmp_k;
+        }
+        double const denominator = std::sqrt(H[j][j] * H[j][j] + h_next * h_next);
+
+        ++iter;
+        if(denominator <= std::numeric_limits<double>::epsilon() * column_norm)
+        {
+          // The rotated column vanishes, i.e., the Hessenberg matrix is singular and the new
+          // column does not reduce the residual. The column is dropped and the least squares
+          // problem is solved with the previous columns only.
+          state = solver_control.check(iter, std::abs(g[j]));
+        }
+        else
+        {
+          cs[j]       = H[j][j] / denominator;
+          sn[j]       = h_next / denominator;
+          H[j][j]     = denominator;
+          H[j][j + 1] = 0.0;
+          g[j + 1]    = -sn[j] * g[j];
+          g[j]        = cs[j] * g[j];
+          n_columns   = j + 1;
+
+          // in case of a lucky breakdown (h_next = 0), the residual estimate is zero
+          state = solver_control.check(iter, std::abs(g[j + 1]));
+        }
+      }
+
+      // solve upper triangular system H y = g and update x += M^{-1} V y
+      for(unsigned int k = n_columns; k-- > 0;)
+      {
+        double sum = g[k];
+        for(unsigned int l = k + 1; l < n_columns; ++l)
+          sum -= H[l][k] * y[l];
+        y[k] = sum / H[k][k];
+      }
+
+      tmp = 0.0;
+      for(unsigned int k = 0; k < n_columns; ++k)
+        tmp.add(y[k], basis[k]);
+      M.vmult(basis[0], tmp);
+      x += basis[0];
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+  Operator const &      underlying_operator;
+  Preconditioner &      preconditioner;
+  SolverDataGMRES const solver_data;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_PIPELINED_KRYLOV_SOLVERS_H_ */
@@ -0,0 +1,247 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_HISTORY_PROJECTION_H_
+#define EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_HISTORY_PROJECTION_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/timer.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/utilities/linear_algebra_utilities.h>
+
+namespace ExaDG
+{
+/**
+ * Initial guess for a sequence of linear systems A x = b with the same symmetric positive
+ * (semi-)definite matrix A and changing right-hand sides b, as arising from the pressure Poisson
+ * equation in projection methods. The class stores a basis {x_k} of (differences of) previous
+ * solutions that is orthonormal with respect to the A-inner product, i.e., x_i^T A x_j = delta_ij,
+ * together with the vectors A x_k. The initial guess is the Galerkin projection of the solution
+ * onto the span of the basis,
+ *
+ *   x_0 = sum_k (x_k^T b) x_k ,
+ *
+ * which is the best approximation of the solution in the A-norm within this space, see
+ *
+ *   Fischer, P.F. (1998), Projection techniques for iterative solution of Ax = b with successive
+ *   right-hand sides, Comput. Methods Appl. Mech. Engrg. 163, 193-204.
+ *
+ * After the solve, the correction x - x_0 is A-orthonormalized against the basis and appended,
+ * which requires one application of the operator. Once the basis has reached its maximum size,
+ * it is restarted with the latest solution. The basis has to be cleared whenever A changes.
+ */
+template<typename VectorType>
+class SolutionHistoryProjection
+{
+public:
+  SolutionHistoryProjection()
+    : max_size(0),
+      initial_guess_is_valid(false),
+      relative_residual(1.0),
+      wall_time_last(0.0)
+  {
+  }
+
+  /*
+   * Sets the maximum number of basis vectors. A value of 0 deactivates this class.
+   */
+  void
+  reinit(unsigned int const max_size_in)
+  {
+    max_size = max_size_in;
+    clear();
+  }
+
+  bool
+  is_active() const
+  {
+    return max_size > 0;
+  }
+
+  void
+  clear()
+  {
+    basis.clear();
+    operator_times_basis.clear();
+    initial_guess_is_valid = false;
+  }
+
+  unsigned int
+  size() const
+  {
+    return basis.size();
+  }
+
+  /*
+   * Overwrites dst by the projection of the solution onto the basis. Returns false without
+   * modifying dst if the basis is empty.
+   */
+  bool
+  compute_initial_guess(VectorType & dst, VectorType const & rhs)
+  {
+    dealii::Timer timer;
+
+    initial_guess_is_valid = false;
+    if(basis.empty())
+      return false;
+
+    // all coefficients x_k^T b and ||b||^2 with a single global reduction
+    std::vector<double> const alpha = compute_inner_products(basis, rhs, true);
+
+    dst = 0.0;
+    residual.reinit(rhs, true /* omit_zeroing_entries */);
+    residual = rhs;
+    for(unsigned int k = 0; k < basis.size(); ++k)
+    {
+      dst.add(alpha[k], basis[k]);
+      // b - A x_0 is available without applying A since the A x_k are stored
+      residual.add(-alpha[k], operator_times_basis[k]);
+    }
+
+    double const rhs_norm = std::sqrt(alpha.back());
+    relative_residual     = rhs_norm > 0.0 ? residual.l2_norm() / rhs_norm : 0.0;
+
+    initial_guess.reinit(dst, true /* omit_zeroing_entries */);
+    initial_guess          = dst;
+    initial_guess_is_valid = true;
+
+    wall_time_last = timer.wall_time();
+
+    return true;
+  }
+
+  /*
+   * Extends the basis by the solution of the last linear system. The operator A is passed as a
+   * function dst = A src.
+   */
+  void
+  update(VectorType const &                                              solution,
+         std::function<void(VectorType &, VectorType const &)> const & apply_operator)
+  {
+    dealii::Timer timer;
+
+    VectorType direction(solution);
+    if(basis.size() == max_size)
+    {
+      // restart with the latest solution
+      clear();
+    }
+    else if(initial_guess_is_valid)
+    {
+      direction.add(-1.0, initial_guess);
+    }
+
+    VectorType operator_times_direction;
+    operator_times_direction.reinit(direction, true /* omit_zeroing_entries */);
+    apply_operator(operator_times_direction, direction);
+
+    // The correction is A-orthogonal to the basis in exact arithmetic (Galerkin property). Due to
+    // the inexact linear solve and round-off, one classical Gram-Schmidt pass is applied
+    // nevertheless, computing all coefficients x_k^T A d with a single global reduction.
+    std::vector<double> const beta = compute_inner_products(basis, operator_times_direction, false);
+    for(unsigned int k = 0; k < basis.size(); ++k)
+    {
+      direction.add(-beta[k], basis[k]);
+      operator_times_direction.add(-beta[k], operator_times_basis[k]);
+    }
+
+    double const norm = compute_energy_norm(direction, operator_times_direction);
+
+    // The A-norm of the direction before orthogonalization follows from Pythagoras since the basis
+    // is A-orthonormal, which avoids another global reduction.
+    double norm_initial_squared = norm * norm;
+    for(unsigned int k = 0; k < basis.size(); ++k)
+      norm_initial_squared += beta[k] * beta[k];
+    double const norm_initial = std::sqrt(norm_initial_squared);
+
+    // Skip directions that are (numerically) linearly dependent on the basis or lie in the kernel
+    // of A, e.g., constant pressure modes for a pure Neumann problem.
+    if(norm > 1.e-10 * norm_initial and norm > 0.0)
+    {
+      direction *= 1.0 / norm;
+      operator_times_direction *= 1.0 / norm;
+      basis.push_back(std::move(direction));
+      operator_times_basis.push_back(std::move(operator_times_direction));
+    }
+
+    initial_guess_is_valid = false;
+
+    wall_time_last += timer.wall_time();
+  }
+
+  /*
+   * Prints the basis size, the relative residual ||b - A x_0|| / ||b|| of the projected initial
+   * guess, and the wall time spent in this class for the current linear system.
+   */
+  void
+  print_info(dealii::ConditionalOStream const & pcout) const
+  {
+    // clang-format off
+    pcout << "  Initial guess by solution history projection:" << std::endl
+          << "  Basis size:   " << std::setw(12) << std::right << basis.size() << std::endl
+          << "  Rel. residual:" << std::setw(12) << std::scientific << std::setprecision(2) << std::right << relative_residual << std::endl
+          << "  Wall time [s]:" << std::setw(12) << std::scientific << std::setprecision(2) << std::right << wall_time_last << std::endl
+          << std::flush;
+    // clang-format on
+  }
+
+  double
+  get_wall_time_last() const
+  {
+    return wall_time_last;
+  }
+
+private:
+  /*
+   * Returns sqrt(v^T A v) given v and A v, where negative values due to round-off are cut off.
+   */
+  static double
+  compute_energy_norm(VectorType const & v, VectorType const & operator_times_v)
+  {
+    return std::sqrt(std::max(static_cast<double>(v * operator_times_v), 0.0));
+  }
+
+  unsigned int max_size;
+
+  std::vector<VectorType> basis;
+  std::vector<VectorType> operator_times_basis;
+
+  VectorType initial_guess;
+  bool       initial_guess_is_valid;
+
+  VectorType residual;
+  double     relative_residual;
+
+  double wall_time_last;
+};
+
+} // namespace ExaDG
+
+#endif /* EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_HISTORY_PROJECTION_H_ */
@@ -0,0 +1,125 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_BFLOAT16_VECTOR_H_
+#define EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_BFLOAT16_VECTOR_H_
+
+// C++
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+/*
+ * Storage of the locally owned entries of a distributed vector in the 16-bit bfloat16 format, i.e.,
+ * the upper half of an IEEE single precision number. The format has the exponent range of float,
+ * but only 8 significant bits (relative rounding error of at most 2^-8). It halves the memory
+ * transfer compared to float for data that tolerates this accuracy, e.g. the inverse diagonal of
+ * a Jacobi smoother. The entries are converted to float, and all arithmetic is done in the number
+ * type of the vectors the stored data is applied to.
+ */
+class BFloat16Vector
+{
+public:
+  BFloat16Vector() : global_size(0)
+  {
+  }
+
+  template<typename Number>
+  void
+  copy_locally_owned_data_from(dealii::LinearAlgebra::distributed::Vector<Number> const & src)
+  {
+    global_size = src.size();
+
+    values.resize(src.locally_owned_size());
+    for(unsigned int i = 0; i < values.size(); ++i)
+      values[i] = to_bfloat16(static_cast<float>(src.local_element(i)));
+  }
+
+  /*
+   * dst = diag(*this) * src for the locally owned entries, where dst and src may be the same
+   * vector.
+   */
+  template<typename Number>
+  void
+  scale(dealii::LinearAlgebra::distributed::Vector<Number> &       dst,
+        dealii::LinearAlgebra::distributed::Vector<Number> const & src) const
+  {
+    AssertDimension(dst.locally_owned_size(), values.size());
+    AssertDimension(src.locally_owned_size(), values.size());
+
+    for(unsigned int i = 0; i < values.size(); ++i)
+      dst.local_element(i) = static_cast<Number>(to_float(values[i])) * src.local_element(i);
+  }
+
+  float
+  local_element(unsigned int const i) const
+  {
+    return to_float(values[i]);
+  }
+
+  // global size of the vector the data has been copied from
+  dealii::types::global_dof_index
+  size() const
+  {
+    return global_size;
+  }
+
+  // rounds to the nearest bfloat16 number, ties to even
+  static std::uint16_t
+  to_bfloat16(float const value)
+  {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    // keep NaN a (quiet) NaN, rounding could otherwise turn it into infinity
+    if((bits & 0x7fffffffu) > 0x7f800000u)
+      return static_cast<std::uint16_t>((bits >> 16) | 0x0040u);
+
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+
+    return static_cast<std::uint16_t>(bits >> 16);
+  }
+
+  static float
+  to_float(std::uint16_t const value)
+  {
+    std::uint32_t const bits = static_cast<std::uint32_t>(value) << 16;
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+
+    return result;
+  }
+
+private:
+  dealii::types::global_dof_index global_size;
+
+  std::vector<std::uint16_t> values;
+};
+
+} // namespace ExaDG
+
+#endif /* EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_BFLOAT16_VECTOR_H_ */
@@ -158,7 +158,7 @@ public:
                                     component_is_part_of_vector);
     }
 
-    vector_writer.write_pvtu();
+    vector_writer.write();
   }
 
 private:
@@ -22,8 +22,13 @@
 #ifndef EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_LINEAR_ALGEBRA_UTILITIES_H_
 #define EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_LINEAR_ALGEBRA_UTILITIES_H_
 
+// C/C++
+#include <vector>
+
 // deal.II
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_vector.h>
 
@@ -164,6 +169,46 @@ apply_function_in_double_precision(
   }
 }
 
+/*
+ * Computes the inner products (v_i, w) of all vectors v_i with w and, if requested, (w, w) as last
+ * entry with a single global reduction.
+ */
+template<typename VectorType>
+std::vector<double>
+compute_inner_products(std::vector<VectorType> const & vectors,
+                       VectorType const &              w,
+                       bool const                      include_norm_squared)
+{
+  typedef typename VectorType::value_type Number;
+
+  std::vector<double> result(vectors.size() + (include_norm_squared ? 1 : 0), 0.0);
+
+  unsigned int const local_size = w.locally_owned_size();
+  Number const *     w_ptr      = w.begin();
+  for(unsigned int k = 0; k < vectors.size(); ++k)
+  {
+    Number const * v_ptr = vectors[k].begin();
+    double         sum   = 0.0;
+    for(unsigned int i = 0; i < local_size; ++i)
+      sum += static_cast<double>(v_ptr[i]) * w_ptr[i];
+    result[k] = sum;
+  }
+
+  if(include_norm_squared)
+  {
+    double sum = 0.0;
+    for(unsigned int i = 0; i < local_size; ++i)
+      sum += static_cast<double>(w_ptr[i]) * w_ptr[i];
+    result.back() = sum;
+  }
+
+  dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(result.data(), result.size()),
+                              w.get_mpi_communicator(),
+                              dealii::ArrayView<double>(result.data(), result.size()));
+
+  return result;
+}
+
 } // namespace ExaDG
 
 #endif /* EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_LINEAR_ALGEBRA_UTILITIES_H_ */
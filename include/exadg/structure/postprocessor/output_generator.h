@@ -26,6 +26,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/postprocessor/asynchronous_output_writer.h>
 #include <exadg/postprocessor/output_data_base.h>
 #include <exadg/postprocessor/time_control.h>
 
@@ -57,6 +58,9 @@ private:
   dealii::ObserverPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::ObserverPointer<dealii::Mapping<dim> const>    mapping;
   OutputDataBase                                         output_data;
+
+  // writes output in the background in case of asynchronous output
+  mutable AsynchronousOutputWriter asynchronous_writer;
 };
 
 } // namespace Structure
@@ -76,6 +76,9 @@ public:
                   double const       time,
                   bool const         update_preconditioner) const = 0;
 
+  virtual unsigned long long
+  get_estimated_n_saved_linear_iterations_newton() const = 0;
+
   virtual void
   rhs(VectorType & dst, double const time) const = 0;
 
@@ -936,6 +936,16 @@ Operator<dim, Number>::solve_nonlinear(VectorType &       sol,
   return iter;
 }
 
+template<int dim, typename Number>
+unsigned long long
+Operator<dim, Number>::get_estimated_n_saved_linear_iterations_newton() const
+{
+  if(newton_solver)
+    return newton_solver->get_estimated_n_saved_linear_iterations();
+
+  return 0;
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::rhs(VectorType & dst, double const time) const
@@ -276,6 +276,12 @@ public:
                   double const       time,
                   bool const         update_preconditioner) const final;
 
+  /*
+   * Estimated number of linear iterations saved by the inexact Newton method (accumulated).
+   */
+  unsigned long long
+  get_estimated_n_saved_linear_iterations_newton() const final;
+
   /*
    * This function calculates the right-hand side of the linear system of equations for linear
    * elasticity problems.
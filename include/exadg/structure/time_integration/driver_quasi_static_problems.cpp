@@ -103,6 +103,14 @@ DriverQuasiStatic<dim, Number>::print_iterations() const
       iterations_avg[2] = iterations_avg[1] / iterations_avg[0];
     else
       iterations_avg[2] = iterations_avg[1];
+
+    if(param.newton_solver_data.use_inexact_newton)
+    {
+      names.push_back("Linear iterations (estimated saving by inexact Newton)");
+      iterations_avg.push_back(
+        (double)pde_operator->get_estimated_n_saved_linear_iterations_newton() /
+        std::max(1., (double)iterations.first));
+    }
   }
   else // linear
   {
@@ -281,15 +281,15 @@ TimeIntGenAlpha<dim, Number>::prepare_vectors_for_next_timestep()
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_write_restart(std::string const & filename) const
+TimeIntGenAlpha<dim, Number>::do_write_restart(std::ostream & out) const
 {
-  (void)filename;
+  (void)out;
   AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
 }
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_read_restart(std::ifstream & in)
+TimeIntGenAlpha<dim, Number>::do_read_restart(std::istream & in)
 {
   (void)in;
   AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
@@ -338,6 +338,14 @@ TimeIntGenAlpha<dim, Number>::print_iterations() const
       iterations_avg[2] = iterations_avg[1] / iterations_avg[0];
     else
       iterations_avg[2] = iterations_avg[1];
+
+    if(param.newton_solver_data.use_inexact_newton)
+    {
+      names.push_back("Linear iterations (estimated saving by inexact Newton)");
+      iterations_avg.push_back(
+        (double)pde_operator->get_estimated_n_saved_linear_iterations_newton() /
+        std::max(1., (double)iterations.first));
+    }
   }
   else // linear
   {
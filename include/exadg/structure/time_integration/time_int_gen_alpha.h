@@ -110,10 +110,10 @@ private:
   prepare_vectors_for_next_timestep() final;
 
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::ostream & out) const final;
 
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::istream & in) final;
 
   void
   postprocessing() const final;
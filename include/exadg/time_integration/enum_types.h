@@ -41,6 +41,26 @@ enum class GenAlphaType
   BossakAlpha
 };
 
+/*
+ * Format of restart files
+ *
+ * PerRankArchive: every MPI rank writes its locally owned vector entries into a separate boost
+ * archive. A restart requires the same number of MPI ranks and the same partitioning.
+ *
+ * SharedFile: the archives of all MPI ranks are written into a single binary file with collective
+ * MPI-IO, avoiding one file per rank. The file header contains the size and a checksum of each
+ * archive. A restart requires the same number of MPI ranks and the same partitioning.
+ *
+ * PartitionIndependent: the solution vectors are attached to the triangulation and serialized
+ * together with the triangulation. A restart is possible on an arbitrary number of MPI ranks.
+ */
+enum class RestartFormat
+{
+  PerRankArchive,
+  SharedFile,
+  PartitionIndependent
+};
+
 } // namespace ExaDG
 
 #endif /* EXADG_TIME_INTEGRATION_ENUM_TYPES_H_ */
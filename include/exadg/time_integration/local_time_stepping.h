@@ -0,0 +1,490 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_
+#define EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_
+
+// C/C++
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+template<typename Operator, typename VectorType>
+class LocalTimeStepping;
+
+/*
+ *  Operator of a single time step cluster as seen by the Runge-Kutta scheme advancing this
+ *  cluster. Vectors of this operator only contain the degrees of freedom of the cells of the
+ *  cluster and the flux register entries at the interfaces to other clusters, so that the vector
+ *  updates of the Runge-Kutta scheme scale with the size of the cluster and not with the size of
+ *  the whole problem.
+ */
+template<typename Operator, typename VectorType>
+class TimeStepClusterOperator
+{
+public:
+  TimeStepClusterOperator(LocalTimeStepping<Operator, VectorType> * local_time_stepping_in,
+                          unsigned int const                        cluster_in)
+    : local_time_stepping(local_time_stepping_in), cluster(cluster_in)
+  {
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    local_time_stepping->initialize_cluster_vector(vector, cluster);
+  }
+
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const time) const
+  {
+    local_time_stepping->evaluate_cluster(dst, src, time, cluster);
+  }
+
+private:
+  LocalTimeStepping<Operator, VectorType> * local_time_stepping;
+
+  unsigned int const cluster;
+};
+
+/*
+ *  Local (multirate) time stepping for explicit Runge-Kutta schemes.
+ *
+ *  The cells of the mesh are grouped into time step clusters k = 0, ..., K-1 by the underlying
+ *  operator, where cluster k is advanced with the time step size dt_k = 2^(k-K+1) * time_step,
+ *  i.e., the time step size handed over to solve_timestep() is the one of the coarsest cluster
+ *  K-1. Each cluster is integrated with its own instance of the chosen single-rate Runge-Kutta
+ *  scheme. The clusters are advanced recursively starting with the coarsest one, and cluster k
+ *  performs two steps of size dt_{k-1} for cluster k-1 after each of its own steps.
+ *
+ *  The states of neighboring cells belonging to other clusters are required at the stage times
+ *  of a cluster. These are approximated linearly in time based on the last step of the
+ *  respective cluster, which amounts to an interpolation for coarser clusters and to an
+ *  extrapolation for finer clusters. The overall scheme is therefore limited to second order
+ *  accuracy in time.
+ *
+ *  Conservation at the interfaces between clusters is ensured by flux registers (refluxing): The
+ *  contributions of a face between a fine and a coarse cluster are integrated in time by the fine
+ *  cluster for both adjacent cells. During its own time step, the coarse cluster uses its own
+ *  approximation of these contributions. Once the fine cluster has caught up, this approximation
+ *  is replaced by the time integral accumulated by the fine cluster. Both time integrals are
+ *  computed by the Runge-Kutta scheme of the respective cluster, for which the vectors of a
+ *  cluster are extended by the register entries.
+ *
+ *  The underlying operator has to provide the following functions:
+ *
+ *    void
+ *    initialize_dof_vector(VectorType & vector) const;
+ *
+ *    unsigned int
+ *    get_number_of_time_step_clusters() const;
+ *
+ *    // cluster_dofs[k]: locally owned dofs (local indices) of the cells of cluster k
+ *    // neighbor_dofs[k][j]: locally owned dofs (local indices) of the cells of cluster j that
+ *    // are face neighbors of cells of cluster k
+ *    void
+ *    get_time_step_cluster_dofs(
+ *      std::vector<std::vector<unsigned int>> &              cluster_dofs,
+ *      std::vector<std::vector<std::vector<unsigned int>>> & neighbor_dofs) const;
+ *
+ *    // evaluates the operator for the cells of cluster k, where src only contains valid values
+ *    // for the dofs of cluster k and the neighbor dofs of cluster k: dst is required for the dofs
+ *    // of cluster k and for the neighbor dofs of coarser clusters j > k. For the latter, dst
+ *    // contains the contributions of the faces shared with cells of cluster k to the right-hand
+ *    // side, i.e., before the inverse mass matrix is applied.
+ *    void
+ *    evaluate_time_step_cluster(VectorType &       dst,
+ *                               VectorType const & src,
+ *                               Number const       time,
+ *                               unsigned int const cluster) const;
+ *
+ *    // contributions of the faces between cells of cluster k and cells of finer clusters j < k
+ *    // to the right-hand side for the dofs of cluster k, before the inverse mass matrix is applied
+ *    void
+ *    evaluate_time_step_cluster_interface(VectorType &       dst,
+ *                                         VectorType const & src,
+ *                                         Number const       time,
+ *                                         unsigned int const cluster) const;
+ *
+ *    // dst = M^-1 * src for the dofs of cluster k
+ *    void
+ *    apply_inverse_mass_time_step_cluster(VectorType &       dst,
+ *                                         VectorType const & src,
+ *                                         unsigned int const cluster) const;
+ *
+ *  VectorType is assumed to be of type dealii::LinearAlgebra::distributed::Vector.
+ */
+template<typename Operator, typename VectorType>
+class LocalTimeStepping : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  typedef typename VectorType::value_type Number;
+
+  typedef TimeStepClusterOperator<Operator, VectorType>       ClusterOperator;
+  typedef ExplicitTimeIntegrator<ClusterOperator, VectorType> ClusterTimeIntegrator;
+
+  typedef std::function<std::shared_ptr<ClusterTimeIntegrator>(std::shared_ptr<ClusterOperator>)>
+    ClusterTimeIntegratorFactory;
+
+  LocalTimeStepping(std::shared_ptr<Operator> const      operator_in,
+                    ClusterTimeIntegratorFactory const & create_cluster_time_integrator)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      n_clusters(operator_in->get_number_of_time_step_clusters()),
+      time_last_step(std::numeric_limits<double>::quiet_NaN())
+  {
+    AssertThrow(n_clusters > 0, dealii::ExcMessage("Invalid number of time step clusters."));
+
+    this->underlying_operator->initialize_dof_vector(src_full);
+    this->underlying_operator->initialize_dof_vector(dst_full);
+
+    std::vector<std::vector<std::vector<unsigned int>>> neighbor_dofs_full;
+    this->underlying_operator->get_time_step_cluster_dofs(cluster_dofs, neighbor_dofs_full);
+
+    AssertThrow(cluster_dofs.size() == n_clusters and neighbor_dofs_full.size() == n_clusters,
+                dealii::ExcMessage("Time step cluster dofs have not been set up correctly."));
+
+    // For the neighbor dofs, store the position within the respective cluster vector instead of
+    // the index of the full vector, which allows to work on the cluster vectors directly.
+    std::vector<unsigned int> position_in_cluster(src_full.locally_owned_size(),
+                                                  dealii::numbers::invalid_unsigned_int);
+    for(unsigned int j = 0; j < n_clusters; ++j)
+      for(unsigned int i = 0; i < cluster_dofs[j].size(); ++i)
+        position_in_cluster[cluster_dofs[j][i]] = i;
+
+    neighbor_dofs.resize(n_clusters, std::vector<std::vector<unsigned int>>(n_clusters));
+    for(unsigned int k = 0; k < n_clusters; ++k)
+    {
+      AssertThrow(neighbor_dofs_full[k].size() == n_clusters,
+                  dealii::ExcMessage("Time step cluster dofs have not been set up correctly."));
+
+      for(unsigned int j = 0; j < n_clusters; ++j)
+      {
+        neighbor_dofs[k][j].reserve(neighbor_dofs_full[k][j].size());
+        for(unsigned int const index : neighbor_dofs_full[k][j])
+          neighbor_dofs[k][j].push_back(position_in_cluster[index]);
+      }
+    }
+
+    // Flux registers: the dofs of cluster j adjacent to finer clusters are corrected at the end of
+    // each time step of cluster j. For the neighbor dofs of coarser clusters, store the position
+    // within the flux register of the respective cluster.
+    interface_dofs.resize(n_clusters);
+    for(unsigned int j = 0; j < n_clusters; ++j)
+    {
+      for(unsigned int k = 0; k < j; ++k)
+        interface_dofs[j].insert(interface_dofs[j].end(),
+                                 neighbor_dofs[k][j].begin(),
+                                 neighbor_dofs[k][j].end());
+
+      std::sort(interface_dofs[j].begin(), interface_dofs[j].end());
+      interface_dofs[j].erase(std::unique(interface_dofs[j].begin(), interface_dofs[j].end()),
+                              interface_dofs[j].end());
+    }
+
+    register_position.resize(n_clusters, std::vector<std::vector<unsigned int>>(n_clusters));
+    n_register_entries.resize(n_clusters, 0);
+    for(unsigned int k = 0; k < n_clusters; ++k)
+    {
+      n_register_entries[k] = interface_dofs[k].size();
+      for(unsigned int j = k + 1; j < n_clusters; ++j)
+      {
+        for(unsigned int const i : neighbor_dofs[k][j])
+          register_position[k][j].push_back(
+            std::lower_bound(interface_dofs[j].begin(), interface_dofs[j].end(), i) -
+            interface_dofs[j].begin());
+
+        n_register_entries[k] += neighbor_dofs[k][j].size();
+      }
+    }
+
+    flux_register.resize(n_clusters);
+    for(unsigned int k = 0; k < n_clusters; ++k)
+      flux_register[k].resize(interface_dofs[k].size());
+
+    MPI_Comm const mpi_comm = src_full.get_mpi_communicator();
+
+    // The vectors of a cluster contain the dofs of the cluster followed by the register entries,
+    // namely the contributions of the faces shared with finer clusters to the dofs of the cluster
+    // and the contributions of the faces shared with coarser clusters to the neighbor dofs of the
+    // coarser clusters.
+    partitioners.resize(n_clusters);
+    for(unsigned int k = 0; k < n_clusters; ++k)
+    {
+      std::vector<dealii::IndexSet> const owned_dofs =
+        dealii::Utilities::MPI::create_ascending_partitioning(mpi_comm,
+                                                              cluster_dofs[k].size() +
+                                                                n_register_entries[k]);
+
+      partitioners[k] = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+        owned_dofs[dealii::Utilities::MPI::this_mpi_process(mpi_comm)], mpi_comm);
+    }
+
+    solution_start.resize(n_clusters);
+    solution_end.resize(n_clusters);
+    solution_tmp.resize(n_clusters);
+    time_start.resize(n_clusters, 0.0);
+    time_step_cluster.resize(n_clusters, 0.0);
+
+    cluster_operators.resize(n_clusters);
+    cluster_time_integrators.resize(n_clusters);
+    for(unsigned int k = 0; k < n_clusters; ++k)
+    {
+      initialize_cluster_vector(solution_start[k], k);
+      initialize_cluster_vector(solution_end[k], k);
+      initialize_cluster_vector(solution_tmp[k], k);
+
+      cluster_operators[k]        = std::make_shared<ClusterOperator>(this, k);
+      cluster_time_integrators[k] = create_cluster_time_integrator(cluster_operators[k]);
+    }
+  }
+
+  void
+  solve_timestep(VectorType & dst,
+                 VectorType & src,
+                 double const time,
+                 double const time_step) final
+  {
+    // The linear approximation of neighbor states in time uses the last step of each cluster.
+    // This information is discarded if the present time step does not continue the previous one
+    // (first time step, restart), resulting in a constant approximation for the first step.
+    bool const reset_history =
+      not(std::abs(time - time_last_step) <= 1.e-12 * std::max(std::abs(time), time_step));
+
+    for(unsigned int k = 0; k < n_clusters; ++k)
+    {
+      for(unsigned int i = 0; i < cluster_dofs[k].size(); ++i)
+        solution_end[k].local_element(i) = src.local_element(cluster_dofs[k][i]);
+
+      if(reset_history)
+      {
+        solution_start[k]    = solution_end[k];
+        time_step_cluster[k] = get_time_step_size(k, time_step);
+        time_start[k]        = time - time_step_cluster[k];
+      }
+    }
+
+    advance(n_clusters - 1, time, time_step);
+
+    for(unsigned int k = 0; k < n_clusters; ++k)
+      for(unsigned int i = 0; i < cluster_dofs[k].size(); ++i)
+        dst.local_element(cluster_dofs[k][i]) = solution_end[k].local_element(i);
+
+    time_last_step = time + time_step;
+  }
+
+  /*
+   * The coupling of clusters via a linear approximation in time limits the order of accuracy.
+   */
+  unsigned int
+  get_order() const final
+  {
+    return std::min(cluster_time_integrators[0]->get_order(), 2u);
+  }
+
+  void
+  initialize_cluster_vector(VectorType & vector, unsigned int const cluster) const
+  {
+    vector.reinit(partitioners[cluster]);
+  }
+
+  void
+  evaluate_cluster(VectorType &       dst,
+                   VectorType const & src,
+                   double const       time,
+                   unsigned int const cluster)
+  {
+    // state of the cells of the active cluster
+    std::vector<unsigned int> const & dofs = cluster_dofs[cluster];
+    for(unsigned int i = 0; i < dofs.size(); ++i)
+      src_full.local_element(dofs[i]) = src.local_element(i);
+
+    // state of the neighbor cells of other clusters at the given time
+    for(unsigned int j = 0; j < n_clusters; ++j)
+    {
+      if(j == cluster)
+        continue;
+
+      Number const theta = (time - time_start[j]) / time_step_cluster[j];
+
+      for(unsigned int const i : neighbor_dofs[cluster][j])
+      {
+        src_full.local_element(cluster_dofs[j][i]) =
+          (1.0 - theta) * solution_start[j].local_element(i) +
+          theta * solution_end[j].local_element(i);
+      }
+    }
+
+    this->underlying_operator->evaluate_time_step_cluster(dst_full, src_full, time, cluster);
+
+    for(unsigned int i = 0; i < dofs.size(); ++i)
+      dst.local_element(i) = dst_full.local_element(dofs[i]);
+
+    // register entries: contributions of the faces of this cluster to coarser clusters
+    unsigned int position = dofs.size() + interface_dofs[cluster].size();
+    for(unsigned int j = cluster + 1; j < n_clusters; ++j)
+    {
+      for(unsigned int const i : neighbor_dofs[cluster][j])
+        dst.local_element(position++) = dst_full.local_element(cluster_dofs[j][i]);
+    }
+
+    // register entries: contributions of the faces shared with finer clusters, which are replaced
+    // by the contributions integrated by the finer clusters at the end of the time step
+    if(cluster > 0)
+    {
+      this->underlying_operator->evaluate_time_step_cluster_interface(dst_full,
+                                                                      src_full,
+                                                                      time,
+                                                                      cluster);
+
+      std::vector<unsigned int> const & dofs_interface = interface_dofs[cluster];
+      for(unsigned int i = 0; i < dofs_interface.size(); ++i)
+        dst.local_element(dofs.size() + i) = dst_full.local_element(dofs[dofs_interface[i]]);
+    }
+  }
+
+private:
+  double
+  get_time_step_size(unsigned int const cluster, double const time_step) const
+  {
+    return time_step / static_cast<double>(1u << (n_clusters - 1 - cluster));
+  }
+
+  /*
+   * Performs one time step of the given cluster starting at the given time, followed by the
+   * two time steps of the next finer cluster covering the same time interval.
+   */
+  void
+  advance(unsigned int const cluster, double const time, double const time_step)
+  {
+    unsigned int const n_dofs = cluster_dofs[cluster].size();
+
+    solution_start[cluster]    = solution_end[cluster];
+    time_start[cluster]        = time;
+    time_step_cluster[cluster] = get_time_step_size(cluster, time_step);
+
+    // some Runge-Kutta schemes overwrite the src vector; the register entries are integrated over
+    // the present time step starting from zero
+    solution_tmp[cluster] = solution_start[cluster];
+    for(unsigned int i = n_dofs; i < solution_tmp[cluster].locally_owned_size(); ++i)
+      solution_tmp[cluster].local_element(i) = 0.0;
+
+    std::fill(flux_register[cluster].begin(), flux_register[cluster].end(), Number(0.0));
+
+    cluster_time_integrators[cluster]->solve_timestep(solution_end[cluster],
+                                                      solution_tmp[cluster],
+                                                      time,
+                                                      time_step_cluster[cluster]);
+
+    // pass the register entries on to the coarser clusters, the present time steps of which
+    // contain the time step of this cluster
+    unsigned int position = n_dofs + interface_dofs[cluster].size();
+    for(unsigned int j = cluster + 1; j < n_clusters; ++j)
+    {
+      for(unsigned int const i : register_position[cluster][j])
+        flux_register[j][i] += solution_end[cluster].local_element(position++);
+    }
+
+    if(cluster > 0)
+    {
+      advance(cluster - 1, time, time_step);
+      advance(cluster - 1, time + get_time_step_size(cluster - 1, time_step), time_step);
+
+      reflux(cluster);
+    }
+  }
+
+  /*
+   * Replaces the contributions of the faces shared with finer clusters, as integrated by the given
+   * cluster during its last time step, by the contributions integrated by the finer clusters.
+   */
+  void
+  reflux(unsigned int const cluster)
+  {
+    std::vector<unsigned int> const & dofs      = cluster_dofs[cluster];
+    std::vector<unsigned int> const & dofs_interface = interface_dofs[cluster];
+
+    for(unsigned int const i : dofs)
+      dst_full.local_element(i) = 0.0;
+    for(unsigned int i = 0; i < dofs_interface.size(); ++i)
+      dst_full.local_element(dofs[dofs_interface[i]]) =
+        flux_register[cluster][i] - solution_end[cluster].local_element(dofs.size() + i);
+
+    // the correction is local to the cells adjacent to finer clusters
+    this->underlying_operator->apply_inverse_mass_time_step_cluster(dst_full, dst_full, cluster);
+
+    for(unsigned int const i : dofs_interface)
+      solution_end[cluster].local_element(i) += dst_full.local_element(dofs[i]);
+  }
+
+  unsigned int const n_clusters;
+
+  // locally owned dofs (local indices of the full vector) of the cells of each cluster
+  std::vector<std::vector<unsigned int>> cluster_dofs;
+
+  // neighbor_dofs[k][j]: dofs of cells of cluster j neighboring cells of cluster k, stored as
+  // positions within the vectors of cluster j
+  std::vector<std::vector<std::vector<unsigned int>>> neighbor_dofs;
+
+  // interface_dofs[j]: dofs of cells of cluster j neighboring cells of finer clusters, stored as
+  // positions within the vectors of cluster j
+  std::vector<std::vector<unsigned int>> interface_dofs;
+
+  // register_position[k][j]: positions of neighbor_dofs[k][j] within interface_dofs[j] for j > k
+  std::vector<std::vector<std::vector<unsigned int>>> register_position;
+
+  // number of register entries appended to the vectors of each cluster
+  std::vector<unsigned int> n_register_entries;
+
+  // flux_register[j]: contributions of the faces shared with finer clusters to the right-hand side
+  // for interface_dofs[j], integrated by the finer clusters over the present time step of cluster j
+  std::vector<std::vector<Number>> flux_register;
+
+  std::vector<std::shared_ptr<dealii::Utilities::MPI::Partitioner const>> partitioners;
+
+  // state of each cluster at the beginning and at the end of its last time step
+  std::vector<VectorType> solution_start, solution_end, solution_tmp;
+  std::vector<double>     time_start, time_step_cluster;
+
+  double time_last_step;
+
+  // vectors of the full problem used for the operator evaluation of a single cluster
+  VectorType src_full, dst_full;
+
+  std::vector<std::shared_ptr<ClusterOperator>>       cluster_operators;
+  std::vector<std::shared_ptr<ClusterTimeIntegrator>> cluster_time_integrators;
+};
+
+} // namespace ExaDG
+
+#endif /* EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_ */
@@ -27,14 +27,26 @@
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include <boost/crc.hpp>
+#include <boost/serialization/array_wrapper.hpp>
+#include <cstdint>
 #include <fstream>
 #include <sstream>
+#include <streambuf>
+#include <utility>
+#include <vector>
 
 // deal.II
 #include <deal.II/base/mpi.h>
+#include <deal.II/distributed/solution_transfer.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/time_integration/restart_data.h>
+
 namespace ExaDG
 {
 inline std::string
@@ -48,6 +60,29 @@ restart_filename(std::string const & name, MPI_Comm const & mpi_comm)
   return filename;
 }
 
+/**
+ * Returns the name of the restart file. Except for RestartFormat::PerRankArchive, a single file is
+ * shared by all MPI ranks.
+ */
+inline std::string
+restart_filename(RestartData const & restart_data, MPI_Comm const & mpi_comm)
+{
+  if(restart_data.format == RestartFormat::PerRankArchive)
+    return restart_filename(restart_data.filename, mpi_comm);
+  else
+    return restart_data.filename + ".restart";
+}
+
+/**
+ * Returns the name of the serialized triangulation (including the attached solution vectors) in
+ * case of RestartFormat::PartitionIndependent.
+ */
+inline std::string
+restart_filename_triangulation(std::string const & name)
+{
+  return name + ".triangulation";
+}
+
 inline void
 rename_restart_files(std::string const & filename)
 {
@@ -64,14 +99,282 @@ rename_restart_files(std::string const & filename)
   }
 }
 
+/**
+ * Renames the files written by dealii::parallel::distributed::Triangulation::save(). This function
+ * is called by a single MPI rank only.
+ */
 inline void
-write_restart_file(std::ostringstream & oss, std::string const & filename)
+rename_restart_files_triangulation(std::string const & name)
+{
+  std::string const filename = restart_filename_triangulation(name);
+
+  for(std::string const suffix : {"", ".info", "_fixed.data", "_variable.data"})
+    rename_restart_files(filename + suffix);
+}
+
+/*
+ * Layout of a restart file of type RestartFormat::SharedFile: a header consisting of an identifier,
+ * the number of MPI ranks, and a table with offset, size, and checksum of the data of each rank,
+ * followed by the data of all ranks.
+ */
+std::uint64_t constexpr restart_file_shared_identifier = 0x4558414447525354; // "EXADGRST"
+
+inline MPI_Offset
+restart_file_shared_header_size(unsigned int const n_ranks)
+{
+  return (2 + 3 * static_cast<MPI_Offset>(n_ranks)) * sizeof(std::uint64_t);
+}
+
+// size of chunks in bytes for MPI-IO (limited by the int-valued count argument of MPI)
+std::uint64_t constexpr restart_file_shared_chunk_size = 1ULL << 26;
+
+/**
+ * Output stream buffer collecting the data of a restart file of type RestartFormat::SharedFile
+ * without staging it in a contiguous buffer. Small pieces of data written by a boost archive, e.g.
+ * the time or the time step sizes, are copied. Large blocks, in particular the arrays of locally
+ * owned entries written by read_write_distributed_vector(), are only referenced and later written
+ * to the file directly from the memory of the vectors. Hence, the serialized objects have to stay
+ * alive until write_restart_file_shared() has been called.
+ */
+class RestartFileSharedBuffer : public std::streambuf
+{
+public:
+  // blocks of at least this number of bytes are referenced instead of copied
+  static std::streamsize constexpr reference_size = 4096;
+
+  struct Segment
+  {
+    // points to external memory or is nullptr if the data is stored in 'copy'
+    char const * reference = nullptr;
+
+    std::vector<char> copy;
+
+    std::uint64_t size = 0;
+
+    char const *
+    data() const
+    {
+      return reference != nullptr ? reference : copy.data();
+    }
+  };
+
+  std::vector<Segment> const &
+  get_segments() const
+  {
+    return segments;
+  }
+
+  std::uint64_t
+  size() const
+  {
+    return total_size;
+  }
+
+protected:
+  std::streamsize
+  xsputn(char const * s, std::streamsize count) override
+  {
+    if(count >= reference_size)
+    {
+      Segment segment;
+      segment.reference = s;
+      segment.size      = count;
+      segments.push_back(std::move(segment));
+    }
+    else
+    {
+      copy(s, count);
+    }
+
+    total_size += count;
+
+    return count;
+  }
+
+  int_type
+  overflow(int_type c) override
+  {
+    if(not traits_type::eq_int_type(c, traits_type::eof()))
+    {
+      char const value = traits_type::to_char_type(c);
+      copy(&value, 1);
+      total_size += 1;
+    }
+
+    return traits_type::not_eof(c);
+  }
+
+private:
+  void
+  copy(char const * s, std::streamsize count)
+  {
+    if(segments.empty() or segments.back().reference != nullptr)
+      segments.emplace_back();
+
+    Segment & segment = segments.back();
+    segment.copy.insert(segment.copy.end(), s, s + count);
+    segment.size += count;
+  }
+
+  std::vector<Segment> segments;
+
+  std::uint64_t total_size = 0;
+};
+
+/**
+ * Writes the data collected by a RestartFileSharedBuffer on every MPI rank into a single file
+ * shared by all ranks using collective MPI-IO. The offset of the data of each rank is computed
+ * from the sizes on all ranks, and all segments are written directly from their memory, in chunks
+ * for large segments.
+ */
+inline void
+write_restart_file_shared(RestartFileSharedBuffer const & buffer,
+                          std::string const &             filename,
+                          MPI_Comm const &                mpi_comm)
+{
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  std::uint64_t const local_size = buffer.size();
+
+  std::uint64_t local_offset = 0;
+  MPI_Exscan(&local_size, &local_offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+  if(rank == 0)
+    local_offset = 0;
+
+  // split the segments into pieces that can be written with a single MPI call
+  std::vector<std::pair<char const *, int>> pieces;
+  boost::crc_32_type                        checksum;
+  for(auto const & segment : buffer.get_segments())
+  {
+    checksum.process_bytes(segment.data(), segment.size);
+
+    for(std::uint64_t begin = 0; begin < segment.size; begin += restart_file_shared_chunk_size)
+    {
+      pieces.emplace_back(
+        segment.data() + begin,
+        static_cast<int>(std::min(restart_file_shared_chunk_size, segment.size - begin)));
+    }
+  }
+
+  MPI_File  fh;
+  int const error = MPI_File_open(
+    mpi_comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
+  AssertThrow(error == MPI_SUCCESS, dealii::ExcMessage("Can not open file: " + filename));
+  MPI_File_set_size(fh, 0);
+
+  // data section, all ranks have to take part in the same number of collective calls
+  std::uint64_t const n_pieces_max =
+    dealii::Utilities::MPI::max(static_cast<std::uint64_t>(pieces.size()), mpi_comm);
+
+  MPI_Offset offset = restart_file_shared_header_size(n_ranks) + local_offset;
+  for(std::uint64_t i = 0; i < n_pieces_max; ++i)
+  {
+    char const * data  = i < pieces.size() ? pieces[i].first : nullptr;
+    int const    count = i < pieces.size() ? pieces[i].second : 0;
+
+    MPI_File_write_at_all(fh, offset, data, count, MPI_BYTE, MPI_STATUS_IGNORE);
+    offset += count;
+  }
+
+  // header
+  std::uint64_t const        local_entry[3] = {local_offset, local_size, checksum.checksum()};
+  std::vector<std::uint64_t> table(rank == 0 ? 3 * n_ranks : 0);
+  MPI_Gather(local_entry, 3, MPI_UINT64_T, table.data(), 3, MPI_UINT64_T, 0, mpi_comm);
+
+  if(rank == 0)
+  {
+    std::uint64_t const preamble[2] = {restart_file_shared_identifier, n_ranks};
+    MPI_File_write_at(fh, 0, preamble, 2, MPI_UINT64_T, MPI_STATUS_IGNORE);
+    MPI_File_write_at(fh,
+                      2 * sizeof(std::uint64_t),
+                      table.data(),
+                      static_cast<int>(table.size()),
+                      MPI_UINT64_T,
+                      MPI_STATUS_IGNORE);
+  }
+
+  MPI_File_close(&fh);
+}
+
+/**
+ * Reads the data of the current MPI rank from a file written by write_restart_file_shared() and
+ * verifies its checksum.
+ */
+inline std::vector<char>
+read_restart_file_shared(std::string const & filename, MPI_Comm const & mpi_comm)
 {
-  std::ofstream stream(filename.c_str());
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  MPI_File  fh;
+  int const error =
+    MPI_File_open(mpi_comm, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+  AssertThrow(error == MPI_SUCCESS, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  std::uint64_t preamble[2] = {0, 0};
+  MPI_File_read_at_all(fh, 0, preamble, 2, MPI_UINT64_T, MPI_STATUS_IGNORE);
+
+  AssertThrow(preamble[0] == restart_file_shared_identifier,
+              dealii::ExcMessage("File " + filename + " is not a restart file of type " +
+                                 "RestartFormat::SharedFile."));
+  AssertThrow(preamble[1] == n_ranks,
+              dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
+                                 " processes, "
+                                 "but restart was written on " +
+                                 dealii::Utilities::to_string(preamble[1]) + " processes."));
+
+  std::uint64_t local_entry[3] = {0, 0, 0};
+  MPI_File_read_at_all(fh,
+                       (2 + 3 * static_cast<MPI_Offset>(rank)) * sizeof(std::uint64_t),
+                       local_entry,
+                       3,
+                       MPI_UINT64_T,
+                       MPI_STATUS_IGNORE);
+
+  std::uint64_t const local_size = local_entry[1];
+  std::vector<char>   buffer(local_size);
+
+  std::uint64_t const n_chunks =
+    (local_size + restart_file_shared_chunk_size - 1) / restart_file_shared_chunk_size;
+  std::uint64_t const n_chunks_max = dealii::Utilities::MPI::max(n_chunks, mpi_comm);
+
+  MPI_Offset offset = restart_file_shared_header_size(n_ranks) + local_entry[0];
+  for(std::uint64_t chunk = 0; chunk < n_chunks_max; ++chunk)
+  {
+    std::uint64_t const begin = chunk * restart_file_shared_chunk_size;
+    int const           count =
+      begin < local_size ? std::min(restart_file_shared_chunk_size, local_size - begin) : 0;
+
+    MPI_File_read_at_all(
+      fh, offset, buffer.data() + (count > 0 ? begin : 0), count, MPI_BYTE, MPI_STATUS_IGNORE);
+    offset += count;
+  }
+
+  MPI_File_close(&fh);
+
+  boost::crc_32_type checksum;
+  checksum.process_bytes(buffer.data(), buffer.size());
+  AssertThrow(checksum.checksum() == local_entry[2],
+              dealii::ExcMessage("Checksum of restart data read from " + filename +
+                                 " does not match."));
 
-  stream << oss.str() << std::endl;
+  return buffer;
 }
 
+/**
+ * Stream buffer reading from a contiguous block of memory without copying it, used to feed data
+ * read via read_restart_file_shared() into a boost archive.
+ */
+class MemoryStreamBuffer : public std::streambuf
+{
+public:
+  MemoryStreamBuffer(std::vector<char> & buffer)
+  {
+    this->setg(buffer.data(), buffer.data(), buffer.data() + buffer.size());
+  }
+};
+
 template<typename VectorType>
 inline void
 print_vector_l2_norm(VectorType const & vector)
@@ -88,7 +391,8 @@ print_vector_l2_norm(VectorType const & vector)
 /**
  * Utility function to read or write the local entries of a
  * dealii::LinearAlgebra::distributed::(Block)Vector
- * from/to a boost archive per block and entry.
+ * from/to a boost archive per block. The locally owned entries of
+ * each block are (de-)serialized as one contiguous array.
  * Using the `&` operator, loading from or writing to the
  * archive is determined from the type.
  */
@@ -109,20 +413,15 @@ read_write_distributed_vector(VectorType & vector, BoostArchiveType & archive)
   if constexpr(std::is_same<std::remove_cv_t<VectorType>,
                             dealii::LinearAlgebra::distributed::Vector<Number>>::value)
   {
-    for(unsigned int i = 0; i < vector.locally_owned_size(); ++i)
-    {
-      archive & vector.local_element(i);
-    }
+    archive & boost::serialization::make_array(vector.begin(), vector.locally_owned_size());
   }
   else if constexpr(std::is_same<std::remove_cv_t<VectorType>,
                                  dealii::LinearAlgebra::distributed::BlockVector<Number>>::value)
   {
     for(unsigned int i = 0; i < vector.n_blocks(); ++i)
     {
-      for(unsigned int j = 0; j < vector.block(i).locally_owned_size(); ++j)
-      {
-        archive & vector.block(i).local_element(j);
-      }
+      archive & boost::serialization::make_array(vector.block(i).begin(),
+                                                 vector.block(i).locally_owned_size());
     }
   }
   else
@@ -138,6 +437,86 @@ read_write_distributed_vector(VectorType & vector, BoostArchiveType & archive)
   }
 }
 
+/**
+ * Utility function to attach vectors to the triangulation via dealii::SolutionTransfer and to
+ * serialize the triangulation together with the attached data. The vectors are grouped according
+ * to the DoFHandler they belong to, and all DoFHandlers have to share the same triangulation. In
+ * contrast to read_write_distributed_vector(), the data written this way can be read on an
+ * arbitrary number of MPI ranks, see deserialize_vectors().
+ */
+template<int dim, typename VectorType>
+inline void
+serialize_triangulation_and_vectors(
+  std::string const &                                  filename,
+  std::vector<dealii::DoFHandler<dim> const *> const & dof_handlers,
+  std::vector<std::vector<VectorType const *>> const & vectors_per_dof_handler)
+{
+  AssertThrow(dof_handlers.size() > 0 and dof_handlers.size() == vectors_per_dof_handler.size(),
+              dealii::ExcMessage("Number of DoFHandlers and vector groups have to match."));
+
+  dealii::Triangulation<dim> const & triangulation = dof_handlers[0]->get_triangulation();
+  for(auto const & dof_handler : dof_handlers)
+  {
+    AssertThrow(&dof_handler->get_triangulation() == &triangulation,
+                dealii::ExcMessage("All DoFHandlers have to share the same triangulation."));
+  }
+
+  auto const tria =
+    dynamic_cast<dealii::parallel::distributed::Triangulation<dim> const *>(&triangulation);
+  AssertThrow(tria != nullptr,
+              dealii::ExcMessage("RestartFormat::PartitionIndependent is only implemented for "
+                                 "TriangulationType::Distributed."));
+
+  // The SolutionTransfer objects have to live until the triangulation has been saved.
+  std::vector<std::shared_ptr<dealii::SolutionTransfer<dim, VectorType>>> solution_transfers;
+  for(unsigned int i = 0; i < dof_handlers.size(); ++i)
+  {
+    for(VectorType const * vector : vectors_per_dof_handler[i])
+    {
+      print_vector_l2_norm(*vector);
+      vector->update_ghost_values();
+    }
+
+    solution_transfers.push_back(
+      std::make_shared<dealii::SolutionTransfer<dim, VectorType>>(*dof_handlers[i]));
+    solution_transfers.back()->prepare_for_serialization(vectors_per_dof_handler[i]);
+  }
+
+  tria->save(restart_filename_triangulation(filename));
+
+  for(auto const & vectors : vectors_per_dof_handler)
+  {
+    for(VectorType const * vector : vectors)
+      vector->zero_out_ghost_values();
+  }
+}
+
+/**
+ * Counterpart of serialize_triangulation_and_vectors(): reads the vectors attached to a
+ * triangulation that has been loaded via dealii::parallel::distributed::Triangulation::load() (see
+ * GridData::serialized_triangulation_file). The sequence of DoFHandlers and vectors has to be
+ * identical to the one used for writing. The vectors have to be initialized already.
+ */
+template<int dim, typename VectorType>
+inline void
+deserialize_vectors(std::vector<dealii::DoFHandler<dim> const *> const & dof_handlers,
+                    std::vector<std::vector<VectorType *>> const &       vectors_per_dof_handler)
+{
+  AssertThrow(dof_handlers.size() == vectors_per_dof_handler.size(),
+              dealii::ExcMessage("Number of DoFHandlers and vector groups have to match."));
+
+  for(unsigned int i = 0; i < dof_handlers.size(); ++i)
+  {
+    dealii::SolutionTransfer<dim, VectorType> solution_transfer(*dof_handlers[i]);
+
+    std::vector<VectorType *> vectors = vectors_per_dof_handler[i];
+    solution_transfer.deserialize(vectors);
+
+    for(VectorType * vector : vectors)
+      print_vector_l2_norm(*vector);
+  }
+}
+
 } // namespace ExaDG
 
 #endif /* EXADG_TIME_INTEGRATION_RESTART_H_ */
@@ -29,6 +29,7 @@
 #include <deal.II/base/conditional_ostream.h>
 
 // ExaDG
+#include <exadg/time_integration/enum_types.h>
 #include <exadg/utilities/numbers.h>
 #include <exadg/utilities/print_functions.h>
 
@@ -42,6 +43,8 @@ struct RestartData
       interval_wall_time(std::numeric_limits<double>::max()),
       interval_time_steps(std::numeric_limits<unsigned int>::max()),
       filename("restart"),
+      format(RestartFormat::PerRankArchive),
+      asynchronous(false),
       counter(1)
   {
   }
@@ -58,6 +61,8 @@ struct RestartData
       print_parameter(pcout, "Interval wall time", interval_wall_time);
       print_parameter(pcout, "Interval time steps", interval_time_steps);
       print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Format", format);
+      print_parameter(pcout, "Asynchronous", asynchronous);
     }
   }
 
@@ -97,6 +102,14 @@ struct RestartData
   // filename for restart files
   std::string filename;
 
+  // format of restart files, see enum RestartFormat
+  RestartFormat format;
+
+  // If true, the restart data is serialized into memory and written to file by a background thread
+  // while the time loop continues. A new restart waits for the previous one to be completed. This
+  // option is currently only available for RestartFormat::PerRankArchive.
+  bool asynchronous;
+
   // counter needed do decide when to write restart
   mutable unsigned int counter;
 };
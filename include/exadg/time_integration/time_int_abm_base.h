@@ -223,6 +223,9 @@ private:
   void
   read_restart_vectors(BoostInputArchiveType & ia) final
   {
+    AssertThrow(this->restart_data.format != RestartFormat::PartitionIndependent,
+                dealii::ExcMessage("RestartFormat::PartitionIndependent not implemented."));
+
     read_write_distributed_vector(solution, ia);
     read_write_distributed_vector(prediction, ia);
 
@@ -235,6 +238,9 @@ private:
   void
   write_restart_vectors(BoostOutputArchiveType & oa) const final
   {
+    AssertThrow(this->restart_data.format != RestartFormat::PartitionIndependent,
+                dealii::ExcMessage("RestartFormat::PartitionIndependent not implemented."));
+
     read_write_distributed_vector(solution, oa);
     read_write_distributed_vector(prediction, oa);
 
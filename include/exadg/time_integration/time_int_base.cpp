@@ -42,6 +42,17 @@ TimeIntBase::TimeIntBase(double const &      start_time_,
     timer_tree(new TimerTree()),
     is_test(is_test_)
 {
+  AssertThrow(not restart_data.asynchronous or
+                restart_data.format == RestartFormat::PerRankArchive,
+              dealii::ExcMessage("Asynchronous restart is only implemented for "
+                                 "RestartFormat::PerRankArchive."));
+}
+
+TimeIntBase::~TimeIntBase()
+{
+  // Do not throw in destructor, errors of the background task are ignored at this point.
+  if(restart_writer.valid())
+    restart_writer.wait();
 }
 
 bool
@@ -63,6 +74,8 @@ TimeIntBase::timeloop()
   {
     advance_one_timestep();
   }
+
+  wait_for_restart_writer();
 }
 
 void
@@ -209,16 +222,101 @@ TimeIntBase::write_restart() const
           << std::endl
           << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
 
-    std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+    std::string const filename = restart_filename(restart_data, mpi_comm);
+
+    if(restart_data.format == RestartFormat::PerRankArchive)
+    {
+      if(restart_data.asynchronous)
+      {
+        // back-pressure: the previous restart has to be completed before taking a new snapshot
+        wait_for_restart_writer();
+
+        // The snapshot of the restart data is taken synchronously, only writing to file is done in
+        // the background.
+        std::stringstream stream;
+        do_write_restart(stream);
 
-    rename_restart_files(filename);
+        restart_writer =
+          std::async(std::launch::async, [filename, stream = std::move(stream)]() mutable {
+            rename_restart_files(filename);
 
-    do_write_restart(restart_filename(restart_data.filename, mpi_comm));
+            std::ofstream out(filename, std::ios::binary);
+            AssertThrow(out, dealii::ExcMessage("Can not open file " + filename + "."));
+
+            out << stream.rdbuf();
+          });
+
+        pcout << std::endl << " Restart files are written in the background." << std::endl;
+      }
+      else
+      {
+        rename_restart_files(filename);
+
+        std::ofstream out(filename, std::ios::binary);
+        AssertThrow(out, dealii::ExcMessage("Can not open file " + filename + "."));
+
+        do_write_restart(out);
+      }
+    }
+    else
+    {
+      // all MPI ranks share the same files
+      bool const is_root = dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0;
+      if(is_root)
+      {
+        rename_restart_files(filename);
+
+        if(restart_data.format == RestartFormat::PartitionIndependent)
+          rename_restart_files_triangulation(restart_data.filename);
+      }
+
+      // make sure that files have been renamed before any rank starts writing
+      MPI_Barrier(mpi_comm);
+
+      if(restart_data.format == RestartFormat::SharedFile)
+      {
+        // the vectors are written directly from their memory, see RestartFileSharedBuffer
+        RestartFileSharedBuffer buffer;
+        {
+          std::ostream stream(&buffer);
+          do_write_restart(stream);
+        }
+
+        write_restart_file_shared(buffer, filename, mpi_comm);
+      }
+      else if(restart_data.format == RestartFormat::PartitionIndependent)
+      {
+        std::stringstream stream;
+        do_write_restart(stream);
+
+        // The vectors have been serialized together with the triangulation, and the remaining
+        // data is identical on all ranks.
+        if(is_root)
+        {
+          std::ofstream out(filename, std::ios::binary);
+          AssertThrow(out, dealii::ExcMessage("Can not open file " + filename + "."));
+
+          out << stream.rdbuf();
+        }
+      }
+      else
+      {
+        AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      }
+    }
 
     pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
   }
 }
 
+void
+TimeIntBase::wait_for_restart_writer() const
+{
+  // get() re-throws exceptions that occurred in the background task
+  if(restart_writer.valid())
+    restart_writer.get();
+}
+
 void
 TimeIntBase::read_restart()
 {
@@ -227,11 +325,23 @@ TimeIntBase::read_restart()
         << std::endl
         << " Reading restart file:" << std::endl;
 
-  std::string   filename = restart_filename(restart_data.filename, mpi_comm);
-  std::ifstream in(filename);
-  AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+  std::string const filename = restart_filename(restart_data, mpi_comm);
+
+  if(restart_data.format == RestartFormat::SharedFile)
+  {
+    std::vector<char>  buffer = read_restart_file_shared(filename, mpi_comm);
+    MemoryStreamBuffer stream_buffer(buffer);
+    std::istream       in(&stream_buffer);
+
+    do_read_restart(in);
+  }
+  else
+  {
+    std::ifstream in(filename, std::ios::binary);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
 
-  do_read_restart(in);
+    do_read_restart(in);
+  }
 
   pcout << std::endl
         << " ... done!" << std::endl
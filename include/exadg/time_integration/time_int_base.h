@@ -29,6 +29,7 @@
 #include <boost/archive/text_oarchive.hpp>
 
 #include <fstream>
+#include <future>
 #include <sstream>
 
 // deal.II
@@ -60,9 +61,7 @@ public:
               MPI_Comm const &    mpi_comm_,
               bool const          is_test_);
 
-  virtual ~TimeIntBase()
-  {
-  }
+  virtual ~TimeIntBase();
 
   /*
    * Setup of time integration scheme.
@@ -274,17 +273,28 @@ protected:
   bool                       is_test;
 
 private:
+  /*
+   * Waits until the restart files currently written in the background (if any) are completed.
+   */
+  void
+  wait_for_restart_writer() const;
+
+  /*
+   * Handle of the background task writing restart files in case of asynchronous restart.
+   */
+  mutable std::future<void> restart_writer;
+
   /*
    * Write restart data.
    */
   virtual void
-  do_write_restart(std::string const & filename) const = 0;
+  do_write_restart(std::ostream & out) const = 0;
 
   /*
    * Read restart data.
    */
   virtual void
-  do_read_restart(std::ifstream & in) = 0;
+  do_read_restart(std::istream & in) = 0;
 };
 
 } // namespace ExaDG
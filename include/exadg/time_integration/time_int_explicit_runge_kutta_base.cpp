@@ -130,11 +130,12 @@ TimeIntExplRKBase<Number>::prepare_vectors_for_next_timestep()
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
+TimeIntExplRKBase<Number>::do_write_restart(std::ostream & out) const
 {
-  std::ostringstream oss;
+  AssertThrow(this->restart_data.format != RestartFormat::PartitionIndependent,
+              dealii::ExcMessage("RestartFormat::PartitionIndependent not implemented."));
 
-  BoostOutputArchiveType oa(oss);
+  BoostOutputArchiveType oa(out);
 
   unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
 
@@ -149,14 +150,15 @@ TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
 
   // 4. solution vectors
   read_write_distributed_vector(solution_n, oa);
-
-  write_restart_file(oss, filename);
 }
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_read_restart(std::ifstream & in)
+TimeIntExplRKBase<Number>::do_read_restart(std::istream & in)
 {
+  AssertThrow(this->restart_data.format != RestartFormat::PartitionIndependent,
+              dealii::ExcMessage("RestartFormat::PartitionIndependent not implemented."));
+
   BoostInputArchiveType ia(in);
 
   // Note that the operations done here must be in sync with the output.
@@ -95,10 +95,10 @@ private:
   print_solver_info() const = 0;
 
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::ostream & out) const final;
 
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::istream & in) final;
 };
 
 } // namespace ExaDG
@@ -240,7 +240,7 @@ TimeIntMultistepBase::do_timestep_post_solve()
 
 
 void
-TimeIntMultistepBase::do_read_restart(std::ifstream & in)
+TimeIntMultistepBase::do_read_restart(std::istream & in)
 {
   BoostInputArchiveType ia(in);
   read_restart_preamble(ia);
@@ -263,7 +263,7 @@ TimeIntMultistepBase::read_restart_preamble(BoostInputArchiveType & ia)
   ia &         n_old_ranks;
 
   unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
+  AssertThrow(n_old_ranks == n_ranks or restart_data.format == RestartFormat::PartitionIndependent,
               dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
                                  " processes, "
                                  "but restart was written on " +
@@ -288,15 +288,12 @@ TimeIntMultistepBase::read_restart_preamble(BoostInputArchiveType & ia)
 }
 
 void
-TimeIntMultistepBase::do_write_restart(std::string const & filename) const
+TimeIntMultistepBase::do_write_restart(std::ostream & out) const
 {
-  std::ostringstream oss;
-
-  BoostOutputArchiveType oa(oss);
+  BoostOutputArchiveType oa(out);
 
   write_restart_preamble(oa);
   write_restart_vectors(oa);
-  write_restart_file(oss, filename);
 }
 
 void
@@ -213,7 +213,7 @@ private:
    * Restart: read solution vectors (has to be implemented in derived classes).
    */
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::istream & in) final;
 
   void
   read_restart_preamble(BoostInputArchiveType & ia);
@@ -226,7 +226,7 @@ private:
    * state.
    */
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::ostream & out) const final;
 
   void
   write_restart_preamble(BoostOutputArchiveType & oa) const;
@@ -0,0 +1,289 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/aero_acoustic/transfer_between_process_groups.h>
+
+// Check that TransferBetweenProcessGroups, which is used for the concurrent execution of the fluid
+// and the acoustic solver, gives the same result as the non-nested transfer used for the sequential
+// execution. The first half of the processes holds the source (fluid) mesh, the second half the
+// destination (acoustic) mesh. The reference runs on all processes. Since the DoFs are numbered
+// differently in both cases, the results are compared via partition-independent quantities. The
+// transfer is done twice to check that the data precomputed during the setup can be reused.
+
+namespace ExaDG
+{
+unsigned int const dim = 2;
+
+unsigned int const degree_source      = 2;
+unsigned int const degree_destination = 3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+class SourceFunction : public dealii::Function<dim>
+{
+public:
+  SourceFunction(double const scale) : dealii::Function<dim>(1), scale(scale)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const /* component */) const override
+  {
+    return scale * (1.0 + std::sin(3.0 * p[0]) * std::cos(2.0 * p[1]));
+  }
+
+private:
+  double const scale;
+};
+
+class WeightFunction : public dealii::Function<dim>
+{
+public:
+  WeightFunction() : dealii::Function<dim>(1)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const /* component */) const override
+  {
+    return 1.0 + p[0] * p[0] - 0.5 * p[1];
+  }
+};
+
+// fluid mesh: refined unit square with distorted interior cells
+void
+create_source_triangulation(dealii::Triangulation<dim> & triangulation)
+{
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(3);
+  dealii::GridTools::transform(
+    [](dealii::Point<dim> const & p) {
+      dealii::Point<dim> result = p;
+      for(unsigned int d = 0; d < dim; ++d)
+        result[d] += 0.05 * std::sin(dealii::numbers::PI * p[0]) *
+                     std::sin(dealii::numbers::PI * p[1]);
+      return result;
+    },
+    triangulation);
+}
+
+// acoustic mesh: unit square with cells not nested with the cells of the fluid mesh
+void
+create_destination_triangulation(dealii::Triangulation<dim> & triangulation)
+{
+  dealii::GridGenerator::subdivided_hyper_cube(triangulation, 5, 0.0, 1.0);
+  triangulation.refine_global(1);
+}
+
+void
+initialize_vector(VectorType & vector, dealii::DoFHandler<dim> const & dof_handler)
+{
+  vector.reinit(dof_handler.locally_owned_dofs(),
+                dealii::DoFTools::extract_locally_relevant_dofs(dof_handler),
+                dof_handler.get_communicator());
+}
+
+// l2 norm and weighted sum of the entries of a dual vector, both independent of the partitioning
+std::vector<double>
+compute_quantities(VectorType const &              vector,
+                   dealii::DoFHandler<dim> const & dof_handler,
+                   dealii::Mapping<dim> const &    mapping)
+{
+  VectorType weight;
+  initialize_vector(weight, dof_handler);
+  dealii::VectorTools::interpolate(mapping, dof_handler, WeightFunction(), weight);
+
+  return {vector.l2_norm(), vector * weight};
+}
+
+void
+test()
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  unsigned int const rank               = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_processes_source = dealii::Utilities::MPI::n_mpi_processes(mpi_comm) / 2;
+
+  AssertThrow(n_processes_source > 0, dealii::ExcMessage("This test requires two processes."));
+
+  dealii::MappingQ<dim> const mapping(1);
+
+  dealii::FE_Q<dim> const fe_source(degree_source);
+  dealii::FE_Q<dim> const fe_destination(degree_destination);
+
+  unsigned int const n_transfers = 2;
+
+  // reference: non-nested transfer on all processes as in the sequential execution
+  std::vector<std::vector<double>> reference(n_transfers);
+  {
+    dealii::parallel::distributed::Triangulation<dim> triangulation_source(mpi_comm);
+    dealii::parallel::distributed::Triangulation<dim> triangulation_destination(mpi_comm);
+    create_source_triangulation(triangulation_source);
+    create_destination_triangulation(triangulation_destination);
+
+    dealii::DoFHandler<dim> dof_handler_source(triangulation_source);
+    dealii::DoFHandler<dim> dof_handler_destination(triangulation_destination);
+    dof_handler_source.distribute_dofs(fe_source);
+    dof_handler_destination.distribute_dofs(fe_destination);
+
+    dealii::MGTwoLevelTransferNonNested<dim, VectorType> transfer;
+    transfer.reinit(dof_handler_source, dof_handler_destination, mapping, mapping);
+
+    VectorType src, dst;
+    initialize_vector(src, dof_handler_source);
+    initialize_vector(dst, dof_handler_destination);
+
+    for(unsigned int t = 0; t < n_transfers; ++t)
+    {
+      dealii::VectorTools::interpolate(mapping, dof_handler_source, SourceFunction(t + 1.0), src);
+
+      dst = 0.0;
+      transfer.restrict_and_add(dst, src);
+
+      reference[t] = compute_quantities(dst, dof_handler_destination, mapping);
+    }
+  }
+
+  // transfer between disjoint groups of processes as in the concurrent execution
+  std::vector<std::vector<double>> result(n_transfers);
+  {
+    bool const is_source = rank < n_processes_source;
+
+    MPI_Comm sub_comm;
+    MPI_Comm_split(mpi_comm, is_source ? 0 : 1, rank, &sub_comm);
+
+    {
+      dealii::parallel::distributed::Triangulation<dim> triangulation(sub_comm);
+      if(is_source)
+        create_source_triangulation(triangulation);
+      else
+        create_destination_triangulation(triangulation);
+
+      dealii::DoFHandler<dim> dof_handler(triangulation);
+      if(is_source)
+        dof_handler.distribute_dofs(fe_source);
+      else
+        dof_handler.distribute_dofs(fe_destination);
+
+      AeroAcoustic::TransferBetweenProcessGroups<dim, double> transfer;
+      if(is_source)
+        transfer.reinit_source(mpi_comm, n_processes_source, dof_handler, mapping);
+      else
+        transfer.reinit_destination(mpi_comm, n_processes_source, dof_handler, mapping);
+
+      VectorType vector;
+      initialize_vector(vector, dof_handler);
+
+      for(unsigned int t = 0; t < n_transfers; ++t)
+      {
+        if(is_source)
+        {
+          dealii::VectorTools::interpolate(mapping, dof_handler, SourceFunction(t + 1.0), vector);
+          transfer.start_send(vector);
+          transfer.wait_for_send();
+        }
+        else
+        {
+          vector = 0.0;
+          transfer.receive_and_add(vector);
+
+          result[t] = compute_quantities(vector, dof_handler, mapping);
+        }
+
+        // the results are only known on the destination group
+        result[t] = dealii::Utilities::MPI::broadcast(mpi_comm, result[t], n_processes_source);
+      }
+    }
+
+    MPI_Comm_free(&sub_comm);
+  }
+
+  for(unsigned int t = 0; t < n_transfers; ++t)
+  {
+    bool match = true;
+    for(unsigned int i = 0; i < reference[t].size(); ++i)
+    {
+      if(std::abs(result[t][i] - reference[t][i]) > 1.e-10 * std::abs(reference[t][i]))
+        match = false;
+    }
+
+    if(rank == 0)
+      std::cout << "Transfer " << t + 1
+                << " matches sequential non-nested transfer: " << std::boolalpha << match
+                << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
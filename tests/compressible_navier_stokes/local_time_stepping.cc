@@ -0,0 +1,346 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/operator.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/local_time_stepping.h>
+
+// Check LocalTimeStepping for the compressible Navier-Stokes operator on a periodic, locally
+// refined mesh with hanging faces:
+// - with a single time step cluster, the result has to be identical to the global Runge-Kutta
+//   scheme up to round-off,
+// - with several time step clusters, mass, momentum and energy are conserved due to the flux
+//   registers at the interfaces between clusters.
+
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef CompNS::Operator<dim, double>                       Operator;
+typedef TimeStepClusterOperator<Operator, VectorType>       ClusterOperator;
+typedef ExplicitTimeIntegrator<Operator, VectorType>        TimeIntegrator;
+typedef ExplicitTimeIntegrator<ClusterOperator, VectorType> ClusterTimeIntegrator;
+
+// time step size of the coarsest cluster
+double const       time_step    = 1.0e-3;
+unsigned int const n_time_steps = 5;
+
+double const kappa                = 1.4;
+double const gas_constant         = 1.0;
+double const dynamic_viscosity    = 1.0e-3;
+double const thermal_conductivity = 1.0e-3;
+
+/*
+ * Conserved variables (rho, rho u, rho E) of a smooth, periodic state given in primitive
+ * variables.
+ */
+class InitialSolution : public dealii::Function<dim>
+{
+public:
+  InitialSolution() : dealii::Function<dim>(dim + 2)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const override
+  {
+    double const pi = dealii::numbers::PI;
+
+    double const rho      = 1.0 + 0.2 * std::sin(2.0 * pi * p[0]) * std::sin(2.0 * pi * p[1]);
+    double const u_x      = 0.3 + 0.1 * std::cos(2.0 * pi * p[1]);
+    double const u_y      = -0.2 + 0.1 * std::sin(2.0 * pi * p[0]);
+    double const pressure = 1.0 + 0.1 * std::cos(2.0 * pi * (p[0] + p[1]));
+
+    if(component == 0)
+      return rho;
+    else if(component == 1)
+      return rho * u_x;
+    else if(component == 2)
+      return rho * u_y;
+    else
+      return pressure / (kappa - 1.0) + 0.5 * rho * (u_x * u_x + u_y * u_y);
+  }
+};
+
+/*
+ * Periodic unit square refined twice towards the center line x = 0.5, resulting in three cell
+ * sizes and three time step clusters.
+ */
+std::shared_ptr<Grid<dim>>
+create_grid(MPI_Comm const mpi_comm)
+{
+  auto grid = std::make_shared<Grid<dim>>();
+
+  auto triangulation = std::make_shared<dealii::parallel::distributed::Triangulation<dim>>(
+    mpi_comm);
+  dealii::GridGenerator::hyper_cube(*triangulation, 0.0, 1.0, true);
+
+  dealii::GridTools::collect_periodic_faces(*triangulation, 0, 1, 0, grid->periodic_face_pairs);
+  dealii::GridTools::collect_periodic_faces(*triangulation, 2, 3, 1, grid->periodic_face_pairs);
+  triangulation->add_periodicity(grid->periodic_face_pairs);
+
+  triangulation->refine_global(3);
+
+  for(double const width : {0.25, 0.125})
+  {
+    for(auto const & cell : triangulation->active_cell_iterators())
+    {
+      if(cell->is_locally_owned() and std::abs(cell->center()[0] - 0.5) < width)
+        cell->set_refine_flag();
+    }
+    triangulation->execute_coarsening_and_refinement();
+  }
+
+  grid->triangulation = triangulation;
+
+  return grid;
+}
+
+CompNS::Parameters
+create_parameters(unsigned int const max_number_of_time_step_clusters)
+{
+  CompNS::Parameters param;
+  param.equation_type                    = CompNS::EquationType::NavierStokes;
+  param.right_hand_side                  = false;
+  param.start_time                       = 0.0;
+  param.end_time                         = n_time_steps * time_step;
+  param.dynamic_viscosity                = dynamic_viscosity;
+  param.reference_density                = 1.0;
+  param.heat_capacity_ratio              = kappa;
+  param.thermal_conductivity             = thermal_conductivity;
+  param.specific_gas_constant            = gas_constant;
+  param.temporal_discretization          = CompNS::TemporalDiscretization::ExplRK;
+  param.order_time_integrator            = 4;
+  param.calculation_of_time_step_size    = CompNS::TimeStepCalculation::CFLAndDiffusion;
+  param.max_velocity                     = 1.0;
+  param.cfl_number                       = 0.1;
+  param.diffusion_number                 = 0.01;
+  param.use_local_time_stepping          = true;
+  param.max_number_of_time_step_clusters = max_number_of_time_step_clusters;
+  param.mapping_degree                   = 1;
+  param.degree                           = degree;
+  param.n_q_points_convective            = CompNS::QuadratureRule::Standard;
+  param.n_q_points_viscous               = CompNS::QuadratureRule::Standard;
+  param.use_combined_operator            = true;
+  param.check();
+
+  return param;
+}
+
+// the operator stores a reference to the parameters
+std::shared_ptr<Operator>
+create_operator(std::shared_ptr<Grid<dim> const> grid,
+                CompNS::Parameters const &       param,
+                MPI_Comm const                   mpi_comm)
+{
+  auto field_functions              = std::make_shared<CompNS::FieldFunctions<dim>>();
+  field_functions->initial_solution = std::make_shared<InitialSolution>();
+  field_functions->right_hand_side_density =
+    std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+  field_functions->right_hand_side_velocity =
+    std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+  field_functions->right_hand_side_energy =
+    std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+
+  // periodic boundaries only
+  auto boundary_descriptor = std::make_shared<CompNS::BoundaryDescriptor<dim>>();
+
+  // the output of the operator setup is not part of this test
+  std::ostringstream     setup_log;
+  std::streambuf * const cout_buffer = std::cout.rdbuf(setup_log.rdbuf());
+
+  auto pde_operator = std::make_shared<Operator>(grid,
+                                                 std::make_shared<dealii::MappingQ<dim>>(1),
+                                                 boundary_descriptor,
+                                                 field_functions,
+                                                 param,
+                                                 "fluid",
+                                                 mpi_comm);
+  pde_operator->setup();
+
+  std::cout.rdbuf(cout_buffer);
+
+  return pde_operator;
+}
+
+std::shared_ptr<ClusterTimeIntegrator>
+create_cluster_time_integrator(std::shared_ptr<ClusterOperator> cluster_operator)
+{
+  return std::make_shared<ExplicitRungeKuttaTimeIntegrator<ClusterOperator, VectorType>>(
+    4, cluster_operator);
+}
+
+VectorType
+solve(TimeIntegrator & time_integrator, Operator const & pde_operator)
+{
+  VectorType solution, solution_np;
+  pde_operator.initialize_dof_vector(solution);
+  pde_operator.initialize_dof_vector(solution_np);
+  pde_operator.prescribe_initial_conditions(solution, 0.0);
+
+  double time = 0.0;
+  for(unsigned int n = 0; n < n_time_steps; ++n)
+  {
+    time_integrator.solve_timestep(solution_np, solution, time, time_step);
+    solution.swap(solution_np);
+    time += time_step;
+  }
+
+  return solution;
+}
+
+// integrals of the conserved variables (rho, rho u, rho E) over the unit square
+std::vector<double>
+integrate(VectorType const & solution, Operator const & pde_operator)
+{
+  std::vector<double> integrals(dim + 2);
+  for(unsigned int c = 0; c < dim + 2; ++c)
+    integrals[c] = dealii::VectorTools::compute_mean_value(pde_operator.get_mapping(),
+                                                           pde_operator.get_dof_handler(),
+                                                           dealii::QGauss<dim>(degree + 1),
+                                                           solution,
+                                                           c);
+
+  return integrals;
+}
+
+void
+test_single_cluster(dealii::ConditionalOStream & pcout, MPI_Comm const mpi_comm)
+{
+  std::shared_ptr<Grid<dim>> grid         = create_grid(mpi_comm);
+  CompNS::Parameters const   param        = create_parameters(1);
+  std::shared_ptr<Operator>  pde_operator = create_operator(grid, param, mpi_comm);
+
+  ExplicitRungeKuttaTimeIntegrator<Operator, VectorType> global_time_integrator(4, pde_operator);
+  LocalTimeStepping<Operator, VectorType> local_time_integrator(pde_operator,
+                                                                create_cluster_time_integrator);
+
+  VectorType const solution_global = solve(global_time_integrator, *pde_operator);
+  VectorType       solution_local  = solve(local_time_integrator, *pde_operator);
+
+  // the vector updates of the Runge-Kutta scheme act on differently sized vectors and may
+  // therefore be vectorized differently
+  solution_local -= solution_global;
+
+  pcout << "Number of time step clusters: " << pde_operator->get_number_of_time_step_clusters()
+        << std::endl;
+  pcout << "Single time step cluster reproduces global Runge-Kutta: " << std::boolalpha
+        << (solution_local.linfty_norm() <= 1.e-14 * solution_global.linfty_norm()) << std::endl;
+}
+
+void
+test_multiple_clusters(dealii::ConditionalOStream & pcout, MPI_Comm const mpi_comm)
+{
+  std::shared_ptr<Grid<dim>> grid         = create_grid(mpi_comm);
+  CompNS::Parameters const   param        = create_parameters(4);
+  std::shared_ptr<Operator>  pde_operator = create_operator(grid, param, mpi_comm);
+
+  pcout << "Number of time step clusters: " << pde_operator->get_number_of_time_step_clusters()
+        << std::endl;
+
+  VectorType initial_solution;
+  pde_operator->initialize_dof_vector(initial_solution);
+  pde_operator->prescribe_initial_conditions(initial_solution, 0.0);
+
+  LocalTimeStepping<Operator, VectorType> local_time_integrator(pde_operator,
+                                                                create_cluster_time_integrator);
+
+  VectorType const solution = solve(local_time_integrator, *pde_operator);
+
+  std::vector<double> const integrals_initial = integrate(initial_solution, *pde_operator);
+  std::vector<double> const integrals_final   = integrate(solution, *pde_operator);
+
+  // all conserved variables are of order one
+  bool conservative = true;
+  for(unsigned int c = 0; c < dim + 2; ++c)
+  {
+    if(std::abs(integrals_final[c] - integrals_initial[c]) > 1.e-12)
+      conservative = false;
+  }
+
+  pcout << "Local time stepping conserves mass, momentum and energy: " << std::boolalpha
+        << conservative << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+    ExaDG::test_single_cluster(pcout, mpi_comm);
+    ExaDG::test_multiple_clusters(pcout, mpi_comm);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,231 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
+#include <exadg/operators/finite_element.h>
+
+// Check the split forms of the convective operator on a deformed, periodic mesh:
+// - free-stream preservation, i.e., a constant state results in a vanishing residual,
+// - conservation, i.e., the residual of a non-constant state integrates to zero for each
+//   conserved variable.
+
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 3;
+
+double const kappa = 1.4;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Conserved variables (rho, rho u, rho E) of a given state in primitive variables.
+ */
+class ConservedVariables : public dealii::Function<dim>
+{
+public:
+  ConservedVariables(bool const constant_state)
+    : dealii::Function<dim>(dim + 2), constant_state(constant_state)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const override
+  {
+    double const pi = dealii::numbers::PI;
+
+    double rho      = 1.2;
+    double u_x      = 0.3;
+    double u_y      = -0.4;
+    double pressure = 1.0;
+    if(not constant_state)
+    {
+      rho += 0.2 * std::sin(2.0 * pi * p[0]) * std::sin(2.0 * pi * p[1]);
+      u_x += 0.1 * std::cos(2.0 * pi * p[1]);
+      u_y += 0.2 * std::sin(2.0 * pi * p[0]);
+      pressure += 0.1 * std::cos(2.0 * pi * (p[0] + p[1]));
+    }
+
+    if(component == 0)
+      return rho;
+    else if(component == 1)
+      return rho * u_x;
+    else if(component == 2)
+      return rho * u_y;
+    else
+      return pressure / (kappa - 1.0) + 0.5 * rho * (u_x * u_x + u_y * u_y);
+  }
+
+private:
+  bool const constant_state;
+};
+
+void
+test(CompNS::ConvectiveTermFormulation const formulation, std::string const & name)
+{
+  // periodic unit square with distorted (non-affine) interior cells
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0, true);
+  triangulation.refine_global(2);
+  dealii::GridTools::transform(
+    [](dealii::Point<dim> const & p) {
+      dealii::Point<dim> result = p;
+      for(unsigned int d = 0; d < dim; ++d)
+        result[d] += 0.06 * std::sin(2.0 * dealii::numbers::PI * p[0]) *
+                     std::sin(2.0 * dealii::numbers::PI * p[1]) * (d == 0 ? 1.0 : -1.0);
+      return result;
+    },
+    triangulation);
+
+  std::vector<dealii::GridTools::PeriodicFacePair<
+    typename dealii::Triangulation<dim>::cell_iterator>>
+    periodic_faces;
+  dealii::GridTools::collect_periodic_faces(triangulation, 0, 1, 0, periodic_faces);
+  dealii::GridTools::collect_periodic_faces(triangulation, 2, 3, 1, periodic_faces);
+  triangulation.add_periodicity(periodic_faces);
+
+  dealii::MappingQ<dim> const mapping(1);
+
+  std::shared_ptr<dealii::FiniteElement<dim>> fe =
+    create_finite_element<dim>(ElementType::Hypercube, true, dim + 2, degree);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*fe);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  // the split forms are evaluated on the Gauss-Lobatto points
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = dealii::update_gradients | dealii::update_JxW_values |
+                                         dealii::update_quadrature_points | dealii::update_values;
+  additional_data.mapping_update_flags_inner_faces =
+    dealii::update_JxW_values | dealii::update_normal_vectors | dealii::update_quadrature_points |
+    dealii::update_values;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGaussLobatto<1>(degree + 1), additional_data);
+
+  CompNS::ConvectiveOperatorData<dim> data;
+  data.bc                    = std::make_shared<CompNS::BoundaryDescriptor<dim>>();
+  data.heat_capacity_ratio   = kappa;
+  data.specific_gas_constant = 287.0;
+  data.formulation           = formulation;
+
+  CompNS::ConvectiveOperator<dim, double> convective_operator;
+  convective_operator.initialize(matrix_free, data);
+
+  VectorType src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+
+  // free-stream preservation
+  dealii::VectorTools::interpolate(mapping, dof_handler, ConservedVariables(true), src);
+  convective_operator.evaluate(dst, src, 0.0);
+
+  std::cout << name << " preserves free stream on deformed mesh: " << std::boolalpha
+            << (dst.linfty_norm() < 1.e-10) << std::endl;
+
+  // conservation: the Lagrange basis is a partition of unity, such that the sum of the entries
+  // of one component is the integral of its residual
+  dealii::VectorTools::interpolate(mapping, dof_handler, ConservedVariables(false), src);
+  convective_operator.evaluate(dst, src, 0.0);
+
+  VectorType dst_absolute = dst;
+  for(unsigned int i = 0; i < dst_absolute.locally_owned_size(); ++i)
+    dst_absolute.local_element(i) = std::abs(dst_absolute.local_element(i));
+
+  bool conservative = true;
+  for(unsigned int c = 0; c < dim + 2; ++c)
+  {
+    VectorType indicator;
+    matrix_free.initialize_dof_vector(indicator);
+    dealii::VectorTools::interpolate(mapping,
+                                     dof_handler,
+                                     dealii::ComponentSelectFunction<dim>(c, 1.0, dim + 2),
+                                     indicator);
+
+    if(std::abs(dst * indicator) > 1.e-12 * (dst_absolute * indicator))
+      conservative = false;
+  }
+
+  std::cout << name << " conserves mass, momentum and energy: " << conservative << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(ExaDG::CompNS::ConvectiveTermFormulation::KineticEnergyPreserving,
+                "Kinetic energy preserving split form");
+    ExaDG::test(ExaDG::CompNS::ConvectiveTermFormulation::EntropyConserving,
+                "Entropy conserving split form");
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,229 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <tuple>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
+
+namespace ExaDG
+{
+unsigned int const dim = 2;
+
+typedef dealii::VectorizedArray<double>            scalar;
+typedef dealii::Tensor<1, dim, scalar>             vector;
+typedef std::tuple<scalar, vector, scalar>         Flux;
+typedef std::array<double, dim + 2>                State; // rho, u, p
+typedef std::function<Flux(State const &, State const &, vector const &)> TwoPointFlux;
+
+double const kappa = 1.4;
+
+vector
+get_velocity(State const & state)
+{
+  vector u;
+  for(unsigned int d = 0; d < dim; ++d)
+    u[d] = state[1 + d];
+  return u;
+}
+
+Flux
+get_kinetic_energy_preserving_flux(State const & i, State const & j, vector const & n)
+{
+  scalar const H_i = kappa / (kappa - 1.0) * i[dim + 1] / i[0] +
+                     0.5 * (get_velocity(i) * get_velocity(i));
+  scalar const H_j = kappa / (kappa - 1.0) * j[dim + 1] / j[0] +
+                     0.5 * (get_velocity(j) * get_velocity(j));
+
+  return CompNS::calculate_two_point_flux_kinetic_energy_preserving<dim, double>(
+    scalar(i[0]),
+    scalar(j[0]),
+    get_velocity(i),
+    get_velocity(j),
+    scalar(i[dim + 1]),
+    scalar(j[dim + 1]),
+    H_i,
+    H_j,
+    n);
+}
+
+Flux
+get_entropy_conserving_flux(State const & i, State const & j, vector const & n)
+{
+  return CompNS::calculate_two_point_flux_entropy_conserving<dim, double>(scalar(i[0]),
+                                                                          scalar(j[0]),
+                                                                          get_velocity(i),
+                                                                          get_velocity(j),
+                                                                          scalar(i[dim + 1]),
+                                                                          scalar(j[dim + 1]),
+                                                                          n,
+                                                                          kappa);
+}
+
+// physical flux F(u) * n
+Flux
+get_physical_flux(State const & state, vector const & n)
+{
+  double const rho = state[0];
+  vector const u   = get_velocity(state);
+  double const p   = state[dim + 1];
+  scalar const u_n = u * n;
+
+  scalar const rho_E = p / (kappa - 1.0) + 0.5 * rho * (u * u);
+
+  return std::make_tuple(rho * u_n, rho * u_n * u + p * n, (rho_E + p) * u_n);
+}
+
+double
+difference(Flux const & a, Flux const & b)
+{
+  double diff = std::abs(std::get<0>(a)[0] - std::get<0>(b)[0]);
+  for(unsigned int d = 0; d < dim; ++d)
+    diff = std::max(diff, std::abs(std::get<1>(a)[d][0] - std::get<1>(b)[d][0]));
+  diff = std::max(diff, std::abs(std::get<2>(a)[0] - std::get<2>(b)[0]));
+
+  return diff;
+}
+
+// entropy variables of the entropy -rho * s / (kappa - 1) with s = log(p / rho^kappa)
+std::array<double, dim + 2>
+get_entropy_variables(State const & state)
+{
+  double const rho = state[0];
+  vector const u   = get_velocity(state);
+  double const p   = state[dim + 1];
+  double const s   = std::log(p) - kappa * std::log(rho);
+
+  std::array<double, dim + 2> v;
+  v[0] = (kappa - s) / (kappa - 1.0) - 0.5 * rho * (u * u)[0] / p;
+  for(unsigned int d = 0; d < dim; ++d)
+    v[1 + d] = rho * u[d][0] / p;
+  v[dim + 1] = -rho / p;
+
+  return v;
+}
+
+void
+test_logarithmic_mean()
+{
+  double const a = 1.3, b = 2.9;
+
+  double const exact    = (b - a) / (std::log(b) - std::log(a));
+  double const computed = CompNS::calculate_logarithmic_mean(scalar(a), scalar(b))[0];
+
+  double const c           = 1.0 + 1.e-7;
+  double const computed_eq = CompNS::calculate_logarithmic_mean(scalar(1.0), scalar(c))[0];
+
+  std::cout << "Logarithmic mean correct: "
+            << (std::abs(computed - exact) < 1.e-12 ? "true" : "false") << std::endl;
+  std::cout << "Logarithmic mean of close values correct: "
+            << (std::abs(computed_eq - 0.5 * (1.0 + c)) < 1.e-12 ? "true" : "false") << std::endl;
+}
+
+void
+test_two_point_flux(std::string const & name, TwoPointFlux const & flux, bool const check_entropy)
+{
+  State const state_i = {{1.2, 0.3, -0.4, 0.9}};
+  State const state_j = {{0.8, -0.1, 0.5, 1.3}};
+
+  vector n;
+  n[0] = 0.6;
+  n[1] = 0.8;
+
+  // consistency
+  bool const consistent =
+    difference(flux(state_i, state_i, n), get_physical_flux(state_i, n)) < 1.e-12;
+  std::cout << name << " consistent: " << (consistent ? "true" : "false") << std::endl;
+
+  // symmetry
+  bool const symmetric = difference(flux(state_i, state_j, n), flux(state_j, state_i, n)) < 1.e-12;
+  std::cout << name << " symmetric: " << (symmetric ? "true" : "false") << std::endl;
+
+  // entropy conservation according to Tadmor: [v] * f = [rho u * n]
+  if(check_entropy)
+  {
+    std::array<double, dim + 2> const v_i = get_entropy_variables(state_i);
+    std::array<double, dim + 2> const v_j = get_entropy_variables(state_j);
+
+    Flux const f = flux(state_i, state_j, n);
+
+    double entropy_flux_jump = (v_j[0] - v_i[0]) * std::get<0>(f)[0];
+    for(unsigned int d = 0; d < dim; ++d)
+      entropy_flux_jump += (v_j[1 + d] - v_i[1 + d]) * std::get<1>(f)[d][0];
+    entropy_flux_jump += (v_j[dim + 1] - v_i[dim + 1]) * std::get<2>(f)[0];
+
+    double const potential_jump =
+      state_j[0] * (get_velocity(state_j) * n)[0] - state_i[0] * (get_velocity(state_i) * n)[0];
+
+    std::cout << name << " entropy conservative: "
+              << (std::abs(entropy_flux_jump - potential_jump) < 1.e-12 ? "true" : "false")
+              << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test_logarithmic_mean();
+    ExaDG::test_two_point_flux("Kinetic energy preserving flux",
+                               ExaDG::get_kinetic_energy_preserving_flux,
+                               false);
+    ExaDG::test_two_point_flux("Entropy conserving flux", ExaDG::get_entropy_conserving_flux, true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
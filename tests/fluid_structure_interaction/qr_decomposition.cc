@@ -0,0 +1,250 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/fluid_structure_interaction/acceleration_schemes/linear_algebra.h>
+
+// Insert columns into and remove columns from the incrementally updated QR decomposition at
+// arbitrary positions. After each modification, check that the columns of Q are orthonormal, that
+// A = Q R holds for the columns of A that remain in the decomposition, and that these columns are
+// the same as those kept by filtering the columns from scratch by modified Gram-Schmidt, which is
+// how the decomposition was computed before the incremental update.
+
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const M = 20;
+
+double const eps = 1.e-2;
+
+double const tol = 1.e-12;
+
+VectorType
+create_vector(unsigned int const seed)
+{
+  VectorType v(M);
+  for(unsigned int i = 0; i < M; ++i)
+    v[i] = std::sin(0.7 * (seed + 1) * (i + 1) + 0.3 * seed);
+  return v;
+}
+
+/*
+ * Returns the identifiers of the columns that are not linearly dependent on the columns in front of
+ * them, computed from scratch by modified Gram-Schmidt.
+ */
+std::vector<unsigned int>
+filter_columns_from_scratch(std::vector<VectorType> const &   A,
+                            std::vector<unsigned int> const & ids)
+{
+  std::vector<VectorType>   Q;
+  std::vector<unsigned int> ids_kept;
+  for(unsigned int const id : ids)
+  {
+    VectorType q = A[id];
+
+    double const norm_initial = q.l2_norm();
+    for(auto const & q_j : Q)
+      q.add(-(q_j * q), q_j);
+
+    double const norm = q.l2_norm();
+    if(norm >= eps * norm_initial)
+    {
+      q *= 1.0 / norm;
+      Q.push_back(q);
+      ids_kept.push_back(id);
+    }
+  }
+
+  return ids_kept;
+}
+
+class Checker
+{
+public:
+  Checker(std::vector<VectorType> const & A) : A(A), orthonormal(true), factorized(true)
+  {
+  }
+
+  void
+  check(FSI::QRDecomposition<VectorType, double> const & qr)
+  {
+    unsigned int const n = qr.n_columns();
+
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      for(unsigned int j = 0; j < n; ++j)
+      {
+        double const q_ij = qr.get_column_of_Q(i) * qr.get_column_of_Q(j);
+        if(std::abs(q_ij - (i == j ? 1.0 : 0.0)) > tol)
+          orthonormal = false;
+      }
+    }
+
+    for(unsigned int j = 0; j < n; ++j)
+    {
+      VectorType difference = A[qr.get_id(j)];
+      for(unsigned int i = 0; i < n; ++i)
+      {
+        if(i > j and std::abs(qr.get_entry_of_R(i, j)) > tol * A[qr.get_id(j)].l2_norm())
+          factorized = false;
+        difference.add(-qr.get_entry_of_R(i, j), qr.get_column_of_Q(i));
+      }
+
+      if(difference.l2_norm() > tol * A[qr.get_id(j)].l2_norm())
+        factorized = false;
+    }
+  }
+
+  std::vector<VectorType> const & A;
+
+  bool orthonormal;
+  bool factorized;
+};
+
+std::vector<unsigned int>
+get_ids(FSI::QRDecomposition<VectorType, double> const & qr)
+{
+  std::vector<unsigned int> ids;
+  for(unsigned int i = 0; i < qr.n_columns(); ++i)
+    ids.push_back(qr.get_id(i));
+  return ids;
+}
+
+void
+test()
+{
+  // columns of A, where the identifier of a column is its index
+  std::vector<VectorType> A;
+  for(unsigned int k = 0; k < 4; ++k)
+    A.push_back(create_vector(k));
+
+  // almost linearly dependent on columns 1 and 2
+  A.push_back(A[1]);
+  A.back().add(1.0, A[2], 1.e-4, create_vector(10));
+
+  // column 0 becomes almost linearly dependent on the columns in front of it when inserting this
+  // column at the front
+  A.push_back(A[0]);
+  A.back().add(-1.0, A[3], 1.e-4, create_vector(11));
+
+  for(unsigned int k = 6; k < 9; ++k)
+    A.push_back(create_vector(k));
+
+  FSI::QRDecomposition<VectorType, double> qr(eps);
+  Checker                                  checker(A);
+
+  // the columns in front of the inserted column are kept, the filtering from scratch of the
+  // resulting sequence of columns has to give the columns remaining in the decomposition
+  bool                      filtering_matches = true;
+  std::vector<unsigned int> ids_filtered_out;
+
+  auto const insert = [&](unsigned int const id, unsigned int const position) {
+    std::vector<unsigned int> ids = get_ids(qr);
+    ids.insert(ids.begin() + position, id);
+
+    if(not qr.insert_column(A[id], id, position))
+      ids_filtered_out.push_back(id);
+
+    if(get_ids(qr) != filter_columns_from_scratch(A, ids))
+      filtering_matches = false;
+
+    checker.check(qr);
+  };
+
+  auto const remove = [&](unsigned int const position) {
+    qr.remove_column(position);
+
+    checker.check(qr);
+  };
+
+  insert(0, 0);
+  insert(1, 1);
+  insert(2, 1);
+  insert(3, 0);
+  insert(4, 4);
+  insert(5, 0);
+  remove(1);
+  insert(6, 2);
+  insert(7, 0);
+  remove(qr.n_columns() - 1);
+  insert(8, 1);
+  remove(0);
+
+  std::cout << "Q^T Q = I: " << std::boolalpha << checker.orthonormal << std::endl;
+  std::cout << "A = Q R with upper triangular R: " << checker.factorized << std::endl;
+  std::cout << "Filtering matches filtering from scratch: " << filtering_matches << std::endl;
+  std::cout << "Linearly dependent inserted column filtered out: "
+            << (std::find(ids_filtered_out.begin(), ids_filtered_out.end(), 4) !=
+                ids_filtered_out.end())
+            << std::endl;
+
+  std::vector<unsigned int> const ids = get_ids(qr);
+  std::cout << "Column made linearly dependent by insertion in front removed: "
+            << (std::find(ids.begin(), ids.end(), 0) == ids.end()) << std::endl;
+  std::cout << "Number of columns: " << qr.n_columns() << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,211 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/operators/finite_element.h>
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+
+// Check that the application of the interior penalty (DG) and the continuous (CG) Laplace operator
+// to several vectors within a single loop, OperatorBase::vmult(std::vector<VectorType *>,
+// std::vector<VectorType const *>), gives the same result as applying the operator to each vector
+// separately. The mesh is locally refined so that hanging nodes are present in the CG case.
+
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 3;
+
+unsigned int const n_vectors = 3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef Poisson::LaplaceOperator<dim, double, 1> Operator;
+
+void
+create_triangulation(dealii::parallel::distributed::Triangulation<dim> & triangulation)
+{
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(3);
+
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned() and cell->center()[0] < 0.5 and cell->center()[1] < 0.5)
+      cell->set_refine_flag();
+  }
+  triangulation.execute_coarsening_and_refinement();
+}
+
+// fill the vector with values depending on the global index only, i.e., independently of the
+// partitioning
+void
+fill_vector(VectorType & vector, unsigned int const v)
+{
+  dealii::IndexSet const & owned = vector.locally_owned_elements();
+  for(unsigned int i = 0; i < owned.n_elements(); ++i)
+    vector.local_element(i) = std::sin(0.37 * owned.nth_index_in_set(i) + 1.3 * v);
+}
+
+void
+test(bool const is_dg)
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  create_triangulation(triangulation);
+
+  dealii::MappingQ<dim> const mapping(1);
+
+  std::shared_ptr<dealii::FiniteElement<dim>> fe =
+    create_finite_element<dim>(ElementType::Hypercube, is_dg, 1, degree);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*fe);
+
+  dealii::AffineConstraints<double> constraints;
+  if(not is_dg)
+  {
+    constraints.reinit(dof_handler.locally_owned_dofs(),
+                       dealii::DoFTools::extract_locally_relevant_dofs(dof_handler));
+    dealii::DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+    dealii::DoFTools::make_zero_boundary_constraints(dof_handler, 0, constraints);
+  }
+  constraints.close();
+
+  MappingFlags const flags =
+    Poisson::Operators::LaplaceKernel<dim, double, 1>::get_mapping_flags(true, true);
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags                = flags.cells;
+  additional_data.mapping_update_flags_inner_faces    = flags.inner_faces;
+  additional_data.mapping_update_flags_boundary_faces = flags.boundary_faces;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  auto bc = std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  bc->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  Poisson::LaplaceOperatorData<0, dim> data;
+  data.bc = bc;
+
+  Operator laplace_operator;
+  laplace_operator.initialize(matrix_free, constraints, data);
+
+  std::vector<VectorType> src(n_vectors), dst_single(n_vectors), dst_batched(n_vectors);
+  for(unsigned int v = 0; v < n_vectors; ++v)
+  {
+    laplace_operator.initialize_dof_vector(src[v]);
+    laplace_operator.initialize_dof_vector(dst_single[v]);
+    laplace_operator.initialize_dof_vector(dst_batched[v]);
+
+    fill_vector(src[v], v);
+  }
+
+  // apply the operator to each vector separately
+  for(unsigned int v = 0; v < n_vectors; ++v)
+    laplace_operator.vmult(dst_single[v], src[v]);
+
+  // apply the operator to all vectors at once
+  std::vector<VectorType *>       dst_pointers;
+  std::vector<VectorType const *> src_pointers;
+  for(unsigned int v = 0; v < n_vectors; ++v)
+  {
+    dst_pointers.push_back(&dst_batched[v]);
+    src_pointers.push_back(&src[v]);
+  }
+  laplace_operator.vmult(dst_pointers, src_pointers);
+
+  std::string const discretization = is_dg ? "DG: " : "CG: ";
+
+  bool match = true;
+  for(unsigned int v = 0; v < n_vectors; ++v)
+  {
+    double const norm = dst_single[v].linfty_norm();
+    dst_batched[v] -= dst_single[v];
+    if(dst_batched[v].linfty_norm() > 1.e-12 * norm)
+      match = false;
+  }
+
+  pcout << discretization << "Batched vmult on " << n_vectors
+        << " vectors matches single vmults: " << std::boolalpha << match << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(true);
+    ExaDG::test(false);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
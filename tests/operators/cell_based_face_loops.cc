@@ -0,0 +1,269 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/categorization.h>
+#include <exadg/operators/finite_element.h>
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+
+// Check that the diagonal and the block diagonal of the interior penalty Laplace operator computed
+// with cell-based face loops agree with the face-based computation on a deformed mesh and on a
+// locally refined, deformed mesh with hanging faces.
+
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef Poisson::LaplaceOperator<dim, double, 1> Operator;
+
+void
+distort(dealii::Triangulation<dim> & triangulation)
+{
+  // non-affine deformation of the interior cells, the boundary is not moved
+  dealii::GridTools::transform(
+    [](dealii::Point<dim> const & p) {
+      dealii::Point<dim> result = p;
+      result[0] += 0.08 * std::sin(dealii::numbers::PI * p[0]) *
+                   std::sin(2.0 * dealii::numbers::PI * p[1]);
+      result[1] += 0.06 * std::sin(2.0 * dealii::numbers::PI * p[0]) *
+                   std::sin(dealii::numbers::PI * p[1]);
+      return result;
+    },
+    triangulation);
+}
+
+void
+setup_matrix_free(dealii::MatrixFree<dim, double> &         matrix_free,
+                  dealii::Mapping<dim> const &              mapping,
+                  dealii::DoFHandler<dim> const &           dof_handler,
+                  dealii::AffineConstraints<double> const & constraints,
+                  bool const                                use_cell_based_loops)
+{
+  MappingFlags const flags =
+    Poisson::Operators::LaplaceKernel<dim, double, 1>::get_mapping_flags(true, true);
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags                = flags.cells;
+  additional_data.mapping_update_flags_inner_faces    = flags.inner_faces;
+  additional_data.mapping_update_flags_boundary_faces = flags.boundary_faces;
+
+  if(use_cell_based_loops)
+    Categorization::do_cell_based_loops(dof_handler.get_triangulation(), additional_data);
+
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+}
+
+void
+initialize_operator(Operator &                                                 laplace_operator,
+                    dealii::MatrixFree<dim, double> const &                    matrix_free,
+                    dealii::AffineConstraints<double> const &                  constraints,
+                    std::shared_ptr<Poisson::BoundaryDescriptor<0, dim>> const bc,
+                    bool const use_cell_based_loops)
+{
+  Poisson::LaplaceOperatorData<0, dim> data;
+  data.bc                   = bc;
+  data.use_cell_based_loops = use_cell_based_loops;
+
+  laplace_operator.initialize(matrix_free, constraints, data);
+}
+
+// block matrices in the order of the active cells of the triangulation
+std::vector<dealii::LAPACKFullMatrix<double>>
+calculate_block_diagonal(Operator const &                        laplace_operator,
+                         dealii::MatrixFree<dim, double> const & matrix_free,
+                         unsigned int const                      dofs_per_cell)
+{
+  unsigned int const n_lanes = dealii::VectorizedArray<double>::size();
+
+  std::vector<dealii::LAPACKFullMatrix<double>> matrices(
+    matrix_free.n_cell_batches() * n_lanes, dealii::LAPACKFullMatrix<double>(dofs_per_cell));
+  laplace_operator.add_block_diagonal_matrices(matrices);
+
+  std::vector<dealii::LAPACKFullMatrix<double>> matrices_sorted(
+    matrix_free.get_dof_handler().get_triangulation().n_active_cells(),
+    dealii::LAPACKFullMatrix<double>(dofs_per_cell));
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      matrices_sorted[matrix_free.get_cell_iterator(cell, v)->active_cell_index()] =
+        matrices[cell * n_lanes + v];
+  }
+
+  return matrices_sorted;
+}
+
+void
+create_triangulation(dealii::Triangulation<dim> & triangulation, bool const locally_refined)
+{
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+
+  if(locally_refined)
+  {
+    // deform the mesh before the local refinement so that the hanging nodes lie on the straight
+    // faces of the coarse cells
+    triangulation.refine_global(2);
+    distort(triangulation);
+
+    for(auto const & cell : triangulation.active_cell_iterators())
+    {
+      if(cell->center()[0] < 0.5)
+        cell->set_refine_flag();
+    }
+    triangulation.execute_coarsening_and_refinement();
+
+    triangulation.begin_active()->set_refine_flag();
+    triangulation.execute_coarsening_and_refinement();
+  }
+  else
+  {
+    triangulation.refine_global(3);
+    distort(triangulation);
+  }
+}
+
+void
+test(bool const locally_refined)
+{
+  dealii::Triangulation<dim> triangulation;
+  create_triangulation(triangulation, locally_refined);
+
+  dealii::MappingQ<dim> const mapping(1);
+
+  std::shared_ptr<dealii::FiniteElement<dim>> fe =
+    create_finite_element<dim>(ElementType::Hypercube, true, 1, degree);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*fe);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  auto bc = std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  bc->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  dealii::MatrixFree<dim, double> matrix_free_face_based, matrix_free_cell_based;
+  setup_matrix_free(matrix_free_face_based, mapping, dof_handler, constraints, false);
+  setup_matrix_free(matrix_free_cell_based, mapping, dof_handler, constraints, true);
+
+  Operator operator_face_based, operator_cell_based;
+  initialize_operator(operator_face_based, matrix_free_face_based, constraints, bc, false);
+  initialize_operator(operator_cell_based, matrix_free_cell_based, constraints, bc, true);
+
+  std::string const mesh = locally_refined ? "Locally refined mesh: " : "Deformed mesh: ";
+
+  // diagonal
+  VectorType diagonal_face_based, diagonal_cell_based;
+  operator_face_based.calculate_diagonal(diagonal_face_based);
+  operator_cell_based.calculate_diagonal(diagonal_cell_based);
+
+  double const diagonal_norm = diagonal_face_based.linfty_norm();
+  diagonal_cell_based -= diagonal_face_based;
+
+  std::cout << mesh << "Cell-based diagonal matches face-based diagonal: " << std::boolalpha
+            << (diagonal_cell_based.linfty_norm() < 1.e-10 * diagonal_norm) << std::endl;
+
+  // block diagonal
+  std::vector<dealii::LAPACKFullMatrix<double>> const matrices_face_based =
+    calculate_block_diagonal(operator_face_based, matrix_free_face_based, fe->n_dofs_per_cell());
+  std::vector<dealii::LAPACKFullMatrix<double>> const matrices_cell_based =
+    calculate_block_diagonal(operator_cell_based, matrix_free_cell_based, fe->n_dofs_per_cell());
+
+  double max_entry = 0.0, max_difference = 0.0;
+  for(unsigned int c = 0; c < matrices_face_based.size(); ++c)
+  {
+    for(unsigned int i = 0; i < fe->n_dofs_per_cell(); ++i)
+    {
+      for(unsigned int j = 0; j < fe->n_dofs_per_cell(); ++j)
+      {
+        max_entry = std::max(max_entry, std::abs(matrices_face_based[c](i, j)));
+        max_difference =
+          std::max(max_difference,
+                   std::abs(matrices_cell_based[c](i, j) - matrices_face_based[c](i, j)));
+      }
+    }
+  }
+
+  std::cout << mesh << "Cell-based block diagonal matches face-based block diagonal: "
+            << (max_difference < 1.e-10 * max_entry) << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(false);
+    ExaDG::test(true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,230 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/postprocessor/statistics_manager.h>
+
+namespace ExaDG
+{
+unsigned int const dim       = 3;
+unsigned int const fe_degree = 3;
+
+double const gamma_stretching = 1.5;
+
+double
+stretch(double const y)
+{
+  return std::tanh(gamma_stretching * y) / std::tanh(gamma_stretching);
+}
+
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    if(component == 0)
+      return 1.0 - p[1] * p[1] + 0.1 * std::sin(p[0]) * std::cos(2.0 * p[2]);
+    else if(component == 1)
+      return 0.1 * std::sin(p[0]) * std::sin(dealii::numbers::PI * p[1]);
+    else
+      return 0.2 * std::cos(p[0]) * (1.0 - p[1] * p[1]);
+  }
+};
+
+std::vector<std::string>
+read_tokens(std::string const & filename)
+{
+  std::ifstream            file(filename);
+  std::vector<std::string> tokens;
+  std::string              token;
+  while(file >> token)
+    tokens.push_back(token);
+  return tokens;
+}
+
+bool
+to_double(std::string const & token, double & value)
+{
+  std::istringstream stream(token);
+  stream >> value;
+  return not stream.fail() and stream.eof();
+}
+
+/*
+ * Compares the statistics of turbulent channel flow written by the dealii::FEValues-based and the
+ * matrix-free evaluation. The velocity vector has ghost entries for all locally relevant degrees
+ * of freedom, i.e., its partitioner differs from the one of the MatrixFree object used by the
+ * matrix-free evaluation, as is the case for the vectors of the flow solver.
+ */
+void
+test_statistics(MPI_Comm const & mpi_comm)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  // channel with cells stretched towards the walls at y = -1 and y = 1
+  dealii::parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  dealii::GridGenerator::subdivided_hyper_rectangle(triangulation,
+                                                    {2, 2, 2},
+                                                    dealii::Point<dim>(0.0, -1.0, 0.0),
+                                                    dealii::Point<dim>(2.0 * dealii::numbers::PI,
+                                                                       1.0,
+                                                                       dealii::numbers::PI));
+  triangulation.refine_global(1);
+  dealii::GridTools::transform(
+    [](dealii::Point<dim> const & p) {
+      return dealii::Point<dim>(p[0], stretch(p[1]), p[2]);
+    },
+    triangulation);
+
+  dealii::MappingQ<dim>   mapping(fe_degree);
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(fe_degree), dim);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+  VectorType velocity_owned(dof_handler.locally_owned_dofs(), mpi_comm);
+  dealii::VectorTools::interpolate(mapping, dof_handler, Velocity(), velocity_owned);
+
+  VectorType velocity(dof_handler.locally_owned_dofs(),
+                      dealii::DoFTools::extract_locally_relevant_dofs(dof_handler),
+                      mpi_comm);
+  velocity.copy_locally_owned_data_from(velocity_owned);
+  velocity.update_ghost_values();
+
+  std::vector<std::string> filenames;
+  for(bool const use_matrix_free_evaluation : {false, true})
+  {
+    TurbulentChannelData data;
+    data.time_control_data_statistics.time_control_data.is_active                   = true;
+    data.time_control_data_statistics.write_preliminary_results_every_nth_time_step = 1;
+
+    data.cells_are_stretched        = true;
+    data.use_matrix_free_evaluation = use_matrix_free_evaluation;
+    data.directory                  = "./";
+
+    data.filename = use_matrix_free_evaluation ? "channel_matrix_free" : "channel_fe_values";
+
+    StatisticsManager<dim, double> statistics_manager(dof_handler, mapping);
+    statistics_manager.setup([](double const & y) { return stretch(2.0 * y - 1.0); }, data);
+
+    // evaluate two samples to check the accumulation as well
+    statistics_manager.evaluate(velocity, true);
+    statistics_manager.evaluate(velocity, true);
+    statistics_manager.write_output();
+
+    filenames.push_back(data.directory + data.filename + ".flow_statistics");
+  }
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::vector<std::string> const tokens_fe_values   = read_tokens(filenames[0]);
+    std::vector<std::string> const tokens_matrix_free = read_tokens(filenames[1]);
+
+    bool   same_format    = tokens_fe_values.size() == tokens_matrix_free.size();
+    double max_difference = 0.0;
+    for(unsigned int i = 0; same_format and i < tokens_fe_values.size(); ++i)
+    {
+      double value_fe_values = 0.0, value_matrix_free = 0.0;
+      if(to_double(tokens_fe_values[i], value_fe_values) and
+         to_double(tokens_matrix_free[i], value_matrix_free))
+      {
+        max_difference = std::max(max_difference,
+                                  std::abs(value_fe_values - value_matrix_free) /
+                                    std::max(1.0, std::abs(value_fe_values)));
+      }
+      else
+      {
+        same_format = (tokens_fe_values[i] == tokens_matrix_free[i]);
+      }
+    }
+
+    std::cout << "Output files have same format: " << (same_format ? "true" : "false")
+              << std::endl;
+    std::cout << "Statistics of both evaluation paths agree: "
+              << (max_difference < 1.e-6 ? "true" : "false") << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test_statistics(MPI_COMM_WORLD);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
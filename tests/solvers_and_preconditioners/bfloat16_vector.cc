@@ -0,0 +1,142 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/utilities/bfloat16_vector.h>
+
+// Check the conversion to the bfloat16 format used for the reduced storage of the inverse diagonal
+// on coarse multigrid levels: exact representation of numbers with 8 significant bits, relative
+// rounding error of at most 2^-8 over the whole exponent range of float, rounding ties to even,
+// and the diagonal scaling of a vector.
+
+namespace ExaDG
+{
+void
+test()
+{
+  double const tolerance = std::pow(2.0, -8);
+
+  // numbers with 8 significant bits are represented exactly
+  bool exact = true;
+  for(float const value : {0.0f, 1.0f, -2.0f, 0.375f, 255.0f, std::ldexp(3.0f, -100)})
+    exact = exact and (BFloat16Vector::to_float(BFloat16Vector::to_bfloat16(value)) == value);
+
+  std::cout << "Numbers with 8 significant bits are exact: " << std::boolalpha << exact
+            << std::endl;
+
+  // relative rounding error
+  double max_error = 0.0;
+  for(double exponent = -35.0; exponent < 35.0; exponent += 0.01)
+  {
+    float const value   = static_cast<float>(std::pow(10.0, exponent));
+    float const rounded = BFloat16Vector::to_float(BFloat16Vector::to_bfloat16(value));
+    max_error = std::max(max_error, std::abs(static_cast<double>(rounded) - value) / value);
+  }
+
+  std::cout << "Relative rounding error is at most 2^-8: " << (max_error <= tolerance)
+            << std::endl;
+
+  // 1 + 2^-8 is the midpoint between 1 and 1 + 2^-7 and is rounded to the even number 1, while
+  // 1 + 3 * 2^-8 is rounded up to the even number 1 + 2^-6
+  bool const ties_to_even =
+    BFloat16Vector::to_float(BFloat16Vector::to_bfloat16(1.0f + std::pow(2.0f, -8))) == 1.0f and
+    BFloat16Vector::to_float(BFloat16Vector::to_bfloat16(1.0f + 3.0f * std::pow(2.0f, -8))) ==
+      1.0f + std::pow(2.0f, -6);
+
+  std::cout << "Ties are rounded to even: " << ties_to_even << std::endl;
+
+  std::cout << "NaN remains NaN: "
+            << std::isnan(BFloat16Vector::to_float(
+                 BFloat16Vector::to_bfloat16(std::numeric_limits<float>::quiet_NaN())))
+            << std::endl;
+
+  // diagonal scaling, also in place
+  unsigned int const size = 100;
+
+  dealii::LinearAlgebra::distributed::Vector<float> diagonal(size), src(size), dst(size);
+  for(unsigned int i = 0; i < size; ++i)
+  {
+    diagonal.local_element(i) = 1.0f / (1.0f + 0.37f * i);
+    src.local_element(i)      = std::sin(0.1f * i) + 2.0f;
+  }
+
+  BFloat16Vector diagonal_reduced;
+  diagonal_reduced.copy_locally_owned_data_from(diagonal);
+
+  diagonal_reduced.scale(dst, src);
+  diagonal_reduced.scale(src, src);
+
+  bool scaling = (diagonal_reduced.size() == size);
+  for(unsigned int i = 0; i < size; ++i)
+  {
+    float const reference = diagonal.local_element(i) * (std::sin(0.1f * i) + 2.0f);
+    scaling = scaling and std::abs(dst.local_element(i) - reference) <= tolerance * reference and
+              dst.local_element(i) == src.local_element(i);
+  }
+
+  std::cout << "Diagonal scaling matches float: " << scaling << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
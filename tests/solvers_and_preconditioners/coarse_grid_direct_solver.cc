@@ -0,0 +1,217 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/operators/finite_element.h>
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+#include <exadg/solvers_and_preconditioners/multigrid/coarse_grid_solvers.h>
+
+// Check that the direct coarse-grid solver (sparse LU factorization of the assembled matrix by
+// Amesos KLU) gives the same result as the conjugate gradient coarse-grid solver with a tight
+// tolerance for the interior penalty (DG) and the continuous (CG) Laplace operator. The solve is
+// repeated after update() to check the re-factorization.
+
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef Poisson::LaplaceOperator<dim, double, 1> Operator;
+
+void
+create_triangulation(dealii::parallel::distributed::Triangulation<dim> & triangulation)
+{
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(2);
+
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned() and cell->center()[0] < 0.5 and cell->center()[1] < 0.5)
+      cell->set_refine_flag();
+  }
+  triangulation.execute_coarsening_and_refinement();
+}
+
+// fill the vector with values depending on the global index only, i.e., independently of the
+// partitioning, and zero entries for constrained degrees of freedom
+void
+fill_vector(VectorType & vector, dealii::AffineConstraints<double> const & constraints)
+{
+  dealii::IndexSet const & owned = vector.locally_owned_elements();
+  for(unsigned int i = 0; i < owned.n_elements(); ++i)
+    vector.local_element(i) = std::sin(0.37 * owned.nth_index_in_set(i));
+
+  constraints.set_zero(vector);
+}
+
+void
+test(bool const is_dg)
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  create_triangulation(triangulation);
+
+  dealii::MappingQ<dim> const mapping(1);
+
+  std::shared_ptr<dealii::FiniteElement<dim>> fe =
+    create_finite_element<dim>(ElementType::Hypercube, is_dg, 1, degree);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*fe);
+
+  dealii::AffineConstraints<double> constraints;
+  if(not is_dg)
+  {
+    constraints.reinit(dof_handler.locally_owned_dofs(),
+                       dealii::DoFTools::extract_locally_relevant_dofs(dof_handler));
+    dealii::DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+    dealii::DoFTools::make_zero_boundary_constraints(dof_handler, 0, constraints);
+  }
+  constraints.close();
+
+  MappingFlags const flags =
+    Poisson::Operators::LaplaceKernel<dim, double, 1>::get_mapping_flags(true, true);
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags                = flags.cells;
+  additional_data.mapping_update_flags_inner_faces    = flags.inner_faces;
+  additional_data.mapping_update_flags_boundary_faces = flags.boundary_faces;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  auto bc = std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  bc->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  Poisson::LaplaceOperatorData<0, dim> data;
+  data.bc = bc;
+
+  Operator laplace_operator;
+  laplace_operator.initialize(matrix_free, constraints, data);
+
+  // coarse-grid solvers
+  MGCoarseDirect<Operator> direct_solver(laplace_operator,
+                                         true /* initialize */,
+                                         false /* operator_is_singular */);
+
+  typename MGCoarseKrylov<Operator>::AdditionalData krylov_data;
+  krylov_data.solver_type    = MultigridCoarseGridSolver::CG;
+  krylov_data.solver_data    = SolverData(1000, 1.e-20, 1.e-14);
+  krylov_data.preconditioner = MultigridCoarseGridPreconditioner::PointJacobi;
+
+  MGCoarseKrylov<Operator> krylov_solver(laplace_operator,
+                                         true /* initialize */,
+                                         krylov_data,
+                                         mpi_comm);
+
+  VectorType src, dst_direct, dst_krylov;
+  laplace_operator.initialize_dof_vector(src);
+  laplace_operator.initialize_dof_vector(dst_direct);
+  laplace_operator.initialize_dof_vector(dst_krylov);
+  fill_vector(src, constraints);
+
+  std::string const discretization = is_dg ? "DG: " : "CG: ";
+
+  for(unsigned int i = 0; i < 2; ++i)
+  {
+    if(i > 0)
+    {
+      direct_solver.update();
+      krylov_solver.update();
+    }
+
+    dst_direct = 0.0;
+    dst_krylov = 0.0;
+    direct_solver(0, dst_direct, src);
+    krylov_solver(0, dst_krylov, src);
+
+    double const norm = dst_krylov.linfty_norm();
+    dst_direct -= dst_krylov;
+
+    pcout << discretization << "Direct coarse-grid solver matches CG coarse-grid solver"
+          << (i > 0 ? " after update: " : ": ") << std::boolalpha
+          << (norm > 0.0 and dst_direct.linfty_norm() < 1.e-10 * norm) << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(true);
+    ExaDG::test(false);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
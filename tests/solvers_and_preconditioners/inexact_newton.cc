@@ -0,0 +1,242 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/newton/newton_solver.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+// Solve the nonlinear problem -u'' + u^3 = f with homogeneous Dirichlet boundary conditions,
+// discretized by finite differences, with the exact and the inexact Newton method. Both variants
+// have to converge to the same solution, and the adaptive forcing term of the inexact Newton method
+// has to reduce the number of linear iterations.
+
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const M = 50;
+
+double const h = 1.0 / (M + 1);
+
+double const f = 100.0;
+
+/*
+ * Applies the second-order finite difference approximation of -u''.
+ */
+void
+apply_laplace(VectorType & dst, VectorType const & src)
+{
+  for(unsigned int i = 0; i < M; ++i)
+  {
+    dst[i] = 2.0 * src[i];
+    if(i > 0)
+      dst[i] -= src[i - 1];
+    if(i + 1 < M)
+      dst[i] -= src[i + 1];
+    dst[i] /= h * h;
+  }
+}
+
+class NonlinearOperator
+{
+public:
+  void
+  evaluate_residual(VectorType & dst, VectorType const & src) const
+  {
+    apply_laplace(dst, src);
+    for(unsigned int i = 0; i < M; ++i)
+      dst[i] += src[i] * src[i] * src[i] - f;
+  }
+};
+
+/*
+ * Jacobian of the nonlinear operator at the linearization point.
+ */
+class LinearOperator
+{
+public:
+  LinearOperator() : solution_linearization(M)
+  {
+  }
+
+  void
+  set_solution_linearization(VectorType const & solution)
+  {
+    solution_linearization = solution;
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    apply_laplace(dst, src);
+    for(unsigned int i = 0; i < M; ++i)
+      dst[i] += 3.0 * solution_linearization[i] * solution_linearization[i] * src[i];
+  }
+
+  double
+  get_diagonal(unsigned int const i) const
+  {
+    return 2.0 / (h * h) + 3.0 * solution_linearization[i] * solution_linearization[i];
+  }
+
+private:
+  VectorType solution_linearization;
+};
+
+class JacobiPreconditioner : public PreconditionerBase<double>
+{
+public:
+  JacobiPreconditioner(LinearOperator const & linear_operator_in)
+    : linear_operator(linear_operator_in), inverse_diagonal(M)
+  {
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const override
+  {
+    for(unsigned int i = 0; i < M; ++i)
+      dst[i] = inverse_diagonal[i] * src[i];
+  }
+
+  void
+  update() override
+  {
+    for(unsigned int i = 0; i < M; ++i)
+      inverse_diagonal[i] = 1.0 / linear_operator.get_diagonal(i);
+
+    this->update_needed = false;
+  }
+
+private:
+  LinearOperator const & linear_operator;
+
+  VectorType inverse_diagonal;
+};
+
+struct Result
+{
+  VectorType solution;
+
+  unsigned int linear_iterations;
+
+  unsigned long long estimated_n_saved_linear_iterations;
+};
+
+Result
+solve(bool const use_inexact_newton)
+{
+  NonlinearOperator    nonlinear_operator;
+  LinearOperator       linear_operator;
+  JacobiPreconditioner preconditioner(linear_operator);
+
+  Krylov::SolverDataCG linear_solver_data;
+  linear_solver_data.max_iter             = 1000;
+  linear_solver_data.solver_tolerance_rel = 1.e-12;
+  linear_solver_data.use_preconditioner   = true;
+
+  Krylov::SolverCG<LinearOperator, PreconditionerBase<double>, VectorType> linear_solver(
+    linear_operator, preconditioner, linear_solver_data);
+
+  Newton::SolverData newton_solver_data(100, 1.e-14, 1.e-10);
+  newton_solver_data.use_inexact_newton = use_inexact_newton;
+
+  Newton::Solver<VectorType,
+                 NonlinearOperator,
+                 LinearOperator,
+                 Krylov::SolverCG<LinearOperator, PreconditionerBase<double>, VectorType>>
+    newton_solver(newton_solver_data, nonlinear_operator, linear_operator, linear_solver);
+
+  Result result;
+  result.solution.reinit(M);
+
+  Newton::UpdateData update;
+  std::tie(std::ignore, result.linear_iterations) = newton_solver.solve(result.solution, update);
+
+  result.estimated_n_saved_linear_iterations =
+    newton_solver.get_estimated_n_saved_linear_iterations();
+
+  return result;
+}
+
+void
+test()
+{
+  Result const exact   = solve(false);
+  Result const inexact = solve(true);
+
+  VectorType difference = inexact.solution;
+  difference -= exact.solution;
+
+  std::cout << "Inexact Newton converges to the solution of exact Newton: " << std::boolalpha
+            << (difference.linfty_norm() < 1.e-8 * exact.solution.linfty_norm()) << std::endl;
+  std::cout << "Inexact Newton needs fewer linear iterations: "
+            << (inexact.linear_iterations < exact.linear_iterations) << std::endl;
+  std::cout << "Exact Newton estimates no saved linear iterations: "
+            << (exact.estimated_n_saved_linear_iterations == 0) << std::endl;
+  std::cout << "Inexact Newton estimates saved linear iterations: "
+            << (inexact.estimated_n_saved_linear_iterations > 0) << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,298 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+#include <exadg/solvers_and_preconditioners/solvers/pipelined_krylov_solvers.h>
+
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const M = 50;
+
+double const rel_tol = 1.e-10;
+
+/*
+ * Distributes the M rows evenly over the MPI processes. The ghost entries are the neighboring rows
+ * of the first and the last locally owned row.
+ */
+std::shared_ptr<dealii::Utilities::MPI::Partitioner const>
+create_partitioner()
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  dealii::IndexSet const locally_owned =
+    dealii::Utilities::MPI::create_evenly_distributed_partitioning(mpi_comm, M);
+
+  dealii::IndexSet ghost(M);
+  if(locally_owned.n_elements() > 0)
+  {
+    unsigned int const first = locally_owned.nth_index_in_set(0);
+    unsigned int const last  = locally_owned.nth_index_in_set(locally_owned.n_elements() - 1);
+    if(first > 0)
+      ghost.add_index(first - 1);
+    if(last + 1 < M)
+      ghost.add_index(last + 1);
+  }
+
+  return std::make_shared<dealii::Utilities::MPI::Partitioner>(locally_owned, ghost, mpi_comm);
+}
+
+/*
+ * Tridiagonal matrix with constant coefficients and homogeneous Dirichlet boundaries.
+ */
+class TridiagonalOperator
+{
+public:
+  TridiagonalOperator(double const lower_in, double const diagonal_in, double const upper_in)
+    : lower(lower_in), diagonal(diagonal_in), upper(upper_in)
+  {
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    src.update_ghost_values();
+
+    for(auto const i : src.locally_owned_elements())
+    {
+      dst(i) = diagonal * src(i);
+      if(i > 0)
+        dst(i) += lower * src(i - 1);
+      if(i + 1 < M)
+        dst(i) += upper * src(i + 1);
+    }
+
+    src.zero_out_ghost_values();
+  }
+
+  double
+  relative_residual(VectorType const & x, VectorType const & rhs) const
+  {
+    VectorType residual(rhs.get_partitioner());
+    vmult(residual, x);
+    residual.add(-1.0, rhs);
+    return residual.l2_norm() / rhs.l2_norm();
+  }
+
+  double const lower, diagonal, upper;
+};
+
+class JacobiPreconditioner : public PreconditionerBase<double>
+{
+public:
+  JacobiPreconditioner(double const diagonal_in) : diagonal(diagonal_in)
+  {
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const override
+  {
+    dst.equ(1.0 / diagonal, src);
+  }
+
+  void
+  update() override
+  {
+    this->update_needed = false;
+  }
+
+private:
+  double const diagonal;
+};
+
+VectorType
+create_rhs()
+{
+  VectorType rhs(create_partitioner());
+  for(auto const i : rhs.locally_owned_elements())
+    rhs(i) = 1.0 + std::sin(static_cast<double>(i));
+  return rhs;
+}
+
+void
+test_cg()
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  TridiagonalOperator  op(-1.0, 2.0, -1.0);
+  JacobiPreconditioner preconditioner(2.0);
+  VectorType const     rhs = create_rhs();
+
+  Krylov::SolverDataCG solver_data;
+  solver_data.max_iter             = 1000;
+  solver_data.solver_tolerance_rel = rel_tol;
+  solver_data.use_preconditioner   = true;
+
+  Krylov::SolverCG<TridiagonalOperator, PreconditionerBase<double>, VectorType> solver_cg(
+    op, preconditioner, solver_data);
+  Krylov::SolverPipelinedCG<TridiagonalOperator, PreconditionerBase<double>, VectorType>
+    solver_pipelined_cg(op, preconditioner, solver_data);
+
+  VectorType         x_cg(rhs.get_partitioner()), x_pipelined_cg(rhs.get_partitioner());
+  unsigned int const n_iter_cg           = solver_cg.solve(x_cg, rhs);
+  unsigned int const n_iter_pipelined_cg = solver_pipelined_cg.solve(x_pipelined_cg, rhs);
+
+  pcout << "Pipelined CG converged: " << std::boolalpha
+        << (op.relative_residual(x_pipelined_cg, rhs) < 10.0 * rel_tol) << std::endl;
+  pcout << "Pipelined CG iterations match CG: "
+        << (n_iter_pipelined_cg + 1 >= n_iter_cg and n_iter_pipelined_cg <= n_iter_cg + 1)
+        << std::endl;
+}
+
+void
+test_gmres()
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  // non-symmetric operator
+  TridiagonalOperator  op(-1.5, 3.0, -0.5);
+  JacobiPreconditioner preconditioner(3.0);
+  VectorType const     rhs = create_rhs();
+
+  Krylov::SolverDataGMRES solver_data;
+  solver_data.max_iter             = 1000;
+  solver_data.solver_tolerance_rel = rel_tol;
+  solver_data.use_preconditioner   = true;
+
+  for(unsigned int const max_n_tmp_vectors : {60, 10})
+  {
+    solver_data.max_n_tmp_vectors = max_n_tmp_vectors;
+
+    Krylov::SolverGMRESLowSync<TridiagonalOperator, PreconditionerBase<double>, VectorType>
+      solver(op, preconditioner, solver_data);
+
+    VectorType x(rhs.get_partitioner());
+    solver.solve(x, rhs);
+
+    pcout << "Low-synchronization GMRES (max_n_tmp_vectors = " << max_n_tmp_vectors
+          << ") converged: " << (op.relative_residual(x, rhs) < 10.0 * rel_tol) << std::endl;
+  }
+}
+
+void
+test_gmres_breakdown()
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  VectorType const rhs = create_rhs();
+
+  Krylov::SolverDataGMRES solver_data;
+  solver_data.max_iter             = 20;
+  solver_data.solver_tolerance_rel = rel_tol;
+  solver_data.use_preconditioner   = true;
+  solver_data.max_n_tmp_vectors    = 10;
+
+  // lucky breakdown: the preconditioned operator is the identity and the first Krylov space is
+  // invariant, i.e., the exact solution is found in the first iteration
+  {
+    TridiagonalOperator  op(0.0, 2.0, 0.0);
+    JacobiPreconditioner preconditioner(2.0);
+
+    Krylov::SolverGMRESLowSync<TridiagonalOperator, PreconditionerBase<double>, VectorType>
+      solver(op, preconditioner, solver_data);
+
+    VectorType         x(rhs.get_partitioner());
+    unsigned int const n_iter = solver.solve(x, rhs);
+
+    pcout << "Low-synchronization GMRES (lucky breakdown) converged in one iteration: "
+          << (op.relative_residual(x, rhs) < 10.0 * rel_tol and n_iter == 1) << std::endl;
+  }
+
+  // breakdown with singular Hessenberg matrix: the residual can not be reduced and the solver
+  // has to fail without producing NaN values
+  {
+    TridiagonalOperator  op(0.0, 0.0, 0.0);
+    JacobiPreconditioner preconditioner(1.0);
+
+    Krylov::SolverGMRESLowSync<TridiagonalOperator, PreconditionerBase<double>, VectorType>
+      solver(op, preconditioner, solver_data);
+
+    VectorType x(rhs.get_partitioner());
+    bool       no_convergence = false;
+    try
+    {
+      solver.solve(x, rhs);
+    }
+    catch(dealii::SolverControl::NoConvergence const &)
+    {
+      no_convergence = true;
+    }
+
+    pcout << "Low-synchronization GMRES (singular breakdown) fails with finite solution: "
+          << (no_convergence and std::isfinite(x.l2_norm())) << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test_cg();
+    ExaDG::test_gmres();
+    ExaDG::test_gmres_breakdown();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
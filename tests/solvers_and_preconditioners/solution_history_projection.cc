@@ -0,0 +1,189 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/solution_history_projection.h>
+
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const M = 10;
+
+double const tol = 1.e-12;
+
+/*
+ * Solves A x = b with a direct solver, where A is the 1D Laplacian with Dirichlet boundaries.
+ */
+class LaplaceProblem
+{
+public:
+  LaplaceProblem() : A(M, M), A_inverse(M, M)
+  {
+    for(unsigned int i = 0; i < M; ++i)
+    {
+      A(i, i) = 2.0;
+      if(i > 0)
+        A(i, i - 1) = -1.0;
+      if(i + 1 < M)
+        A(i, i + 1) = -1.0;
+    }
+    A_inverse.invert(A);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    apply_matrix(dst, A, src);
+  }
+
+  VectorType
+  solve(VectorType const & rhs) const
+  {
+    VectorType solution(M);
+    apply_matrix(solution, A_inverse, rhs);
+    return solution;
+  }
+
+  double
+  relative_residual(VectorType const & x, VectorType const & rhs) const
+  {
+    VectorType residual(M);
+    vmult(residual, x);
+    residual.add(-1.0, rhs);
+    return residual.l2_norm() / rhs.l2_norm();
+  }
+
+private:
+  static void
+  apply_matrix(VectorType & dst, dealii::FullMatrix<double> const & matrix, VectorType const & src)
+  {
+    dealii::Vector<double> src_serial(M), dst_serial(M);
+    for(unsigned int i = 0; i < M; ++i)
+      src_serial[i] = src[i];
+    matrix.vmult(dst_serial, src_serial);
+    for(unsigned int i = 0; i < M; ++i)
+      dst[i] = dst_serial[i];
+  }
+
+  dealii::FullMatrix<double> A;
+  dealii::FullMatrix<double> A_inverse;
+};
+
+void
+test()
+{
+  LaplaceProblem problem;
+
+  auto const apply_operator = [&](VectorType & dst, VectorType const & src) {
+    problem.vmult(dst, src);
+  };
+
+  SolutionHistoryProjection<VectorType> history;
+  history.reinit(2);
+
+  VectorType b1(M), b2(M), x0(M);
+  for(unsigned int i = 0; i < M; ++i)
+  {
+    b1[i] = 1.0;
+    b2[i] = static_cast<double>(i * i);
+  }
+
+  // empty basis: no initial guess
+  std::cout << "Initial guess available (empty basis): " << std::boolalpha
+            << history.compute_initial_guess(x0, b1) << std::endl;
+
+  history.update(problem.solve(b1), apply_operator);
+  std::cout << "Basis size: " << history.size() << std::endl;
+
+  // right-hand side in the span of previous right-hand sides: projection is the exact solution
+  VectorType rhs(b1);
+  rhs *= 3.0;
+  history.compute_initial_guess(x0, rhs);
+  std::cout << "Initial guess exact (multiple of b1): "
+            << (problem.relative_residual(x0, rhs) < tol) << std::endl;
+
+  // new direction: initial guess is not exact, basis is extended by the correction
+  history.compute_initial_guess(x0, b2);
+  std::cout << "Initial guess exact (b2): " << (problem.relative_residual(x0, b2) < tol)
+            << std::endl;
+  history.update(problem.solve(b2), apply_operator);
+  std::cout << "Basis size: " << history.size() << std::endl;
+
+  rhs = b1;
+  rhs.add(-0.5, b2);
+  history.compute_initial_guess(x0, rhs);
+  std::cout << "Initial guess exact (b1 - 0.5 b2): "
+            << (problem.relative_residual(x0, rhs) < tol) << std::endl;
+
+  // maximum size reached: restart with the latest solution
+  history.update(problem.solve(rhs), apply_operator);
+  std::cout << "Basis size after restart: " << history.size() << std::endl;
+
+  history.compute_initial_guess(x0, rhs);
+  std::cout << "Initial guess exact (latest solution): "
+            << (problem.relative_residual(x0, rhs) < tol) << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,397 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/local_time_stepping.h>
+
+// Check LocalTimeStepping for a first-order upwind finite volume discretization of the linear
+// advection equation on a periodic, graded 1D mesh:
+// - with a single time step cluster, the result has to be identical to the global Runge-Kutta
+//   scheme,
+// - with several time step clusters, the scheme converges with second order in time and is
+//   conservative due to the flux registers at the interfaces between clusters.
+
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const h_min    = 1.0 / 64.0;
+double const velocity = 1.0;
+double const end_time = 0.5;
+
+class AdvectionOperator
+{
+public:
+  AdvectionOperator(unsigned int const max_number_of_time_step_clusters)
+  {
+    // the mesh of [0,1] is graded towards the left, the cell size increases by a factor of two
+    // between the three regions
+    cell_sizes.insert(cell_sizes.end(), 16, h_min);
+    cell_sizes.insert(cell_sizes.end(), 12, 2.0 * h_min);
+    cell_sizes.insert(cell_sizes.end(), 6, 4.0 * h_min);
+
+    // cluster by cell size as done in the compressible Navier-Stokes solver
+    n_clusters = 1;
+    time_step_cluster.resize(cell_sizes.size());
+    for(unsigned int i = 0; i < cell_sizes.size(); ++i)
+    {
+      time_step_cluster[i] =
+        std::min(static_cast<unsigned int>(std::floor(std::log2(cell_sizes[i] / h_min) + 1.e-12)),
+                 max_number_of_time_step_clusters - 1);
+      n_clusters = std::max(n_clusters, time_step_cluster[i] + 1);
+    }
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    vector.reinit(cell_sizes.size());
+  }
+
+  unsigned int
+  get_number_of_time_step_clusters() const
+  {
+    return n_clusters;
+  }
+
+  void
+  get_time_step_cluster_dofs(
+    std::vector<std::vector<unsigned int>> &              cluster_dofs,
+    std::vector<std::vector<std::vector<unsigned int>>> & neighbor_dofs) const
+  {
+    unsigned int const n_cells = cell_sizes.size();
+
+    cluster_dofs.assign(n_clusters, std::vector<unsigned int>());
+    neighbor_dofs.assign(n_clusters, std::vector<std::vector<unsigned int>>(n_clusters));
+
+    for(unsigned int i = 0; i < n_cells; ++i)
+    {
+      unsigned int const cluster = time_step_cluster[i];
+      cluster_dofs[cluster].push_back(i);
+
+      for(unsigned int const neighbor : {(i + n_cells - 1) % n_cells, (i + 1) % n_cells})
+      {
+        if(time_step_cluster[neighbor] != cluster)
+          neighbor_dofs[time_step_cluster[neighbor]][cluster].push_back(i);
+      }
+    }
+
+    // cells neighboring two cells of the same other cluster are only stored once
+    for(auto & neighbor_dofs_k : neighbor_dofs)
+    {
+      for(auto & dofs : neighbor_dofs_k)
+        dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+    }
+  }
+
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const /* time */) const
+  {
+    for(unsigned int i = 0; i < cell_sizes.size(); ++i)
+      evaluate_cell(dst, src, i);
+  }
+
+  void
+  evaluate_time_step_cluster(VectorType &       dst,
+                             VectorType const & src,
+                             double const /* time */,
+                             unsigned int const cluster) const
+  {
+    unsigned int const n_cells = cell_sizes.size();
+
+    for(unsigned int i = 0; i < n_cells; ++i)
+    {
+      if(time_step_cluster[i] == cluster)
+        evaluate_cell(dst, src, i);
+      else if(time_step_cluster[i] > cluster)
+        dst[i] = 0.0;
+    }
+
+    // contributions of the faces of the cluster to neighboring cells of coarser clusters
+    for(unsigned int i = 0; i < n_cells; ++i)
+    {
+      unsigned int const left = i, right = (i + 1) % n_cells;
+
+      if(time_step_cluster[left] == cluster and time_step_cluster[right] > cluster)
+        dst[right] += get_flux(src, left);
+      if(time_step_cluster[right] == cluster and time_step_cluster[left] > cluster)
+        dst[left] -= get_flux(src, left);
+    }
+  }
+
+  void
+  evaluate_time_step_cluster_interface(VectorType &       dst,
+                                       VectorType const & src,
+                                       double const /* time */,
+                                       unsigned int const cluster) const
+  {
+    unsigned int const n_cells = cell_sizes.size();
+
+    for(unsigned int i = 0; i < n_cells; ++i)
+    {
+      if(time_step_cluster[i] == cluster)
+        dst[i] = 0.0;
+    }
+
+    // contributions of the faces shared with finer clusters to the cells of the cluster
+    for(unsigned int i = 0; i < n_cells; ++i)
+    {
+      unsigned int const left = i, right = (i + 1) % n_cells;
+
+      if(time_step_cluster[left] == cluster and time_step_cluster[right] < cluster)
+        dst[left] -= get_flux(src, left);
+      if(time_step_cluster[right] == cluster and time_step_cluster[left] < cluster)
+        dst[right] += get_flux(src, left);
+    }
+  }
+
+  void
+  apply_inverse_mass_time_step_cluster(VectorType &       dst,
+                                       VectorType const & src,
+                                       unsigned int const cluster) const
+  {
+    for(unsigned int i = 0; i < cell_sizes.size(); ++i)
+    {
+      if(time_step_cluster[i] == cluster)
+        dst[i] = src[i] / cell_sizes[i];
+    }
+  }
+
+  void
+  interpolate(VectorType & vector) const
+  {
+    double x = 0.0;
+    for(unsigned int i = 0; i < cell_sizes.size(); ++i)
+    {
+      vector[i] = std::sin(2.0 * dealii::numbers::PI * (x + 0.5 * cell_sizes[i]));
+      x += cell_sizes[i];
+    }
+  }
+
+  double
+  integrate(VectorType const & vector) const
+  {
+    double integral = 0.0;
+    for(unsigned int i = 0; i < cell_sizes.size(); ++i)
+      integral += cell_sizes[i] * vector[i];
+    return integral;
+  }
+
+  double
+  integrate_absolute_value(VectorType const & vector) const
+  {
+    double integral = 0.0;
+    for(unsigned int i = 0; i < cell_sizes.size(); ++i)
+      integral += cell_sizes[i] * std::abs(vector[i]);
+    return integral;
+  }
+
+  double
+  l2_error(VectorType const & vector, VectorType const & reference) const
+  {
+    double error = 0.0;
+    for(unsigned int i = 0; i < cell_sizes.size(); ++i)
+      error += cell_sizes[i] * (vector[i] - reference[i]) * (vector[i] - reference[i]);
+    return std::sqrt(error);
+  }
+
+private:
+  // upwind flux over the right face of cell i
+  double
+  get_flux(VectorType const & src, unsigned int const i) const
+  {
+    return velocity * src[i];
+  }
+
+  void
+  evaluate_cell(VectorType & dst, VectorType const & src, unsigned int const i) const
+  {
+    unsigned int const upwind = (i + cell_sizes.size() - 1) % cell_sizes.size();
+
+    dst[i] = (get_flux(src, upwind) - get_flux(src, i)) / cell_sizes[i];
+  }
+
+  std::vector<double>       cell_sizes;
+  std::vector<unsigned int> time_step_cluster;
+  unsigned int              n_clusters;
+};
+
+typedef TimeStepClusterOperator<AdvectionOperator, VectorType> ClusterOperator;
+
+std::shared_ptr<ExplicitTimeIntegrator<ClusterOperator, VectorType>>
+create_cluster_time_integrator(std::shared_ptr<ClusterOperator> cluster_operator)
+{
+  return std::make_shared<ExplicitRungeKuttaTimeIntegrator<ClusterOperator, VectorType>>(
+    4, cluster_operator);
+}
+
+VectorType
+solve(ExplicitTimeIntegrator<AdvectionOperator, VectorType> & time_integrator,
+      AdvectionOperator const &                               pde_operator,
+      double const                                            time_step)
+{
+  VectorType solution, solution_np;
+  pde_operator.initialize_dof_vector(solution);
+  pde_operator.initialize_dof_vector(solution_np);
+  pde_operator.interpolate(solution);
+
+  unsigned int const n_time_steps = static_cast<unsigned int>(std::round(end_time / time_step));
+
+  double time = 0.0;
+  for(unsigned int n = 0; n < n_time_steps; ++n)
+  {
+    time_integrator.solve_timestep(solution_np, solution, time, time_step);
+    solution.swap(solution_np);
+    time += time_step;
+  }
+
+  return solution;
+}
+
+void
+test_single_cluster()
+{
+  auto pde_operator = std::make_shared<AdvectionOperator>(1);
+
+  ExplicitRungeKuttaTimeIntegrator<AdvectionOperator, VectorType> global_time_integrator(
+    4, pde_operator);
+  LocalTimeStepping<AdvectionOperator, VectorType> local_time_integrator(
+    pde_operator, create_cluster_time_integrator);
+
+  double const time_step = 0.5 * h_min / velocity;
+
+  VectorType const solution_global = solve(global_time_integrator, *pde_operator, time_step);
+  VectorType const solution_local  = solve(local_time_integrator, *pde_operator, time_step);
+
+  bool identical = true;
+  for(unsigned int i = 0; i < solution_global.size(); ++i)
+  {
+    if(solution_global[i] != solution_local[i])
+      identical = false;
+  }
+
+  std::cout << "Single time step cluster reproduces global Runge-Kutta: " << std::boolalpha
+            << identical << std::endl;
+}
+
+void
+test_multiple_clusters()
+{
+  auto pde_operator = std::make_shared<AdvectionOperator>(4);
+
+  std::cout << "Number of time step clusters: " << pde_operator->get_number_of_time_step_clusters()
+            << std::endl;
+
+  VectorType initial_solution;
+  pde_operator->initialize_dof_vector(initial_solution);
+  pde_operator->interpolate(initial_solution);
+  double const mass_initial = pde_operator->integrate(initial_solution);
+  double const mass_scale   = pde_operator->integrate_absolute_value(initial_solution);
+
+  // reference solution of the semi-discrete problem with a global time step small enough to
+  // make the temporal error negligible
+  ExplicitRungeKuttaTimeIntegrator<AdvectionOperator, VectorType> global_time_integrator(
+    4, pde_operator);
+  VectorType const reference = solve(global_time_integrator, *pde_operator, h_min / 256.0);
+
+  double const defect_global = std::abs(pde_operator->integrate(reference) - mass_initial);
+
+  // The time step size refers to the coarsest cluster, i.e., the CFL number is 2^(-l-1) in all
+  // clusters with l the refinement level in time. The coarsest level l = 0 is not yet in the
+  // asymptotic range of convergence.
+  std::vector<double> errors;
+  double              defect_local = 0.0;
+  for(unsigned int l = 1; l < 5; ++l)
+  {
+    LocalTimeStepping<AdvectionOperator, VectorType> local_time_integrator(
+      pde_operator, create_cluster_time_integrator);
+
+    double const time_step = 2.0 * h_min / velocity / std::pow(2.0, l);
+
+    VectorType const solution = solve(local_time_integrator, *pde_operator, time_step);
+
+    errors.push_back(pde_operator->l2_error(solution, reference));
+    defect_local =
+      std::max(defect_local, std::abs(pde_operator->integrate(solution) - mass_initial));
+  }
+
+  bool second_order = true;
+  for(unsigned int l = 1; l < errors.size(); ++l)
+  {
+    double const order = std::log2(errors[l - 1] / errors[l]);
+    if(order < 1.8 or order > 2.2)
+      second_order = false;
+  }
+
+  std::cout << "Local time stepping converges with second order: " << second_order << std::endl;
+  std::cout << "Global Runge-Kutta conserves mass: " << (defect_global < 1.e-12 * mass_scale)
+            << std::endl;
+  std::cout << "Local time stepping conserves mass: " << (defect_local < 1.e-12 * mass_scale)
+            << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test_single_cluster();
+    ExaDG::test_multiple_clusters();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -505,6 +505,57 @@ GridToGridProjector<dim, n_components>::project()
     target_dof_handlers,
     mapping,
     data);
+
+  // Repeated projections reusing the setup of a `GridToGridProjector` have to reproduce the
+  // one-shot projection.
+  std::vector<std::vector<VectorType>> vectors_repeated_per_dof_handler(
+    target_vectors_per_dof_handler.size());
+  std::vector<std::vector<VectorType *>> target_vectors_repeated_per_dof_handler(
+    target_vectors_per_dof_handler.size());
+  for(unsigned int i = 0; i < target_vectors_per_dof_handler.size(); ++i)
+  {
+    for(unsigned int j = 0; j < target_vectors_per_dof_handler[i].size(); ++j)
+    {
+      vectors_repeated_per_dof_handler[i].push_back(*target_vectors_per_dof_handler[i][j]);
+    }
+    for(unsigned int j = 0; j < vectors_repeated_per_dof_handler[i].size(); ++j)
+    {
+      target_vectors_repeated_per_dof_handler[i].push_back(&vectors_repeated_per_dof_handler[i][j]);
+    }
+  }
+
+  GridToGridProjection::GridToGridProjector<dim, VectorType::value_type, VectorType> projector;
+  projector.reinit(source_dof_handlers, mapping, target_dof_handlers, mapping, data);
+
+  bool repeated_projections_match = true;
+  for(unsigned int n = 0; n < 2; ++n)
+  {
+    for(unsigned int i = 0; i < vectors_repeated_per_dof_handler.size(); ++i)
+    {
+      for(unsigned int j = 0; j < vectors_repeated_per_dof_handler[i].size(); ++j)
+      {
+        vectors_repeated_per_dof_handler[i][j] = 0.0;
+      }
+    }
+
+    projector.project(source_vectors_per_dof_handler, target_vectors_repeated_per_dof_handler);
+
+    for(unsigned int i = 0; i < vectors_repeated_per_dof_handler.size(); ++i)
+    {
+      for(unsigned int j = 0; j < vectors_repeated_per_dof_handler[i].size(); ++j)
+      {
+        VectorType difference = vectors_repeated_per_dof_handler[i][j];
+        difference -= *target_vectors_per_dof_handler[i][j];
+        if(difference.linfty_norm() > 1.0e-12 * target_vectors_per_dof_handler[i][j]->linfty_norm())
+        {
+          repeated_projections_match = false;
+        }
+      }
+    }
+  }
+
+  pcout << "  Repeated projections match one-shot projection: " << repeated_projections_match
+        << "\n";
 }
 
 template<int dim, int n_components>